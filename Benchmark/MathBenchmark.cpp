@@ -0,0 +1,755 @@
+// --wCũ}CNx`}[N-- //
+// GW{(FumiEngine.vcxproj)ɂ͊܂߂ȂP̂̎st@C
+// v̑OɌʂ̊mFsAŝΌvɏIR[h1Ԃ
+//   ESIMDł̍s̐(operator*=Aoperator*)ƍWϊ(Matrix4Transform)AXJ[ł̌vZƃrbgPʂňv邩
+//   EUtil::SinCos̍ő덷(ulpAΌ덷){x̕WCuƔׂĕ\AExact1ulpAFastΌ덷4e-6𒴂ĂȂ
+//     NaNAA͈͏kłȂ傫ȒlŁAXJ[łSIMDłWCuƓʂɂȂ邩
+//   Ets(Matrix4InverseAMatrix4AffineInverse)|ƒPʍsɂȂ邩A@ϊp̍s񂪋ts̓]uƈv邩Aٍsōs񎮂0ɂȂ邩
+//   EFloat3x4AFloat3x8̓ǂݍ݁A([̗vf܂)AGatherAScatterANormalizeASelectA1vf̌vZƃrbgPʂňv邩
+//   EFrustumFromMatrix̕ʂNbvWł̓OƈvA܂Ƃ߂Ĕ肷CheckFrustum2Sphere1̔ƈv邩
+//   EFloat2`Float4AVector2AVector3As̐Apx̕ϊ萔ŌvZłAlɂȂ邩
+//
+// Linuxł̃rh(|Wg̃[gŎs)
+//   g++ -std=c++14 -O2 -ffp-contract=off -I. Benchmark/MathBenchmark.cpp Collision.cpp Matrix4.cpp Quaternion.cpp Util.cpp -o MathBenchmark
+//   (-mavx tAVXŁA-DFMATH_NO_SIMD tƃXJ[łv)
+//   (ZƉZFMAɂ܂Ƃ߂ƃXJ[łƈvȂȂ̂ŁA-ffp-contract=off t)
+//
+// g
+//   MathBenchmark [--check] [--out .json] [--baseline .json] [--threshold 5] [--filter Öꕔ]
+//   --check w肷ƌʂ̊mFs
+//   --baseline w肷ƓOATCY̌ʂƔrāAthreshold[%]ȏxȂ̂ΏIR[h1Ԃ
+#include "Collision.h"
+#include "Float3x4.h"
+#include "fMath.h"
+#include "Util.h"
+#include "fSIMD.h"
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <vector>
+
+namespace {
+	// --v-- //
+	struct Result
+	{
+		std::string name;// ---> vڂ̖O
+		size_t size;// --------> 1񂠂ɏvf
+		double nsPerOp;// -----> 1vf̎[ns]
+		double opsPerSec;// ---> 1b̏vf
+	};
+
+	// œKŌvZȂ悤Ɍʂސ
+	volatile float g_sink;
+
+	// --ʂOɓ-- //
+	void Consume(float f) { g_sink = f; }
+	void Consume(const Float3& f) { g_sink = f.x + f.y + f.z; }
+	void Consume(const Vector3& v) { g_sink = v.x + v.y + v.z; }
+	void Consume(const Matrix4& m) { g_sink = m.m[0][0] + m.m[3][3]; }
+
+	// --^(xorshiftAvƂɓl邽)-- //
+	struct Random
+	{
+		uint32_t state = 2463534242u;
+		float Next(float min, float max) {
+			state ^= state << 13;
+			state ^= state >> 17;
+			state ^= state << 5;
+			return min + (max - min) * (state / 4294967296.0f);
+		}
+	};
+
+	// --֐JԂĂ1vf̎Ԃ߂-- //
+	// 50msȏォ񐔂܂ŌJԂ𑝂₵A5v̍őlg
+	template <typename Func>
+	Result Measure(const char* name, size_t size, Func func)
+	{
+		using Clock = std::chrono::steady_clock;
+
+		size_t iterations = 1;
+		for (;;) {
+			Clock::time_point start = Clock::now();
+			for (size_t i = 0; i < iterations; i++) func();
+			double ns = std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+			if (ns >= 50.0e6 || iterations >= (size_t(1) << 30)) break;
+			iterations *= 2;
+		}
+
+		double best = 1.0e300;
+		for (int trial = 0; trial < 5; trial++) {
+			Clock::time_point start = Clock::now();
+			for (size_t i = 0; i < iterations; i++) func();
+			double ns = std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+			if (ns < best) best = ns;
+		}
+
+		Result result;
+		result.name = name;
+		result.size = size;
+		result.nsPerOp = best / (double(iterations) * size);
+		result.opsPerSec = 1.0e9 / result.nsPerOp;
+		return result;
+	}
+
+	// --2̒lrbgPʂňv邩-- //
+	template <typename T>
+	bool SameBits(const T& a, const T& b) { return std::memcmp(&a, &b, sizeof(T)) == 0; }
+
+	// --s̐ς̃XJ[(0珇ɑĂASIMDłƔׂ)-- //
+	Matrix4 ReferenceMultiply(const Matrix4& m1, const Matrix4& m2)
+	{
+		Matrix4 result{ 0 };
+		for (int i = 0; i < 4; i++) {
+			for (int j = 0; j < 4; j++) {
+				for (int k = 0; k < 4; k++) {
+					result.m[i][j] += m1.m[i][k] * m2.m[k][j];
+				}
+			}
+		}
+		return result;
+	}
+
+	// --Wϊ̃XJ[(SIMDłƔׂ)-- //
+	Float3 ReferenceTransform(const Float3& v, const Matrix4& m)
+	{
+		float w = v.x * m.m[0][3] + v.y * m.m[1][3] + v.z * m.m[2][3] + m.m[3][3];
+		return Float3(
+			(v.x * m.m[0][0] + v.y * m.m[1][0] + v.z * m.m[2][0] + m.m[3][0]) / w,
+			(v.x * m.m[0][1] + v.y * m.m[1][1] + v.z * m.m[2][1] + m.m[3][1]) / w,
+			(v.x * m.m[0][2] + v.y * m.m[1][2] + v.z * m.m[2][2] + m.m[3][2]) / w);
+	}
+
+	// --s̐ςƍWϊXJ[łƃrbgPʂňv邩m߂(vȂԂ)-- //
+	int CheckMatrixKernels()
+	{
+		// [hsAr[sAˉesɋ߂̂ƁA0╉0܂ޔCӂ̍s
+		Random rnd;
+		std::vector<Matrix4> mats;
+		for (int i = 0; i < 256; i++) {
+			mats.push_back(Matrix4ComposeTRS(
+				{ rnd.Next(0.1f, 4.0f), rnd.Next(0.1f, 4.0f), rnd.Next(0.1f, 4.0f) },
+				QuaternionFromEuler({ rnd.Next(-3.0f, 3.0f), rnd.Next(-3.0f, 3.0f), rnd.Next(-3.0f, 3.0f) }),
+				{ rnd.Next(-100.0f, 100.0f), rnd.Next(-100.0f, 100.0f), rnd.Next(-100.0f, 100.0f) }));
+
+			Matrix4 any;
+			for (int k = 0; k < 16; k++) {
+				float value = rnd.Next(-8.0f, 8.0f);
+				any.m[k / 4][k % 4] = k % 5 == i % 5 ? (i % 2 ? -0.0f : 0.0f) : value;
+			}
+			mats.push_back(any);
+		}
+		const float n = 0.1f, f = 1000.0f, scaleY = 1.0f / std::tan(0.5f);
+		mats.push_back(Matrix4{ scaleY / 1.7f, 0.0f, 0.0f, 0.0f, 0.0f, scaleY, 0.0f, 0.0f, 0.0f, 0.0f, f / (f - n), 1.0f, 0.0f, 0.0f, -n * f / (f - n), 0.0f });
+
+		int failures = 0;
+		for (size_t i = 0; i < mats.size(); i++) {
+			const Matrix4& a = mats[i];
+			const Matrix4& b = mats[(i * 7 + 3) % mats.size()];
+			const Matrix4 expected = ReferenceMultiply(a, b);
+
+			Matrix4 product = a;
+			product *= b;
+			if (!SameBits(product, expected)) failures++;
+			if (!SameBits(a * b, expected)) failures++;
+
+			// gƂ̐(m *= m)
+			Matrix4 square = a;
+			square *= square;
+			if (!SameBits(square, ReferenceMultiply(a, a))) failures++;
+
+			for (int k = 0; k < 8; k++) {
+				const Float3 v(rnd.Next(-50.0f, 50.0f), rnd.Next(-50.0f, 50.0f), k == 0 ? 0.0f : rnd.Next(-50.0f, 50.0f));
+				const Float3 reference = ReferenceTransform(v, a);
+				if (!SameBits(Matrix4Transform(v, a), reference)) failures++;
+				if (!SameBits(v * a, reference)) failures++;
+			}
+		}
+
+		std::fprintf(stderr, "check matrix4 multiply/transform vs scalar: %d mismatch(es)\n", failures);
+		return failures;
+	}
+
+	// --2̍s̗vf̍̍ől(rowsŔׂsAcolsŔׂ񐔂w肷)-- //
+	float MaxDifference(const Matrix4& a, const Matrix4& b, int rows = 4, int cols = 4)
+	{
+		float result = 0.0f;
+		for (int i = 0; i < rows; i++) {
+			for (int j = 0; j < cols; j++) {
+				float d = std::fabs(a.m[i][j] - b.m[i][j]);
+				if (!(d <= result)) result = d;// -> NaNőƂĈ
+			}
+		}
+		return result;
+	}
+
+	// --tsA@ϊp̍sm߂(sԂ)-- //
+	int CheckMatrixInverse()
+	{
+		const float Tolerance = 1e-4f;// -> PʍsƂ̍A2̋ߕ̍̋el
+		const Matrix4 identity = Matrix4Identity();
+		Random rnd;
+		int failures = 0;
+		float maxError = 0.0f;
+		auto expect = [&](float error) {
+			if (!(error <= maxError)) maxError = error;
+			if (!(error <= Tolerance)) failures++;
+		};
+
+		for (int i = 0; i < 256; i++) {
+			// Cӂ̍s(Ίp傫ď})
+			Matrix4 any;
+			for (int k = 0; k < 16; k++) any.m[k / 4][k % 4] = rnd.Next(-1.0f, 1.0f) + (k % 5 == 0 ? 4.0f : 0.0f);
+
+			float det = 0.0f;
+			Matrix4 inv = Matrix4Inverse(any, &det);
+			if (det == 0.0f) failures++;
+			expect(MaxDifference(any * inv, identity));
+			expect(MaxDifference(inv * any, identity));
+
+			// gkA]Asړ[hs
+			const Float3 scale(rnd.Next(0.25f, 4.0f), rnd.Next(0.25f, 4.0f), rnd.Next(0.25f, 4.0f));
+			Matrix4 world = Matrix4ComposeTRS(scale,
+				QuaternionFromEuler({ rnd.Next(-3.0f, 3.0f), rnd.Next(-3.0f, 3.0f), rnd.Next(-3.0f, 3.0f) }),
+				{ rnd.Next(-100.0f, 100.0f), rnd.Next(-100.0f, 100.0f), rnd.Next(-100.0f, 100.0f) });
+
+			float affineDet = 0.0f;
+			Matrix4 affine = Matrix4AffineInverse(world, &affineDet);
+			Matrix4 general = Matrix4Inverse(world, &det);
+			expect(MaxDifference(world * affine, identity));
+			expect(MaxDifference(affine * world, identity));
+			expect(MaxDifference(affine, general) / (1.0f + std::fabs(general.m[3][0]) + std::fabs(general.m[3][1]) + std::fabs(general.m[3][2])));
+
+			// s񎮂͊gk̐ςɂȂ
+			const float scaleDet = scale.x * scale.y * scale.z;
+			expect(std::fabs(affineDet - scaleDet) / scaleDet);
+			expect(std::fabs(det - scaleDet) / scaleDet);
+
+			// @ϊp̍s͍3x3ts̓]uƈvAȊO͒PʍsƓ
+			Matrix4 normal = Matrix4NormalMatrix(world);
+			expect(MaxDifference(normal, Matrix4Transpose(general), 3, 3));
+			Matrix4 outside = normal;
+			for (int row = 0; row < 3; row++) {
+				for (int col = 0; col < 3; col++) outside.m[row][col] = identity.m[row][col];
+			}
+			if (!SameBits(outside, identity)) failures++;
+		}
+
+		// ٍs(̗vfɂČvZ덷oȂ)ł͍s񎮂傤0ɂȂ
+		const Matrix4 singulars[] = {
+			// 4s = 1s + 2 * 2s
+			{ 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f, 8.0f, 2.0f, -1.0f, 0.0f, 3.0f, 11.0f, 14.0f, 17.0f, 20.0f },
+			// 0̍s
+			{ 1.0f, 2.0f, 3.0f, 4.0f, 0.0f, 0.0f, 0.0f, 0.0f, 2.0f, -1.0f, 0.0f, 3.0f, 5.0f, 6.0f, 7.0f, 8.0f },
+			// 3x33s = 1s - 2s(AtBϊs)
+			{ 1.0f, 2.0f, 3.0f, 0.0f, 4.0f, 5.0f, 6.0f, 0.0f, -3.0f, -3.0f, -3.0f, 0.0f, 7.0f, 8.0f, 9.0f, 1.0f },
+			// gk0̎
+			Matrix4ComposeTRS({ 1.0f, 0.0f, 2.0f }, QuaternionFromEuler({ 0.3f, 0.5f, 0.7f }), { 1.0f, 2.0f, 3.0f }),
+		};
+		for (size_t i = 0; i < sizeof(singulars) / sizeof(singulars[0]); i++) {
+			float det = 1.0f;
+			Matrix4Inverse(singulars[i], &det);
+			if (det != 0.0f) failures++;
+
+			// 4ڂ(0,0,0,1)̂̂̓AtBϊs̋tsm߂
+			if (singulars[i].m[0][3] == 0.0f && singulars[i].m[1][3] == 0.0f && singulars[i].m[2][3] == 0.0f) {
+				det = 1.0f;
+				Matrix4AffineInverse(singulars[i], &det);
+				if (det != 0.0f) failures++;
+			}
+		}
+
+		std::fprintf(stderr, "check matrix4 inverse/normal matrix: max error %g, %d failure(s)\n", maxError, failures);
+		return failures;
+	}
+
+	// --Float3x4AFloat3x8̓ǂݍ݁A݁AKAIA1vf̌vZƃrbgPʂňv邩m߂(sԂ)-- //
+	// ǂݍ݂͑Ȃvf0ɂȂ邩A݂͔͈͊O̗vfĂȂm߂
+	template <typename V>
+	int CheckPacket(const char* name)
+	{
+		using Packet = Float3Packet<V>;
+		const int width = Packet::Width;
+		const Float3 zero(0.0f, 0.0f, 0.0f), sentinel(-7.0f, -7.0f, -7.0f);
+		Random rnd;
+		int failures = 0;
+		auto expect = [&](bool isPassed) { if (!isPassed) failures++; };
+
+		// ̔{ɂȂȂFloat3(0AƂĂAƂĂ傫̂)
+		std::vector<Float3> src(width * 4 + 3);
+		for (size_t i = 0; i < src.size(); i++) src[i] = Float3(rnd.Next(-10.0f, 10.0f), rnd.Next(-10.0f, 10.0f), rnd.Next(-10.0f, 10.0f));
+		src[1] = zero;
+		src[width + 2] = Float3(1e-20f, -2e-20f, 3e-20f);
+		src[width * 2 + 3] = Float3(1e18f, -1e18f, 5e17f);
+
+		for (size_t first = 0; first + width <= src.size(); first++) {
+			// --LoadAStore-- //
+			const Packet p = Packet::Load(src.data() + first);
+			for (int i = 0; i < width; i++) expect(SameBits(p.Get(i), src[first + i]));
+			std::vector<Float3> dst(width + 2, sentinel);
+			p.Store(dst.data() + 1);
+			for (int i = 0; i < width; i++) expect(SameBits(dst[i + 1], src[first + i]));
+			expect(SameBits(dst[0], sentinel) && SameBits(dst[width + 1], sentinel));
+
+			// --Normalize(Vector3::normalizeƓA0͂̂܂)-- //
+			const Packet n = Normalize(p);
+			for (int i = 0; i < width; i++) {
+				Vector3 v(src[first + i].x, src[first + i].y, src[first + i].z);
+				v.normalize();
+				expect(SameBits(n.Get(i), Float3(v.x, v.y, v.z)));
+			}
+
+			// --Select(r̃}XNŗvfƂɑI)-- //
+			const Packet q = Packet::Load(src.data() + src.size() - width - first % 3);
+			const V mask = p.x < q.x;
+			const Packet s = Select(mask, p, q);
+			for (int i = 0; i < width; i++) {
+				const Float3 a = p.Get(i), b = q.Get(i);
+				expect(SameBits(s.Get(i), a.x < b.x ? a : b));
+			}
+		}
+
+		// --LoadPartialAStorePartial(0`width)-- //
+		for (int count = 0; count <= width; count++) {
+			const Packet p = Packet::LoadPartial(src.data() + 2, count);
+			for (int i = 0; i < width; i++) expect(SameBits(p.Get(i), i < count ? src[2 + i] : zero));
+			std::vector<Float3> dst(width + 2, sentinel);
+			Packet::Load(src.data()).StorePartial(dst.data() + 1, count);
+			for (int i = 0; i < width + 2; i++) expect(SameBits(dst[i], i >= 1 && i <= count ? src[i - 1] : sentinel));
+		}
+
+		// --z̖܂LoadAStore(𒴂镪0ɂȂA܂Ȃ)-- //
+		for (size_t first = src.size() - width - 1; first <= src.size(); first++) {
+			const Packet p = Packet::Load(src, first);
+			for (int i = 0; i < width; i++) expect(SameBits(p.Get(i), first + i < src.size() ? src[first + i] : zero));
+			std::vector<Float3> dst(src.size(), sentinel);
+			Packet::Load(src.data()).Store(dst, first);
+			for (size_t i = 0; i < dst.size(); i++) expect(SameBits(dst[i], i >= first && i < first + width ? src[i - first] : sentinel));
+		}
+
+		// --Gather(vfxwĂ悢)AScatter(wvf)-- //
+		for (int trial = 0; trial < 64; trial++) {
+			uint32_t indices[Packet::Width];
+			for (int i = 0; i < width; i++) indices[i] = static_cast<uint32_t>(rnd.Next(0.0f, static_cast<float>(src.size()))) % src.size();
+			const Packet p = Packet::Gather(src, indices);
+			for (int i = 0; i < width; i++) expect(SameBits(p.Get(i), src[indices[i]]));
+
+			// dȂȂCfbNX(擪炸炵Ȃ1)
+			for (int i = 0; i < width; i++) indices[i] = static_cast<uint32_t>((trial + i * 2) % src.size());
+			std::vector<Float3> dst(src.size(), sentinel);
+			Packet::Load(src.data()).Scatter(dst, indices);
+			std::vector<Float3> expected(src.size(), sentinel);
+			for (int i = 0; i < width; i++) expected[indices[i]] = src[i];
+			for (size_t i = 0; i < dst.size(); i++) expect(SameBits(dst[i], expected[i]));
+		}
+
+		std::fprintf(stderr, "check %s load/store/gather/scatter/normalize/select: %d failure(s)\n", name, failures);
+		return failures;
+	}
+
+	// --̔m߂(sԂ)-- //
+	// FrustumFromMatrix̕ʂ̓OANbvWł̔(-w <= x, y <= wA0 <= z <= w)ƈv邩
+	// ܂Ƃ߂Ĕ肷CheckFrustum2Sphere(FloatV8̃rbg}XN)A1肵ʂƈv邩
+	// ̐8̔{ɂAPʍs̎ł͕ʂɂ傤ǐڂ鋅肷
+	int CheckFrustum()
+	{
+		Random rnd;
+		int failures = 0;
+		size_t insidePoints = 0, outsidePoints = 0, sphereCount = 0, visibleCount = 0;
+
+		for (int t = 0; t < 64; t++) {
+			// 0ڂ͒Pʍs(x, y}1Az0`1̔ŁAʂ̌WׂČ덷ȂɂȂ)AȊO͓e(DirectX̍nAz0`w)
+			const float nearZ = rnd.Next(0.1f, 1.0f), farZ = rnd.Next(50.0f, 1000.0f);
+			const float ys = 1.0f / std::tan(rnd.Next(0.3f, 1.2f)), xs = ys / rnd.Next(1.0f, 2.0f);
+			Matrix4 projection = {};
+			projection.m[0][0] = xs;
+			projection.m[1][1] = ys;
+			projection.m[2][2] = farZ / (farZ - nearZ);
+			projection.m[2][3] = 1.0f;
+			projection.m[3][2] = -nearZ * farZ / (farZ - nearZ);
+			const Matrix4 world = Matrix4ComposeTRS(Float3(1.0f, 1.0f, 1.0f),
+				QuaternionFromEuler({ rnd.Next(-3.0f, 3.0f), rnd.Next(-3.0f, 3.0f), rnd.Next(-3.0f, 3.0f) }),
+				{ rnd.Next(-100.0f, 100.0f), rnd.Next(-100.0f, 100.0f), rnd.Next(-100.0f, 100.0f) });
+			const bool isBox = t == 0;
+			const Matrix4 viewProjection = isBox ? Matrix4Identity() : Matrix4AffineInverse(world) * projection;
+			const Frustum frustum = FrustumFromMatrix(viewProjection);
+
+			// r[ԂŎ̏O܂ŎU炵_(PʍŝƂ͂̂܂܎g)
+			auto randomPoint = [&]() {
+				if (isBox) return Float3(rnd.Next(-1.5f, 1.5f), rnd.Next(-1.5f, 1.5f), rnd.Next(-0.5f, 1.5f));
+				const float z = rnd.Next(-0.2f, 1.2f) * farZ;
+				const float spread = z > 0.0f ? z : -z;
+				return Float3(rnd.Next(-1.3f, 1.3f) * spread / xs, rnd.Next(-1.3f, 1.3f) * spread / ys, z) * world;
+			};
+
+			// --ʂƃNbvW̓Oׂ(Ê΂̓_͊ۂߌ덷ŕς̂Ŕ΂)-- //
+			const float(*m)[4] = viewProjection.m;
+			for (int i = 0; i < 1024; i++) {
+				const Float3 p = randomPoint();
+				double clip[4];
+				for (int k = 0; k < 4; k++) clip[k] = double(p.x) * m[0][k] + double(p.y) * m[1][k] + double(p.z) * m[2][k] + m[3][k];
+				const double margins[] = { clip[3] + clip[0], clip[3] - clip[0], clip[3] + clip[1], clip[3] - clip[1], clip[2], clip[3] - clip[2] };
+				const double scale = std::fabs(clip[0]) + std::fabs(clip[1]) + std::fabs(clip[2]) + std::fabs(clip[3]);
+				double minMargin = margins[0];
+				for (double margin : margins) minMargin = margin < minMargin ? margin : minMargin;
+				if (std::fabs(minMargin) < scale * 1e-4) continue;
+
+				bool isInsidePlanes = true;
+				for (const Plane& plane : frustum.planes) isInsidePlanes = isInsidePlanes && PlaneDistance(plane, p) >= 0.0f;
+				if (isInsidePlanes != (minMargin > 0.0)) failures++;
+				(minMargin > 0.0 ? insidePoints : outsidePoints)++;
+			}
+
+			// --܂Ƃ߂Ĕ肵1肵ׂ-- //
+			std::vector<Sphere> spheres;
+			const size_t count = 1000 + t % 8;
+			for (size_t i = 0; i < count; i++) spheres.push_back({ randomPoint(), rnd.Next(0.0f, isBox ? 0.5f : 20.0f) });
+			if (isBox) {
+				// ʂɂ傤ǐڂ鋅(Ă)ƁA킸ɓ͂Ȃ(Ȃ)
+				const Sphere touching[] = {
+					{ Float3(-1.0f, 0.0f, 0.5f), 0.0f }, { Float3(1.0f, 0.5f, 0.25f), 0.0f }, { Float3(0.0f, 0.0f, 0.0f), 0.0f },
+					{ Float3(-1.5f, 0.0f, 0.5f), 0.5f }, { Float3(0.0f, 1.25f, 0.5f), 0.25f }, { Float3(0.0f, 0.0f, -0.5f), 0.5f }, { Float3(0.0f, 0.0f, 1.5f), 0.5f },
+				};
+				for (const Sphere& sphere : touching) {
+					spheres.push_back(sphere);
+					if (!CheckFrustum2Sphere(frustum, sphere)) failures++;
+					if (sphere.radius == 0.0f) continue;
+					const Sphere shortOf = { sphere.center, std::nextafter(sphere.radius, 0.0f) };
+					spheres.push_back(shortOf);
+					if (CheckFrustum2Sphere(frustum, shortOf)) failures++;
+				}
+			}
+
+			std::vector<uint32_t> visible((spheres.size() + 31) / 32, 0xffffffffu);
+			CheckFrustum2Sphere(frustum, spheres.data(), spheres.size(), visible.data());
+			for (size_t i = 0; i < visible.size() * 32; i++) {
+				const bool isBatchVisible = (visible[i / 32] >> (i % 32) & 1) != 0;
+				const bool isVisible = i < spheres.size() && CheckFrustum2Sphere(frustum, spheres[i]);// -> 𒴂rbg0
+				if (isBatchVisible != isVisible) failures++;
+				visibleCount += isVisible;
+			}
+			sphereCount += spheres.size();
+		}
+
+		// ƊO̗ĂȂΊm߂ƂɂȂȂ
+		if (insidePoints == 0 || outsidePoints == 0 || visibleCount == 0 || visibleCount == sphereCount) failures++;
+		std::fprintf(stderr, "check frustum: %zu inside / %zu outside points, %zu of %zu spheres visible, %d failure(s)\n",
+			insidePoints, outsidePoints, visibleCount, sphereCount, failures);
+		return failures;
+	}
+
+	// --Float2`Float4AVector2AVector3As̐Apx̕ϊ萔ŌvZł邩m߂(sԂ)-- //
+	// constexpr̕ϐɓ̂ŁA萔ŎgȂ΃RpCG[ɂȂAlႦΎsɎsɂȂ
+	int CheckConstexpr()
+	{
+		struct Case {
+			const char* message;// -> sƂ̃bZ[W
+			bool isPassed;
+		};
+		constexpr Case cases[] = {
+			{ "Float2萔Ŏg܂", Float2(1.0f, 2.0f).x == 1.0f },
+			{ "Float2̌Z܂", (Float2(1.0f, 2.0f) - Float2(0.5f, 0.5f)).y == 1.5f },
+			{ "Float3̉Z܂", (Float3(1.0f, 2.0f, 3.0f) + Float3(1.0f, 1.0f, 1.0f)).z == 4.0f },
+			{ "Float3̌Z܂", (Float3(1.0f, 2.0f, 3.0f) - Float3(1.0f, 1.0f, 1.0f)).z == 2.0f },
+			{ "Float3̃XJ[{܂", (2.0f * Float3(1.0f, 2.0f, 3.0f)).y == 4.0f },
+			{ "Float3̏Z܂", (Float3(1.0f, 2.0f, 4.0f) / 2.0f).z == 2.0f },
+			{ "Float3̕]܂", (-Float3(1.0f, 2.0f, 3.0f)).x == -1.0f },
+			{ "Float4̌Z܂", (Float4(1.0f, 2.0f, 3.0f, 4.0f) - Float4(1.0f, 1.0f, 1.0f, 1.0f)).w == 3.0f },
+			{ "Vector2̊Oς܂", Vector2(1.0f, 0.0f).cross(Vector2(0.0f, 1.0f)) == 1.0f },
+			{ "Vector3̓ς܂", Vector3(1.0f, 2.0f, 3.0f).dot(Vector3(4.0f, 5.0f, 6.0f)) == 32.0f },
+			{ "Vector3̊Oς܂", Vector3(1.0f, 0.0f, 0.0f).cross(Vector3(0.0f, 1.0f, 0.0f)).z == 1.0f },
+			{ "Vector3̌Z܂", (Vector3(3.0f, 2.0f, 1.0f) - Vector3(1.0f, 1.0f, 1.0f)).x == 2.0f },
+			{ "Pʍs񂪒萔Ŏg܂", Matrix4Identity().m[3][3] == 1.0f && Matrix4Identity().m[0][1] == 0.0f },
+			{ "gks񂪒萔Ŏg܂", Matrix4Scale(Float3(2.0f, 3.0f, 4.0f)).m[1][1] == 3.0f },
+			{ "sړs񂪒萔Ŏg܂", Matrix4Translate(Float3(2.0f, 3.0f, 4.0f)).m[3][2] == 4.0f },
+			{ "Degree2Radian萔Ŏg܂", Util::Degree2Radian(180.0f) == Util::PI },
+			{ "Radian2Degree萔Ŏg܂", Util::Radian2Degree(Util::PI) == 180.0f },
+		};
+
+		int failures = 0;
+		for (const Case& c : cases) {
+			if (c.isPassed) continue;
+			std::fprintf(stderr, "check constexpr: %s\n", c.message);
+			failures++;
+		}
+		std::fprintf(stderr, "check constexpr: %zu cases, %d failure(s)\n", sizeof(cases) / sizeof(cases[0]), failures);
+		return failures;
+	}
+
+	// --SinCoš덷-- //
+	struct SinCosError {
+		double ulp = 0.0;// ------> ő덷[ulp]
+		double absolute = 0.0;// -> őΌ덷
+	};
+
+	// --{x̒lreferenceɑ΂valuě덷errorɔf-- //
+	void AccumulateError(float value, double reference, SinCosError* error)
+	{
+		// ulp͐ۂ߂float̒l̈ʒuł̊Ԋu
+		float rounded = std::fabs(static_cast<float>(reference));
+		double ulp = static_cast<double>(std::nextafter(rounded, INFINITY)) - rounded;
+		double d = std::fabs(static_cast<double>(value) - reference);
+		if (!(d / ulp <= error->ulp)) error->ulp = d / ulp;// -> NaNőƂĈ
+		if (!(d <= error->absolute)) error->absolute = d;
+	}
+
+	// --SinCoš덷𑪂AExact1ulpAFastΌ덷4e-6𒴂ĂȂm߂(sԂ)-- //
+	int CheckSinCos()
+	{
+		// ͈͂ƂɈlȗ̊pxƁA/2̔{ɍł߂float(sinAcos0ɋ߂Ό덷o₷)g
+		struct Domain {
+			const char* name;
+			float limit;
+		};
+		// Fast|angle| >= 8192ExactŌvẐŁAׂĂ͈̔͂ő
+		const Domain domains[] = {
+			{ "|x|<2pi", 2.0f * Util::PI },
+			{ "|x|<8192", 8192.0f },
+			{ "|x|<2^20", 1048576.0f },
+			{ "|x|<2^24", 16777216.0f },
+		};
+
+		Random rnd;
+		int failures = 0;
+		for (const Domain& domain : domains) {
+			const size_t count = (1 << 18) + 3;// -> SIMDł̒[ʂ
+			std::vector<float> angles(count), sins(count), coss(count);
+			for (size_t i = 0; i < count; i++) {
+				if (i % 8 == 0) {
+					double multiple = std::floor(rnd.Next(0.0f, domain.limit) / (Util::PI * 0.5f));
+					angles[i] = static_cast<float>(multiple * 1.5707963267948966) * (i % 16 == 0 ? 1.0f : -1.0f);
+				}
+				else {
+					angles[i] = rnd.Next(-domain.limit, domain.limit);
+				}
+			}
+
+			for (int fast = 0; fast < 2; fast++) {
+				const Util::Precision precision = fast ? Util::Precision::Fast : Util::Precision::Exact;
+				SinCosError scalar, batch;
+
+				for (size_t i = 0; i < count; i++) {
+					Util::SinCos(angles[i], &sins[i], &coss[i], precision);
+					AccumulateError(sins[i], std::sin(static_cast<double>(angles[i])), &scalar);
+					AccumulateError(coss[i], std::cos(static_cast<double>(angles[i])), &scalar);
+				}
+				Util::SinCos(angles.data(), sins.data(), coss.data(), count, precision);
+				for (size_t i = 0; i < count; i++) {
+					AccumulateError(sins[i], std::sin(static_cast<double>(angles[i])), &batch);
+					AccumulateError(coss[i], std::cos(static_cast<double>(angles[i])), &batch);
+				}
+
+				const char* name = fast ? "fast " : "exact";
+				std::fprintf(stderr, "check sincos %s %-9s scalar: %8.3f ulp, abs %.3g / batch: %8.3f ulp, abs %.3g\n",
+					name, domain.name, scalar.ulp, scalar.absolute, batch.ulp, batch.absolute);
+				// Fast0t߂őΌ덷傫Ȃ̂ŁAUtil.hɏĂΌ덷Ŋm߂
+				if (!fast && !(scalar.ulp <= 1.0 && batch.ulp <= 1.0)) failures++;
+				if (fast && !(scalar.absolute <= 4e-6 && batch.absolute <= 4e-6)) failures++;
+			}
+		}
+
+		// --NaNAA͈͏kłȂ傫Ȓlstd::sinAstd::cosƓʂɂȂ邩([̗vfʂ)-- //
+		const float nan = std::numeric_limits<float>::quiet_NaN(), inf = std::numeric_limits<float>::infinity();
+		const float specials[] = { nan, inf, -inf, 1.0e30f, -3.0e38f, 8192.0f, -8192.5f, 1048576.0f, 0.5f, nan, 2.0e9f };
+		const size_t specialCount = sizeof(specials) / sizeof(specials[0]);
+		for (int fast = 0; fast < 2; fast++) {
+			const Util::Precision precision = fast ? Util::Precision::Fast : Util::Precision::Exact;
+			float batchSins[specialCount], batchCoss[specialCount];
+			Util::SinCos(specials, batchSins, batchCoss, specialCount, precision);
+
+			SinCosError scalar, batch;
+			int nanMismatches = 0;
+			for (size_t i = 0; i < specialCount; i++) {
+				float sin, cos;
+				Util::SinCos(specials[i], &sin, &cos, precision);
+				const double refSin = std::sin(static_cast<double>(specials[i])), refCos = std::cos(static_cast<double>(specials[i]));
+				if (std::isnan(refSin)) {
+					nanMismatches += !std::isnan(sin) + !std::isnan(cos) + !std::isnan(batchSins[i]) + !std::isnan(batchCoss[i]);
+					continue;
+				}
+				AccumulateError(sin, refSin, &scalar);
+				AccumulateError(cos, refCos, &scalar);
+				AccumulateError(batchSins[i], refSin, &batch);
+				AccumulateError(batchCoss[i], refCos, &batch);
+			}
+			std::fprintf(stderr, "check sincos %s special   scalar: %8.3f ulp, abs %.3g / batch: %8.3f ulp, abs %.3g / non-NaN for NaN input: %d\n",
+				fast ? "fast " : "exact", scalar.ulp, scalar.absolute, batch.ulp, batch.absolute, nanMismatches);
+			if (nanMismatches != 0) failures++;
+			if (!fast && !(scalar.ulp <= 1.0 && batch.ulp <= 1.0)) failures++;
+			if (fast && !(scalar.absolute <= 4e-6 && batch.absolute <= 4e-6)) failures++;
+		}
+
+		return failures;
+	}
+
+	// --JSONǂݍ(̃vOo`̂ݑΉ)-- //
+	std::vector<Result> LoadBaseline(const char* path)
+	{
+		std::vector<Result> results;
+		FILE* fp = std::fopen(path, "r");
+		if (fp == nullptr) {
+			std::fprintf(stderr, "baseline file not found: %s\n", path);
+			return results;
+		}
+
+		char line[512];
+		while (std::fgets(line, sizeof(line), fp)) {
+			char name[256];
+			unsigned long long size;
+			double ns, ops;
+			if (std::sscanf(line, " {\"name\": \"%255[^\"]\", \"size\": %llu, \"ns_per_op\": %lf, \"ops_per_sec\": %lf",
+				name, &size, &ns, &ops) == 4) {
+				results.push_back({ name, static_cast<size_t>(size), ns, ops });
+			}
+		}
+		std::fclose(fp);
+		return results;
+	}
+
+	// --ʂJSONŏo-- //
+	void WriteJson(FILE* fp, const std::vector<Result>& results)
+	{
+#if defined(FMATH_AVX)
+		const char* isa = "avx";
+#elif defined(FMATH_SSE)
+		const char* isa = "sse";
+#elif defined(FMATH_NEON)
+		const char* isa = "neon";
+#else
+		const char* isa = "scalar";
+#endif
+		std::fprintf(fp, "{\n  \"isa\": \"%s\",\n  \"results\": [\n", isa);
+		for (size_t i = 0; i < results.size(); i++) {
+			const Result& r = results[i];
+			std::fprintf(fp, "    {\"name\": \"%s\", \"size\": %zu, \"ns_per_op\": %.4f, \"ops_per_sec\": %.1f}%s\n",
+				r.name.c_str(), r.size, r.nsPerOp, r.opsPerSec, i + 1 < results.size() ? "," : "");
+		}
+		std::fprintf(fp, "  ]\n}\n");
+	}
+}
+
+int main(int argc, char* argv[])
+{
+	bool isCheckOnly = false;// ------------> ʂ̊mFs
+	const char* outPath = nullptr;// ------> ʂ̏o͐(wȂWo)
+	const char* baselinePath = nullptr;// -> r̌
+	const char* filter = nullptr;// -------> Oɂ̕܂ލڂv
+	double threshold = 5.0;// -------------> xȂƂ݂Ȃ[%]
+
+	for (int i = 1; i < argc; i++) {
+		if (std::strcmp(argv[i], "--check") == 0) isCheckOnly = true;
+		else if (std::strcmp(argv[i], "--out") == 0 && i + 1 < argc) outPath = argv[++i];
+		else if (std::strcmp(argv[i], "--baseline") == 0 && i + 1 < argc) baselinePath = argv[++i];
+		else if (std::strcmp(argv[i], "--threshold") == 0 && i + 1 < argc) threshold = std::atof(argv[++i]);
+		else if (std::strcmp(argv[i], "--filter") == 0 && i + 1 < argc) filter = argv[++i];
+		else {
+			std::fprintf(stderr, "usage: %s [--check] [--out file] [--baseline file] [--threshold percent] [--filter name]\n", argv[0]);
+			return 2;
+		}
+	}
+
+	// --ʂ̊mF(svȂ)-- //
+	int failures = CheckMatrixKernels();
+	failures += CheckMatrixInverse();
+	failures += CheckSinCos();
+	failures += CheckConstexpr();
+	failures += CheckFrustum();
+	failures += CheckPacket<FloatV4>("float3x4");
+	failures += CheckPacket<FloatV8>("float3x8");
+	if (failures > 0) return 1;
+	if (isCheckOnly) return 0;
+
+	const size_t sizes[] = { 16, 1024, 65536 };
+	std::vector<Result> results;
+
+	for (size_t size : sizes) {
+		// --̓f[^̏-- //
+		Random rnd;
+		std::vector<Matrix4> mats(size);
+		std::vector<Float3> floats(size), floatsOut(size);
+		std::vector<Vector3> vecs(size), vecsOut(size);
+		std::vector<float> angles(size), sins(size), coss(size);
+		for (size_t i = 0; i < size; i++) {
+			mats[i] = Matrix4ComposeTRS(
+				{ rnd.Next(0.5f, 2.0f), rnd.Next(0.5f, 2.0f), rnd.Next(0.5f, 2.0f) },
+				QuaternionFromEuler({ rnd.Next(-3.0f, 3.0f), rnd.Next(-3.0f, 3.0f), rnd.Next(-3.0f, 3.0f) }),
+				{ rnd.Next(-10.0f, 10.0f), rnd.Next(-10.0f, 10.0f), rnd.Next(-10.0f, 10.0f) });
+			floats[i] = Float3(rnd.Next(-10.0f, 10.0f), rnd.Next(-10.0f, 10.0f), rnd.Next(-10.0f, 10.0f));
+			vecs[i] = Vector3(floats[i].x, floats[i].y, floats[i].z);
+			angles[i] = rnd.Next(-Util::PI * 4.0f, Util::PI * 4.0f);
+		}
+		const Matrix4 mat = mats[0];
+
+		auto run = [&](const char* name, auto func) {
+			if (filter != nullptr && std::strstr(name, filter) == nullptr) return;
+			results.push_back(Measure(name, size, func));
+			std::fprintf(stderr, "%-36s %7zu %10.3f ns/op\n", name, size, results.back().nsPerOp);
+		};
+
+		// --Matrix4-- //
+		run("matrix4_multiply", [&] { Matrix4 acc = Matrix4Identity(); for (size_t i = 0; i < size; i++) acc = mats[i] * mat; Consume(acc); });
+		run("matrix4_inverse", [&] { for (size_t i = 0; i < size; i++) Consume(Matrix4Inverse(mats[i])); });
+		run("matrix4_affine_inverse", [&] { for (size_t i = 0; i < size; i++) Consume(Matrix4AffineInverse(mats[i])); });
+		run("matrix4_transform", [&] { for (size_t i = 0; i < size; i++) floatsOut[i] = Matrix4Transform(floats[i], mat); Consume(floatsOut[size - 1]); });
+		run("matrix4_transform_affine_batch", [&] { Matrix4TransformAffine(floatsOut.data(), floats.data(), size, mat); Consume(floatsOut[size - 1]); });
+		run("matrix4_transform_perspective_batch", [&] { Matrix4TransformPerspective(floatsOut.data(), floats.data(), size, mat); Consume(floatsOut[size - 1]); });
+		run("matrix4_rotate_x", [&] { for (size_t i = 0; i < size; i++) Consume(Matrix4RotateX(angles[i])); });
+		run("matrix4_rotate_y", [&] { for (size_t i = 0; i < size; i++) Consume(Matrix4RotateY(angles[i])); });
+		run("matrix4_rotate_z", [&] { for (size_t i = 0; i < size; i++) Consume(Matrix4RotateZ(angles[i])); });
+		run("matrix4_compose_trs", [&] { for (size_t i = 0; i < size; i++) Consume(Matrix4ComposeTRS(floats[i], QuaternionIdentity(), floats[i])); });
+
+		// --Vector3-- //
+		run("vector3_normalize", [&] { for (size_t i = 0; i < size; i++) { vecsOut[i] = vecs[i]; vecsOut[i].normalize(); } Consume(vecsOut[size - 1]); });
+		run("vector3_cross", [&] { for (size_t i = 1; i < size; i++) vecsOut[i] = vecs[i].cross(vecs[i - 1]); Consume(vecsOut[size - 1]); });
+		run("vector3_dot", [&] { float sum = 0.0f; for (size_t i = 1; i < size; i++) sum += vecs[i].dot(vecs[i - 1]); Consume(sum); });
+
+		// --Float3-- //
+		run("float3_add", [&] { for (size_t i = 1; i < size; i++) floatsOut[i] = floats[i] + floats[i - 1]; Consume(floatsOut[size - 1]); });
+		run("float3_scale", [&] { for (size_t i = 0; i < size; i++) floatsOut[i] = floats[i] * 0.5f; Consume(floatsOut[size - 1]); });
+
+		// --Util-- //
+		run("util_degree2radian", [&] { for (size_t i = 0; i < size; i++) sins[i] = Util::Degree2Radian(angles[i]); Consume(sins[size - 1]); });
+		run("util_sincos_exact", [&] { for (size_t i = 0; i < size; i++) Util::SinCos(angles[i], &sins[i], &coss[i]); Consume(sins[size - 1]); });
+		run("util_sincos_fast", [&] { for (size_t i = 0; i < size; i++) Util::SinCos(angles[i], &sins[i], &coss[i], Util::Precision::Fast); Consume(sins[size - 1]); });
+		run("util_sincos_exact_batch", [&] { Util::SinCos(angles.data(), sins.data(), coss.data(), size); Consume(sins[size - 1]); });
+		run("util_sincos_fast_batch", [&] { Util::SinCos(angles.data(), sins.data(), coss.data(), size, Util::Precision::Fast); Consume(sins[size - 1]); });
+	}
+
+	// --ʂ̏o-- //
+	if (outPath != nullptr) {
+		FILE* fp = std::fopen(outPath, "w");
+		if (fp == nullptr) {
+			std::fprintf(stderr, "cannot open %s\n", outPath);
+			return 2;
+		}
+		WriteJson(fp, results);
+		std::fclose(fp);
+	}
+	else {
+		WriteJson(stdout, results);
+	}
+
+	// --Ƃ̔r-- //
+	if (baselinePath == nullptr) return 0;
+
+	std::vector<Result> baseline = LoadBaseline(baselinePath);
+	int regressions = 0;
+	std::fprintf(stderr, "\n%-36s %7s %10s %10s %8s\n", "name", "size", "base", "current", "change");
+	for (const Result& r : results) {
+		for (const Result& b : baseline) {
+			if (b.name != r.name || b.size != r.size) continue;
+			double change = (r.nsPerOp - b.nsPerOp) / b.nsPerOp * 100.0;
+			bool slower = change > threshold;
+			if (slower) regressions++;
+			std::fprintf(stderr, "%-36s %7zu %10.3f %10.3f %+7.1f%%%s\n",
+				r.name.c_str(), r.size, b.nsPerOp, r.nsPerOp, change, slower ? "  <- slower" : "");
+			break;
+		}
+	}
+	std::fprintf(stderr, "%d regression(s) over %.1f%%\n", regressions, threshold);
+	return regressions > 0 ? 1 : 0;
+}
@@ -0,0 +1,340 @@
+// --bVœKƗʎq̃|[g-- //
+// GW{(FumiEngine.vcxproj)ɂ͊܂߂ȂP̂̎st@C
+// Model::LoadModelƓ菇(MeshFromObj -> MeshWeld -> MeshGenerateLods -> MeshOptimize -> MeshBuildMeshlets)OBJǂݍ݁A
+// œKO̒_LbV̓v(ACMRAATVR)ALODƂ̎Op`ƌ덷AbVbg̐AԂfƂɏo͂
+// 킹Ē_ʎq(MeshQuantizeVertexes)Ė߂Ƃ̌덷𑪂AMeshQuantize.hɏ𒴂玸s(IR[h1)ɂ
+// CfbNX̕(MeshIndexStride)MeshWriteIndexesŋl߂lm߁A65536_܂ł16bitA𒴂32bit(R32_UINT)ɂȂĂȂΎsɂ
+// TuZbg𑫂ĂLOĎ덷(f̍Wnł̋)ςȂm߂
+// bVbg_ƎOp`̏Ɏ܂A̔ŕ\̎Op`܂ނ̂̂ĂĂȂm߂
+//
+// Linuxł̃rh(|Wg̃[gŎs)
+//   g++ -std=c++14 -O2 -pthread -I. Benchmark/MeshBenchmark.cpp ObjLoader.cpp Mesh.cpp MeshOptimizer.cpp MeshQuantize.cpp MeshSimplify.cpp Meshlet.cpp -o MeshBenchmark
+//
+// g
+//   MeshBenchmark [--obj ǂݍOBJt@C(w)] [--weld _܂Ƃ߂鋖e덷] [--cache LbV̒_] [--out .json]
+//   --objw肵Ȃꍇ͋(t@CƁAOp`΂΂ɕׂ)Ōv
+#include "Meshlet.h"
+#include "MeshOptimizer.h"
+#include "MeshQuantize.h"
+#include "MeshSimplify.h"
+#include "ObjLoader.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+	// --v郂f-- //
+	struct Asset
+	{
+		std::string name;
+		MeshData mesh;
+	};
+
+	// --UṼbV-- //
+	MeshData MakeSphere(int segments, int rings)
+	{
+		MeshData mesh;
+		for (int r = 0; r <= rings; r++) {
+			for (int s = 0; s <= segments; s++) {
+				float theta = 3.14159265f * r / rings, phi = 6.28318531f * s / segments;
+				MeshVertex vertex;
+				vertex.pos = Float3(std::sin(theta) * std::cos(phi), std::cos(theta), std::sin(theta) * std::sin(phi));
+				vertex.normal = vertex.pos;
+				vertex.uv = Float2(static_cast<float>(s) / segments, static_cast<float>(r) / rings);
+				mesh.vertexes.push_back(vertex);
+			}
+		}
+		for (int r = 0; r < rings; r++) {
+			for (int s = 0; s < segments; s++) {
+				uint32_t i0 = r * (segments + 1) + s, i1 = i0 + 1, i2 = i0 + segments + 1, i3 = i2 + 1;
+				const uint32_t indexes[] = { i0, i2, i1, i1, i2, i3 };
+				mesh.indexes.insert(mesh.indexes.end(), indexes, indexes + 6);
+			}
+		}
+		return mesh;
+	}
+
+	// --ʎq̌덷-- //
+	struct QuantizeError
+	{
+		double position = 0.0;// -> W̌덷̍ől(ȇ傫ɑ΂銄)
+		double normal = 0.0;// ---> @̊px̌덷̍ől[x]
+		double uv = 0.0;// -------> UV̌덷̍ől(lɑ΂銄A2^-14̒l2^-14ɑ΂銄)
+	};
+
+	// --_ʎqĖ߂Ƃ̌덷𑪂-- //
+	QuantizeError MeasureQuantize(const MeshData& mesh)
+	{
+		MeshQuantization quantization = MeshComputeQuantization(mesh.vertexes.data(), mesh.vertexes.size());
+		std::vector<MeshQuantizedVertex> quantized(mesh.vertexes.size());
+		MeshQuantizeVertexes(mesh.vertexes.data(), mesh.vertexes.size(), quantization, quantized.data());
+
+		QuantizeError error;
+		const double scale[3] = { quantization.scale.x, quantization.scale.y, quantization.scale.z };
+		for (size_t i = 0; i < mesh.vertexes.size(); i++) {
+			const MeshVertex& a = mesh.vertexes[i];
+			const MeshVertex b = MeshDequantizeVertex(quantized[i], quantization);
+
+			const double position[3] = { std::fabs(double(b.pos.x) - a.pos.x), std::fabs(double(b.pos.y) - a.pos.y), std::fabs(double(b.pos.z) - a.pos.z) };
+			for (int k = 0; k < 3; k++) {
+				if (scale[k] > 0.0) error.position = std::max(error.position, position[k] / scale[k]);
+			}
+
+			// px͊OςƓς狁߂(acos1t߂Őx邽)
+			double length = std::sqrt(double(a.normal.x) * a.normal.x + double(a.normal.y) * a.normal.y + double(a.normal.z) * a.normal.z);
+			if (length > 0.0) {
+				double nx = a.normal.x / length, ny = a.normal.y / length, nz = a.normal.z / length;
+				double cx = b.normal.y * nz - b.normal.z * ny, cy = b.normal.z * nx - b.normal.x * nz, cz = b.normal.x * ny - b.normal.y * nx;
+				double angle = std::atan2(std::sqrt(cx * cx + cy * cy + cz * cz), b.normal.x * nx + b.normal.y * ny + b.normal.z * nz);
+				error.normal = std::max(error.normal, angle * 180.0 / 3.14159265358979);
+			}
+
+			const double minNormal = 1.0 / 16384.0;
+			error.uv = std::max(error.uv, std::fabs(double(b.uv.x) - a.uv.x) / std::max(std::fabs(double(a.uv.x)), minNormal));
+			error.uv = std::max(error.uv, std::fabs(double(b.uv.y) - a.uv.y) / std::max(std::fabs(double(a.uv.y)), minNormal));
+		}
+		return error;
+	}
+
+	// --CfbNX̕m߁AMeshWriteIndexesŋl߂̂ǂݖ߂Čƈv邩m߂-- //
+	bool CheckIndexes(const MeshData& mesh, size_t expectedStride)
+	{
+		uint32_t maxIndex = *std::max_element(mesh.indexes.begin(), mesh.indexes.end());
+		size_t stride = MeshIndexStride(mesh.vertexes.size());
+
+		// Model::CreateIndexBuff͕4oCgȂDXGI_FORMAT_R32_UINTA2oCgȂR16_UINTɂ
+		std::vector<uint8_t> buffer(mesh.indexes.size() * stride);
+		MeshWriteIndexes(buffer.data(), mesh.indexes.data(), mesh.indexes.size(), stride);
+		bool isSame = true;
+		for (size_t i = 0; i < mesh.indexes.size(); i++) {
+			uint32_t index = 0;
+			if (stride == sizeof(uint16_t)) {
+				uint16_t index16;
+				std::memcpy(&index16, buffer.data() + i * stride, sizeof(index16));
+				index = index16;
+			}
+			else {
+				std::memcpy(&index, buffer.data() + i * stride, sizeof(index));
+			}
+			isSame = isSame && index == mesh.indexes[i];
+		}
+
+		bool isPassed = stride == expectedStride && isSame;
+		std::fprintf(stderr, "check indexes: %zu vertices, max index 0x%x, stride %zu (%s), round trip %s\n",
+			mesh.vertexes.size(), maxIndex, stride, stride == sizeof(uint32_t) ? "R32_UINT" : "R16_UINT", isSame ? "ok" : "mismatch");
+		return isPassed;
+	}
+
+	// --ꂽʒuɏ̃TuZbg𑫂ĂALOD1̌덷̏ꍇƕςȂm߂-- //
+	// 덷TuZbgƂ̑傫őăfŜ̑傫Ŗ߂ƁATuZbg̕덷傫ȂĂ܂
+	bool CheckLodError()
+	{
+		const float ratios[] = { 0.5f };
+		MeshData single = MakeSphere(64, 32);
+		MeshGenerateLods(&single, ratios, 1, 0.02f);
+
+		// a0.05̋20ꂽʒuɒuāAʂ̃}eAɂ
+		MeshData multi = MakeSphere(64, 32);
+		MeshData small = MakeSphere(64, 32);
+		const uint32_t vertexBase = static_cast<uint32_t>(multi.vertexes.size());
+		const uint32_t indexBase = static_cast<uint32_t>(multi.indexes.size());
+		for (MeshVertex vertex : small.vertexes) {
+			vertex.pos = Float3(vertex.pos.x * 0.05f + 20.0f, vertex.pos.y * 0.05f, vertex.pos.z * 0.05f);
+			multi.vertexes.push_back(vertex);
+		}
+		for (uint32_t index : small.indexes) multi.indexes.push_back(index + vertexBase);
+		multi.materialNames = { "large", "small" };
+		multi.subsets = {
+			{ 0, 0, indexBase, MeshBounds{} },
+			{ 1, indexBase, static_cast<uint32_t>(small.indexes.size()), MeshBounds{} },
+		};
+		MeshGenerateLods(&multi, ratios, 1, 0.02f);
+
+		bool isPassed = single.lods.size() == 2 && multi.lods.size() == 2 && multi.lods[1].error <= single.lods[1].error * 1.01f;
+		std::fprintf(stderr, "check lod error: single subset %.4g, with small subset %.4g (%s)\n",
+			single.lods.size() > 1 ? single.lods[1].error : 0.0f, multi.lods.size() > 1 ? multi.lods[1].error : 0.0f, isPassed ? "ok" : "inflated");
+		return isPassed;
+	}
+
+	// --bVbg_ƎOp`̏Ɏ܂A̔ŕ\̎Op`̂ĂĂȂm߂-- //
+	// _̓f̎ƁA\ʂ̂O(肪ǂȂ)I
+	bool CheckMeshlets(const MeshData& mesh, const char* name)
+	{
+		Float3 min = mesh.vertexes[0].pos, max = min;
+		for (const MeshVertex& vertex : mesh.vertexes) {
+			min = Float3(std::min(min.x, vertex.pos.x), std::min(min.y, vertex.pos.y), std::min(min.z, vertex.pos.z));
+			max = Float3(std::max(max.x, vertex.pos.x), std::max(max.y, vertex.pos.y), std::max(max.z, vertex.pos.z));
+		}
+		const Float3 size(max.x - min.x, max.y - min.y, max.z - min.z);
+		const float scale = std::max(size.x, std::max(size.y, size.z));
+
+		std::mt19937 random(1);
+		std::uniform_real_distribution<float> around(-1.0f, 2.0f);
+		std::vector<Float3> eyes;
+		for (size_t i = 0; i < 100; i++) {
+			eyes.push_back(Float3(min.x + size.x * around(random), min.y + size.y * around(random), min.z + size.z * around(random)));
+		}
+		for (size_t i = 0; i < 100; i++) {
+			const MeshVertex& vertex = mesh.vertexes[random() % mesh.vertexes.size()];
+			eyes.push_back(Float3(vertex.pos.x + vertex.normal.x * scale * 0.01f, vertex.pos.y + vertex.normal.y * scale * 0.01f, vertex.pos.z + vertex.normal.z * scale * 0.01f));
+		}
+
+		size_t overLimit = 0, frontCulled = 0, culled = 0;
+		std::vector<uint32_t> stamp(mesh.vertexes.size(), 0);
+		for (size_t m = 0; m < mesh.meshlets.size(); m++) {
+			const Meshlet& meshlet = mesh.meshlets[m];
+			const uint32_t* indexes = mesh.indexes.data() + meshlet.indexStart;
+			size_t vertexCount = 0;
+			for (uint32_t i = 0; i < meshlet.indexCount; i++) {
+				if (stamp[indexes[i]] == m + 1) continue;
+				stamp[indexes[i]] = static_cast<uint32_t>(m + 1);
+				vertexCount++;
+			}
+			if (vertexCount > MeshletMaxVertices || meshlet.indexCount / 3 > MeshletMaxTriangles) overLimit++;
+
+			for (const Float3& eye : eyes) {
+				if (!MeshletIsBackfacing(meshlet, eye)) continue;
+				culled++;
+
+				// \͎vȂ̂ŁAcross(p1 - p0, p2 - p0)_̑ĂΕ\(ۂߌ덷̕]T)
+				for (uint32_t i = 0; i < meshlet.indexCount; i += 3) {
+					const Float3& p0 = mesh.vertexes[indexes[i + 0]].pos;
+					const Float3& p1 = mesh.vertexes[indexes[i + 1]].pos;
+					const Float3& p2 = mesh.vertexes[indexes[i + 2]].pos;
+					const Float3 e1(p1.x - p0.x, p1.y - p0.y, p1.z - p0.z), e2(p2.x - p0.x, p2.y - p0.y, p2.z - p0.z);
+					const Float3 normal(e1.y * e2.z - e1.z * e2.y, e1.z * e2.x - e1.x * e2.z, e1.x * e2.y - e1.y * e2.x);
+					const Float3 toEye(eye.x - p0.x, eye.y - p0.y, eye.z - p0.z);
+					const float facing = normal.x * toEye.x + normal.y * toEye.y + normal.z * toEye.z;
+					const float length = std::sqrt((normal.x * normal.x + normal.y * normal.y + normal.z * normal.z) * (toEye.x * toEye.x + toEye.y * toEye.y + toEye.z * toEye.z));
+					if (facing > length * 1e-4f) {
+						frontCulled++;
+						break;
+					}
+				}
+			}
+		}
+
+		bool isPassed = overLimit == 0 && frontCulled == 0;
+		std::fprintf(stderr, "check meshlets %s: %zu meshlets, %zu over %zu vertices or %zu triangles, %zu of %zu culled with a front-facing triangle (%s)\n",
+			name, mesh.meshlets.size(), overLimit, MeshletMaxVertices, MeshletMaxTriangles, frontCulled, culled, isPassed ? "ok" : "failed");
+		return isPassed;
+	}
+
+	// --Op`̏Ԃ΂΂ɂ-- //
+	MeshData Shuffle(const MeshData& mesh)
+	{
+		std::vector<size_t> order(mesh.indexes.size() / 3);
+		for (size_t i = 0; i < order.size(); i++) order[i] = i;
+		std::mt19937 random(1);
+		std::shuffle(order.begin(), order.end(), random);
+
+		MeshData result = mesh;
+		for (size_t i = 0; i < order.size(); i++) {
+			for (size_t k = 0; k < 3; k++) result.indexes[i * 3 + k] = mesh.indexes[order[i] * 3 + k];
+		}
+		return result;
+	}
+}
+
+int main(int argc, char* argv[])
+{
+	std::vector<std::string> objPaths;// -> ǂݍOBJt@C
+	const char* outPath = nullptr;// ----> ʂ̏o͐(wȂWo)
+	float weldEpsilon = 0.0f;// ---------> _܂Ƃ߂鋖e덷
+	size_t cacheSize = MeshCacheSize;// -> _LbV̑傫
+
+	for (int i = 1; i < argc; i++) {
+		if (std::strcmp(argv[i], "--obj") == 0 && i + 1 < argc) objPaths.push_back(argv[++i]);
+		else if (std::strcmp(argv[i], "--weld") == 0 && i + 1 < argc) weldEpsilon = static_cast<float>(std::atof(argv[++i]));
+		else if (std::strcmp(argv[i], "--cache") == 0 && i + 1 < argc) cacheSize = static_cast<size_t>(std::atoi(argv[++i]));
+		else if (std::strcmp(argv[i], "--out") == 0 && i + 1 < argc) outPath = argv[++i];
+		else {
+			std::fprintf(stderr, "usage: %s [--obj file]... [--weld epsilon] [--cache n] [--out file]\n", argv[0]);
+			return 2;
+		}
+	}
+
+	// --CfbNX̋̕ڂm߂-- //
+	// 256x256_(ő̃CfbNX0xffff)16bitA257x257_32bit
+	bool withinLimit = CheckIndexes(MakeSphere(255, 255), sizeof(uint16_t));
+	withinLimit = CheckIndexes(MakeSphere(256, 256), sizeof(uint32_t)) && withinLimit;
+	withinLimit = CheckLodError() && withinLimit;
+
+	// --v郂fpӂ-- //
+	std::vector<Asset> assets;
+	for (const std::string& path : objPaths) {
+		ObjData obj;
+		if (!LoadObj(path, &obj)) {
+			std::fprintf(stderr, "cannot load %s\n", path.c_str());
+			return 2;
+		}
+		Asset asset = { path, MeshFromObj(obj) };
+		MeshWeld(&asset.mesh, weldEpsilon);
+		assets.push_back(std::move(asset));
+	}
+	if (assets.empty()) {
+		MeshData sphere = MakeSphere(256, 128);
+		assets.push_back({ "sphere_file_order", sphere });
+		assets.push_back({ "sphere_shuffled", Shuffle(sphere) });
+	}
+
+	FILE* fp = outPath ? std::fopen(outPath, "w") : stdout;
+	if (fp == nullptr) {
+		std::fprintf(stderr, "cannot open %s\n", outPath);
+		return 2;
+	}
+
+	// ʎq̌덷̏(MeshQuantize.h̃Rg̒lAWfloat̊ۂߌ덷̕]T)
+	const double positionLimit = 1.0 / 131070.0 * 1.01;
+	const double normalLimit = 0.01;
+	const double uvLimit = 1.0 / 2048.0;
+
+	std::fprintf(fp, "{\n  \"cache_size\": %zu,\n  \"results\": [\n", cacheSize);
+	for (size_t i = 0; i < assets.size(); i++) {
+		MeshData& mesh = assets[i].mesh;
+		size_t triangles = mesh.indexes.size() / 3;
+
+		// LOD̍Model.cppƓ
+		const float lodRatios[] = { 0.5f, 0.25f, 0.125f };
+		auto lodStart = std::chrono::steady_clock::now();
+		MeshGenerateLods(&mesh, lodRatios, sizeof(lodRatios) / sizeof(lodRatios[0]), 0.02f);
+		double lodMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - lodStart).count();
+
+		auto start = std::chrono::steady_clock::now();
+		MeshOptimizeReport report = MeshOptimize(&mesh, cacheSize);
+		report.after = MeshBuildMeshlets(&mesh, cacheSize);
+		double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+		withinLimit = CheckMeshlets(mesh, assets[i].name.c_str()) && withinLimit;
+
+		// LODƂ̎Op`ƌ덷
+		std::string lods;
+		for (const MeshLod& lod : mesh.lods) {
+			size_t count = 0;
+			for (uint32_t k = 0; k < lod.subsetCount; k++) count += mesh.subsets[lod.subsetStart + k].indexCount;
+			char text[64];
+			std::snprintf(text, sizeof(text), "%s{\"triangles\": %zu, \"error\": %.4g}", lods.empty() ? "" : ", ", count / 3, lod.error);
+			lods += text;
+		}
+
+		QuantizeError error = MeasureQuantize(mesh);
+		bool within = error.position <= positionLimit && error.normal <= normalLimit && error.uv <= uvLimit;
+		withinLimit = withinLimit && within;
+
+		std::fprintf(fp, "    {\"name\": \"%s\", \"triangles\": %zu, \"vertices\": %zu, \"acmr_before\": %.3f, \"acmr_after\": %.3f, "
+			"\"atvr_before\": %.3f, \"atvr_after\": %.3f, \"clusters\": %zu, \"meshlets\": %zu, \"ms\": %.2f, \"lods\": [%s], \"lod_ms\": %.2f, "
+			"\"vertex_bytes\": %zu, \"quantized_vertex_bytes\": %zu, \"position_error\": %.3g, \"normal_error_deg\": %.3g, \"uv_error\": %.3g, \"within_error_bound\": %s}%s\n",
+			assets[i].name.c_str(), triangles, mesh.vertexes.size(), report.before.acmr, report.after.acmr,
+			report.before.atvr, report.after.atvr, report.clusterCount, mesh.meshlets.size(), ms, lods.c_str(), lodMs,
+			mesh.vertexes.size() * sizeof(MeshVertex), mesh.vertexes.size() * sizeof(MeshQuantizedVertex),
+			error.position, error.normal, error.uv, within ? "true" : "false", i + 1 < assets.size() ? "," : "");
+	}
+	std::fprintf(fp, "  ]\n}\n");
+	if (outPath) std::fclose(fp);
+	return withinLimit ? 0 : 1;
+}
@@ -0,0 +1,260 @@
+// --bV̈k(MeshCodec)̃|[g-- //
+// GW{(FumiEngine.vcxproj)ɂ͊܂߂ȂP̂̎st@C
+// Model::LoadModelƓ菇(MeshFromObj -> MeshWeld -> MeshGenerateLods -> MeshOptimize -> MeshBuildMeshlets)ŃbVA
+// LbVɏôƓ_(floatƗʎq)ƃCfbNX(16bit32bit)kāAkƓWJ̑(񂩑ԑl)o͂
+// WJʂ1oCgł玸s(IR[h1)ɂ
+//
+// Linuxł̃rh(|Wg̃[gŎs)
+//   g++ -std=c++14 -O2 -pthread -I. Benchmark/MeshCodecBenchmark.cpp ObjLoader.cpp Mesh.cpp MeshCodec.cpp MeshOptimizer.cpp MeshQuantize.cpp MeshSimplify.cpp Meshlet.cpp -o MeshCodecBenchmark
+//
+// g
+//   MeshCodecBenchmark [--obj ǂݍOBJt@C(w)] [--weld _܂Ƃ߂鋖e덷] [--runs WJ𑪂] [--out .json]
+//   --objw肵ȂꍇResources/<O>/<O>.obĵ݂̂ǂݍ
+//   ǂ̏ꍇA傫̈ႤƋN̂ObhČvɉ
+#include "MeshCodec.h"
+#include "Meshlet.h"
+#include "MeshOptimizer.h"
+#include "MeshQuantize.h"
+#include "MeshSimplify.h"
+#include "ObjLoader.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace {
+	// --v郂f-- //
+	struct Asset
+	{
+		std::string name;
+		MeshData mesh;
+	};
+
+	// --1̃f[^̌v-- //
+	struct StreamResult
+	{
+		size_t rawBytes = 0;// ------> kÕoCg
+		size_t encodedBytes = 0;// --> k̃oCg
+		double encodeMs = 0.0;// ----> kɂ
+		double decodeGBs = 0.0;// ---> WJ̑(WJ̃oCg / b)
+		bool isExact = false;// -----> Ɠɖ߂
+	};
+
+	// --UṼbV-- //
+	MeshData MakeSphere(int segments, int rings)
+	{
+		MeshData mesh;
+		for (int r = 0; r <= rings; r++) {
+			for (int s = 0; s <= segments; s++) {
+				float theta = 3.14159265f * r / rings, phi = 6.28318531f * s / segments;
+				MeshVertex vertex;
+				vertex.pos = Float3(std::sin(theta) * std::cos(phi), std::cos(theta), std::sin(theta) * std::sin(phi));
+				vertex.normal = vertex.pos;
+				vertex.uv = Float2(static_cast<float>(s) / segments, static_cast<float>(r) / rings);
+				mesh.vertexes.push_back(vertex);
+			}
+		}
+		for (int r = 0; r < rings; r++) {
+			for (int s = 0; s < segments; s++) {
+				uint32_t i0 = r * (segments + 1) + s, i1 = i0 + 1, i2 = i0 + segments + 1, i3 = i2 + 1;
+				const uint32_t indexes[] = { i0, i2, i1, i1, i2, i3 };
+				mesh.indexes.insert(mesh.indexes.end(), indexes, indexes + 6);
+			}
+		}
+		return mesh;
+	}
+
+	// --N̂Obh(n`)̃bV-- //
+	MeshData MakeGrid(int size)
+	{
+		auto height = [](float x, float z) { return 0.05f * std::sin(x * 12.9f) * std::cos(z * 7.3f) + 0.02f * std::sin((x + z) * 41.7f); };
+
+		MeshData mesh;
+		const float step = 1.0f / size, delta = step * 0.5f;
+		for (int z = 0; z <= size; z++) {
+			for (int x = 0; x <= size; x++) {
+				float fx = x * step, fz = z * step;
+				MeshVertex vertex;
+				vertex.pos = Float3(fx, height(fx, fz), fz);
+
+				// @͍̍狁߂
+				float dx = (height(fx + delta, fz) - height(fx - delta, fz)) / (delta * 2.0f);
+				float dz = (height(fx, fz + delta) - height(fx, fz - delta)) / (delta * 2.0f);
+				float length = std::sqrt(dx * dx + 1.0f + dz * dz);
+				vertex.normal = Float3(-dx / length, 1.0f / length, -dz / length);
+				vertex.uv = Float2(fx * 8.0f, fz * 8.0f);
+				mesh.vertexes.push_back(vertex);
+			}
+		}
+		for (int z = 0; z < size; z++) {
+			for (int x = 0; x < size; x++) {
+				uint32_t i0 = z * (size + 1) + x, i1 = i0 + 1, i2 = i0 + size + 1, i3 = i2 + 1;
+				const uint32_t indexes[] = { i0, i2, i1, i1, i2, i3 };
+				mesh.indexes.insert(mesh.indexes.end(), indexes, indexes + 6);
+			}
+		}
+		return mesh;
+	}
+
+	// --t@C邩-- //
+	bool Exists(const std::string& path)
+	{
+		std::ifstream file(path, std::ios::binary);
+		return file.good();
+	}
+
+	// --kƓWJ𑪂(encodedsťɒǉ֐Adecode͖߂Ԃ֐)-- //
+	template <typename Encode, typename Decode>
+	StreamResult Measure(const void* data, size_t rawBytes, int runs, Encode encode, Decode decode)
+	{
+		StreamResult result;
+		result.rawBytes = rawBytes;
+
+		std::vector<uint8_t> encoded;
+		auto start = std::chrono::steady_clock::now();
+		encode(&encoded);
+		result.encodeMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+		result.encodedBytes = encoded.size();
+
+		// ԑg(̏Ɋ荞܂ꂽ)
+		std::vector<uint8_t> decoded(rawBytes);
+		double best = 0.0;
+		bool isDecoded = true;
+		for (int i = 0; i < runs; i++) {
+			start = std::chrono::steady_clock::now();
+			isDecoded = decode(decoded.data(), encoded.data(), encoded.size()) && isDecoded;
+			double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+			if (i == 0 || seconds < best) best = seconds;
+		}
+		result.decodeGBs = best > 0.0 ? rawBytes / best * 1e-9 : 0.0;
+		result.isExact = isDecoded && std::memcmp(decoded.data(), data, rawBytes) == 0;
+		return result;
+	}
+
+	// --_𑪂-- //
+	StreamResult MeasureVertexes(const void* vertexes, size_t count, size_t stride, int runs)
+	{
+		return Measure(vertexes, count * stride, runs,
+			[&](std::vector<uint8_t>* dst) { MeshEncodeVertexes(vertexes, count, stride, dst); },
+			[&](void* dst, const uint8_t* src, size_t size) { return MeshDecodeVertexes(dst, count, stride, src, size); });
+	}
+
+	// --CfbNX𑪂-- //
+	StreamResult MeasureIndexes(const void* indexes, size_t count, size_t stride, int runs)
+	{
+		return Measure(indexes, count * stride, runs,
+			[&](std::vector<uint8_t>* dst) { MeshEncodeIndexes(indexes, count, stride, dst); },
+			[&](void* dst, const uint8_t* src, size_t size) { return MeshDecodeIndexes(dst, count, stride, src, size); });
+	}
+
+	// --vʂJSON̕ɂ-- //
+	std::string ToJson(const StreamResult& result)
+	{
+		char text[256];
+		std::snprintf(text, sizeof(text), "{\"bytes\": %zu, \"encoded_bytes\": %zu, \"ratio\": %.3f, \"encode_ms\": %.2f, \"decode_gbs\": %.3f, \"exact\": %s}",
+			result.rawBytes, result.encodedBytes, result.encodedBytes > 0 ? double(result.rawBytes) / result.encodedBytes : 0.0,
+			result.encodeMs, result.decodeGBs, result.isExact ? "true" : "false");
+		return text;
+	}
+}
+
+int main(int argc, char* argv[])
+{
+	std::vector<std::string> objPaths;// -> ǂݍOBJt@C
+	const char* outPath = nullptr;// ----> ʂ̏o͐(wȂWo)
+	float weldEpsilon = 0.0f;// ---------> _܂Ƃ߂鋖e덷
+	int runs = 10;// --------------------> WJ𑪂
+
+	for (int i = 1; i < argc; i++) {
+		if (std::strcmp(argv[i], "--obj") == 0 && i + 1 < argc) objPaths.push_back(argv[++i]);
+		else if (std::strcmp(argv[i], "--weld") == 0 && i + 1 < argc) weldEpsilon = static_cast<float>(std::atof(argv[++i]));
+		else if (std::strcmp(argv[i], "--runs") == 0 && i + 1 < argc) runs = std::max(1, std::atoi(argv[++i]));
+		else if (std::strcmp(argv[i], "--out") == 0 && i + 1 < argc) outPath = argv[++i];
+		else {
+			std::fprintf(stderr, "usage: %s [--obj file]... [--weld epsilon] [--runs n] [--out file]\n", argv[0]);
+			return 2;
+		}
+	}
+
+	// --v郂fpӂ-- //
+	if (objPaths.empty()) {
+		const char* names[] = { "cube", "sphere", "floor", "skydome", "player_rest" };
+		for (const char* name : names) {
+			std::string path = std::string("Resources/") + name + "/" + name + ".obj";
+			if (Exists(path)) objPaths.push_back(path);
+		}
+	}
+
+	std::vector<Asset> assets;
+	for (const std::string& path : objPaths) {
+		ObjData obj;
+		if (!LoadObj(path, &obj)) {
+			std::fprintf(stderr, "cannot load %s\n", path.c_str());
+			return 2;
+		}
+		Asset asset = { path, MeshFromObj(obj) };
+		MeshWeld(&asset.mesh, weldEpsilon);
+		assets.push_back(std::move(asset));
+	}
+	assets.push_back({ "sphere_64x32", MakeSphere(64, 32) });
+	assets.push_back({ "sphere_256x128", MakeSphere(256, 128) });
+	assets.push_back({ "sphere_1024x512", MakeSphere(1024, 512) });
+	assets.push_back({ "grid_512", MakeGrid(512) });
+
+	FILE* fp = outPath ? std::fopen(outPath, "w") : stdout;
+	if (fp == nullptr) {
+		std::fprintf(stderr, "cannot open %s\n", outPath);
+		return 2;
+	}
+
+	bool isExact = true;
+	std::fprintf(fp, "{\n  \"runs\": %d,\n  \"results\": [\n", runs);
+	for (size_t i = 0; i < assets.size(); i++) {
+		// bV̍Model.cppƓ
+		MeshData& mesh = assets[i].mesh;
+		const float lodRatios[] = { 0.5f, 0.25f, 0.125f };
+		MeshGenerateLods(&mesh, lodRatios, sizeof(lodRatios) / sizeof(lodRatios[0]), 0.02f);
+		MeshOptimize(&mesh);
+		MeshBuildMeshlets(&mesh);
+
+		// LbVɏôƓ`ɂ
+		MeshQuantization quantization = MeshComputeQuantization(mesh.vertexes.data(), mesh.vertexes.size());
+		std::vector<MeshQuantizedVertex> quantized(mesh.vertexes.size());
+		MeshQuantizeVertexes(mesh.vertexes.data(), mesh.vertexes.size(), quantization, quantized.data());
+
+		const size_t indexStride = MeshIndexStride(mesh.vertexes.size());
+		std::vector<uint8_t> indexes(mesh.indexes.size() * indexStride);
+		MeshWriteIndexes(indexes.data(), mesh.indexes.data(), mesh.indexes.size(), indexStride);
+
+		// WJ̑Ɣׂ邽߂́Aʂmemcpy̑
+		const size_t rawBytes = mesh.vertexes.size() * sizeof(MeshVertex);
+		std::vector<uint8_t> copy(rawBytes);
+		double best = 0.0;
+		for (int k = 0; k < runs; k++) {
+			auto start = std::chrono::steady_clock::now();
+			std::memcpy(copy.data(), mesh.vertexes.data(), rawBytes);
+			double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+			if (k == 0 || seconds < best) best = seconds;
+		}
+
+		StreamResult vertexes = MeasureVertexes(mesh.vertexes.data(), mesh.vertexes.size(), sizeof(MeshVertex), runs);
+		StreamResult quantizedVertexes = MeasureVertexes(quantized.data(), quantized.size(), sizeof(MeshQuantizedVertex), runs);
+		StreamResult packedIndexes = MeasureIndexes(indexes.data(), mesh.indexes.size(), indexStride, runs);
+		StreamResult wideIndexes = MeasureIndexes(mesh.indexes.data(), mesh.indexes.size(), sizeof(uint32_t), runs);
+		isExact = isExact && vertexes.isExact && quantizedVertexes.isExact && packedIndexes.isExact && wideIndexes.isExact;
+
+		std::fprintf(fp, "    {\"name\": \"%s\", \"triangles\": %zu, \"vertices\": %zu, \"index_stride\": %zu, \"memcpy_gbs\": %.3f,\n"
+			"     \"vertexes\": %s,\n     \"quantized_vertexes\": %s,\n     \"indexes\": %s,\n     \"indexes_32bit\": %s}%s\n",
+			assets[i].name.c_str(), mesh.indexes.size() / 3, mesh.vertexes.size(), indexStride, best > 0.0 ? rawBytes / best * 1e-9 : 0.0,
+			ToJson(vertexes).c_str(), ToJson(quantizedVertexes).c_str(), ToJson(packedIndexes).c_str(), ToJson(wideIndexes).c_str(),
+			i + 1 < assets.size() ? "," : "");
+	}
+	std::fprintf(fp, "  ]\n}\n");
+	if (outPath) std::fclose(fp);
+	return isExact ? 0 : 1;
+}
@@ -0,0 +1,300 @@
+// --OBJǂݍ݂̃x`}[N-- //
+// GW{(FumiEngine.vcxproj)ɂ͊܂߂ȂP̂̎st@C
+// ȑOModel::LoadModel(getline + istringstream)ƁAObjLoader̓ǂݍݎԂׂ
+// ObjLoader̓XbhςČvAɉ͂ʂ1Xbȟʂƈv邩mF
+// v邩́Ap`ÃCfbNXA`N܂ʁAusemtl܂OBJłmF
+//
+// Linuxł̃rh(|Wg̃[gŎs)
+//   g++ -std=c++14 -O2 -pthread -I. Benchmark/ObjBenchmark.cpp ObjLoader.cpp -o ObjBenchmark
+//
+// g
+//   ObjBenchmark [--obj ǂݍOBJt@C] [--grid ӂ̒_(1500 = 225_)] [--threads őXbh] [--out .json]
+//   --objw肵Ȃꍇ͊iq̃bVꎞt@CɏoĎg
+#include "ObjLoader.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+	// --rp̒_f[^(Vertex3DƓ)-- //
+	struct Vertex
+	{
+		Float3 pos;
+		Float3 normal;
+		Float2 uv;
+	};
+
+	// --ȑOModel::LoadModelƓǂݍݕ-- //
+	// CfbNXunsigned shortƑ傫ȃfň̂uint32_tœǂ
+	std::vector<Vertex> LoadLegacy(const std::string& path)
+	{
+		std::ifstream file(path);
+		std::vector<Float3> positions;
+		std::vector<Float3> normals;
+		std::vector<Float2> texcoords;
+		std::vector<Vertex> vertexes;
+
+		std::string line;
+		while (std::getline(file, line)) {
+			std::istringstream line_stream(line);
+			std::string key;
+			std::getline(line_stream, key, ' ');
+
+			if (key == "v") {
+				Float3 position;
+				line_stream >> position.x >> position.y >> position.z;
+				positions.emplace_back(position);
+			}
+			if (key == "vt") {
+				Float2 texcoord;
+				line_stream >> texcoord.x >> texcoord.y;
+				texcoord.y = 1.0f - texcoord.y;
+				texcoords.emplace_back(texcoord);
+			}
+			if (key == "vn") {
+				Float3 normal;
+				line_stream >> normal.x >> normal.y >> normal.z;
+				normals.emplace_back(normal);
+			}
+			if (key == "f") {
+				std::string index_string;
+				while (std::getline(line_stream, index_string, ' ')) {
+					std::istringstream index_stream(index_string);
+					uint32_t indexPosition, indexNormal, indexTexcoord;
+					index_stream >> indexPosition;
+					index_stream.seekg(1, std::ios_base::cur);
+					index_stream >> indexTexcoord;
+					index_stream.seekg(1, std::ios_base::cur);
+					index_stream >> indexNormal;
+
+					Vertex vertex;
+					vertex.pos = positions[indexPosition - 1];
+					vertex.normal = normals[indexNormal - 1];
+					vertex.uv = texcoords[indexTexcoord - 1];
+					vertexes.emplace_back(vertex);
+				}
+			}
+		}
+		return vertexes;
+	}
+
+	// --ObjLoadeřʂModel::LoadModelƓ_f[^ɂ-- //
+	std::vector<Vertex> ToVertexes(const ObjData& obj)
+	{
+		std::vector<Vertex> vertexes;
+		vertexes.reserve(obj.indices.size());
+		for (const ObjIndex& index : obj.indices) {
+			Vertex vertex;
+			vertex.pos = obj.positions[index.position];
+			if (index.normal != ObjIndex::None) vertex.normal = obj.normals[index.normal];
+			if (index.texcoord != ObjIndex::None) {
+				const Float2& texcoord = obj.texcoords[index.texcoord];
+				vertex.uv = Float2(texcoord.x, 1.0f - texcoord.y);
+			}
+			vertexes.emplace_back(vertex);
+		}
+		return vertexes;
+	}
+
+	// --z̒grbgPʂœ-- //
+	template <typename T>
+	bool SameBytes(const std::vector<T>& a, const std::vector<T>& b)
+	{
+		return a.size() == b.size() && (a.empty() || std::memcmp(a.data(), b.data(), a.size() * sizeof(T)) == 0);
+	}
+
+	// --ObjDatarbgPʂœ-- //
+	bool SameObj(const ObjData& a, const ObjData& b)
+	{
+		if (a.usemtls.size() != b.usemtls.size()) return false;
+		for (size_t i = 0; i < a.usemtls.size(); i++) {
+			if (a.usemtls[i].material != b.usemtls[i].material || a.usemtls[i].indexFirst != b.usemtls[i].indexFirst) return false;
+		}
+		return SameBytes(a.positions, b.positions) && SameBytes(a.texcoords, b.texcoords) && SameBytes(a.normals, b.normals) &&
+			SameBytes(a.indices, b.indices) && a.mtllibs == b.mtllibs;
+	}
+
+	// --ɉ͂ʂ1Xbȟʂƈv邩AiqӒn̈OBJŊm߂-- //
+	// lp`ƌ܊p`̖ʁÃCfbNXAƑO(Õ`N)̒_gʁAusemtlmtllibA
+	// 1MB(ObjLoader̃`N̍ŏTCY)̐{̑傫ɂă`N̋ڂ܂
+	bool CheckParallel()
+	{
+		std::string text = "# parallel check\nmtllib first.mtl\n";
+		const char* materials[] = { "red", "green", "blue" };
+		char line[256];
+		const int blockCount = 12000;
+		for (int b = 0; b < blockCount; b++) {
+			if (b % 37 == 0) {
+				std::snprintf(line, sizeof(line), "usemtl %s\n", materials[b / 37 % 3]);
+				text += line;
+			}
+			if (b == blockCount / 2) text += "mtllib second.mtl\n";
+
+			// p`̊(Xđp`̕Wg悤ɂ)
+			for (int k = 0; k < 8; k++) {
+				float angle = k * 0.785398f;
+				std::snprintf(line, sizeof(line), "v %f %f %f\nvt %f %f\nvn %f %f %f\n",
+					std::cos(angle) + b * 0.01f, std::sin(angle), b * 0.1f + std::cos(angle) * 0.3f, k / 8.0f, b % 100 / 100.0f, std::cos(angle), std::sin(angle), 0.0f);
+				text += line;
+			}
+
+			// ̃CfbNX̎lp`Av//vň܊p`Av̎Op`AƑO̊g(̃CfbNX)lp`
+			text += "f -8/-8/-8 -7/-7/-7 -6/-6/-6 -5/-5/-5\n";
+			text += "f -5//-5 -4//-4 -3//-3 -2//-2 -1//-1\n";
+			text += "f -1 -8 -5\n";
+			const int far = b / 2 * 8 + 1, near = b * 8 + 1;
+			std::snprintf(line, sizeof(line), "f %d/%d %d/%d %d/%d %d/%d\n", far, far, far + 3, far + 3, near + 6, near + 6, near + 7, near + 7);
+			text += line;
+		}
+
+		ObjData serial;
+		bool isPassed = ParseObj(text.data(), text.data() + text.size(), &serial, 1) && serial.usemtls.size() > 3 && serial.mtllibs.size() == 2;
+		const unsigned threadCounts[] = { 2, 3, 4, 7, 8 };
+		for (unsigned threads : threadCounts) {
+			ObjData parallel;
+			bool isSame = ParseObj(text.data(), text.data() + text.size(), &parallel, threads) && SameObj(serial, parallel);
+			std::fprintf(stderr, "check parallel: %.1f MB, %u threads, %zu indices, %zu usemtls (%s)\n",
+				text.size() / (1024.0 * 1024.0), threads, parallel.indices.size(), parallel.usemtls.size(), isSame ? "ok" : "mismatch");
+			isPassed = isPassed && isSame;
+		}
+		return isPassed;
+	}
+
+	// --iq̃bV(gł)OBJŏo-- //
+	bool WriteGrid(const std::string& path, int n)
+	{
+		FILE* fp = std::fopen(path.c_str(), "w");
+		if (fp == nullptr) return false;
+
+		for (int z = 0; z < n; z++) {
+			for (int x = 0; x < n; x++) {
+				float fx = x * 0.1f, fz = z * 0.1f;
+				std::fprintf(fp, "v %f %f %f\n", fx, std::sin(fx) * std::cos(fz), fz);
+			}
+		}
+		for (int z = 0; z < n; z++) {
+			for (int x = 0; x < n; x++) {
+				std::fprintf(fp, "vt %f %f\n", x / float(n - 1), z / float(n - 1));
+			}
+		}
+		for (int z = 0; z < n; z++) {
+			for (int x = 0; x < n; x++) {
+				std::fprintf(fp, "vn %f %f %f\n", -0.3f + x % 7 * 0.1f, 0.8f, -0.3f + z % 5 * 0.1f);
+			}
+		}
+		for (int z = 0; z + 1 < n; z++) {
+			for (int x = 0; x + 1 < n; x++) {
+				int i0 = z * n + x + 1, i1 = i0 + 1, i2 = i0 + n, i3 = i2 + 1;
+				std::fprintf(fp, "f %d/%d/%d %d/%d/%d %d/%d/%d\n", i0, i0, i0, i2, i2, i2, i1, i1, i1);
+				std::fprintf(fp, "f %d/%d/%d %d/%d/%d %d/%d/%d\n", i1, i1, i1, i2, i2, i2, i3, i3, i3);
+			}
+		}
+		std::fclose(fp);
+		return true;
+	}
+
+	// --֐̎s[ms]v-- //
+	template <typename Func>
+	double MeasureMs(Func func)
+	{
+		auto start = std::chrono::steady_clock::now();
+		func();
+		return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+	}
+}
+
+int main(int argc, char* argv[])
+{
+	std::string objPath;// ----------> ǂݍOBJt@C
+	const char* outPath = nullptr;// -> ʂ̏o͐(wȂWo)
+	int grid = 1500;// --------------> iq̈ӂ̒_
+	unsigned maxThreads = std::max(1u, std::thread::hardware_concurrency());// -> vőXbh
+
+	for (int i = 1; i < argc; i++) {
+		if (std::strcmp(argv[i], "--obj") == 0 && i + 1 < argc) objPath = argv[++i];
+		else if (std::strcmp(argv[i], "--grid") == 0 && i + 1 < argc) grid = std::atoi(argv[++i]);
+		else if (std::strcmp(argv[i], "--threads") == 0 && i + 1 < argc) maxThreads = static_cast<unsigned>(std::atoi(argv[++i]));
+		else if (std::strcmp(argv[i], "--out") == 0 && i + 1 < argc) outPath = argv[++i];
+		else {
+			std::fprintf(stderr, "usage: %s [--obj file] [--grid n] [--threads n] [--out file]\n", argv[0]);
+			return 2;
+		}
+	}
+
+	bool generated = objPath.empty();
+	if (generated) {
+		objPath = "ObjBenchmark_grid.obj";
+		std::fprintf(stderr, "writing %s (%d x %d vertices)...\n", objPath.c_str(), grid, grid);
+		if (!WriteGrid(objPath, grid)) {
+			std::fprintf(stderr, "cannot write %s\n", objPath.c_str());
+			return 2;
+		}
+	}
+
+	std::ifstream probe(objPath, std::ios::binary | std::ios::ate);
+	double fileMB = static_cast<double>(probe.tellg()) / (1024.0 * 1024.0);
+	probe.close();
+
+	// --ȑO̓ǂݍݕ-- //
+	std::fprintf(stderr, "legacy loader...\n");
+	std::vector<Vertex> legacy;
+	double legacyMs = MeasureMs([&] { legacy = LoadLegacy(objPath); });
+
+	// --ObjLoader(1Xbh)-- //
+	ObjData serial;
+	double serialMs = 1.0e300;
+	for (int trial = 0; trial < 2; trial++) {
+		serial = ObjData();
+		serialMs = std::fmin(serialMs, MeasureMs([&] { LoadObj(objPath, &serial, 1); }));
+	}
+	bool identical = SameBytes(legacy, ToVertexes(serial)) && CheckParallel();
+	legacy = std::vector<Vertex>();
+
+	// --ObjLoader(Xbh)-- //
+	struct Run { unsigned threads; double ms; bool identical; };
+	std::vector<Run> runs;
+	for (unsigned threads = 2; ; threads *= 2) {
+		if (threads > maxThreads) threads = maxThreads;
+		if (threads <= 1) break;
+
+		ObjData parallel;
+		double ms = 1.0e300;
+		for (int trial = 0; trial < 2; trial++) {
+			parallel = ObjData();
+			ms = std::fmin(ms, MeasureMs([&] { LoadObj(objPath, &parallel, threads); }));
+		}
+		runs.push_back({ threads, ms, SameObj(serial, parallel) });
+		identical = identical && runs.back().identical;
+		if (threads == maxThreads) break;
+	}
+
+	FILE* fp = outPath ? std::fopen(outPath, "w") : stdout;
+	if (fp == nullptr) {
+		std::fprintf(stderr, "cannot open %s\n", outPath);
+		return 2;
+	}
+	std::fprintf(fp, "{\n  \"file\": \"%s\",\n  \"file_mb\": %.2f,\n  \"vertices\": %zu,\n  \"identical\": %s,\n  \"results\": [\n",
+		objPath.c_str(), fileMB, serial.indices.size(), identical ? "true" : "false");
+	std::fprintf(fp, "    {\"name\": \"obj_legacy_istringstream\", \"threads\": 1, \"ms\": %.2f, \"mb_per_sec\": %.1f, \"speedup\": 1.00},\n",
+		legacyMs, fileMB / legacyMs * 1000.0);
+	std::fprintf(fp, "    {\"name\": \"obj_loader\", \"threads\": 1, \"ms\": %.2f, \"mb_per_sec\": %.1f, \"speedup\": %.2f}%s\n",
+		serialMs, fileMB / serialMs * 1000.0, legacyMs / serialMs, runs.empty() ? "" : ",");
+	for (size_t i = 0; i < runs.size(); i++) {
+		std::fprintf(fp, "    {\"name\": \"obj_loader\", \"threads\": %u, \"ms\": %.2f, \"mb_per_sec\": %.1f, \"speedup\": %.2f}%s\n",
+			runs[i].threads, runs[i].ms, fileMB / runs[i].ms * 1000.0, legacyMs / runs[i].ms, i + 1 < runs.size() ? "," : "");
+	}
+	std::fprintf(fp, "  ]\n}\n");
+	if (outPath) std::fclose(fp);
+
+	if (generated) std::remove(objPath.c_str());
+	return identical ? 0 : 1;
+}
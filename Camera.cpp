@@ -9,7 +9,8 @@ Camera::Camera() :
 	up_{ 0.0f, 1.0f, 0.0f },// -----> J̏xNg
 
 	matView_{},// -> r[ϊs
-	matProjection_{}// -> es
+	matProjection_{},// -> es
+	frustum_{}// -> 
 #pragma endregion
 {
 	// --ešvZ-- //
@@ -39,4 +40,7 @@ void Camera::Update() {
 			matView_.m[i][j] = mat.r[i].m128_f32[j];
 		}
 	}
+
+	// --̌vZ-- //
+	frustum_ = FrustumFromMatrix(matView_ * matProjection_);
 }
\ No newline at end of file
@@ -3,6 +3,7 @@
 #include <DirectXMath.h>
 using namespace DirectX;
 #include "fMath.h"
+#include "Collision.h"
 
 class Camera {
 public:
@@ -13,6 +14,7 @@ public:
 private:
 	Matrix4 matView_;// -> r[ϊs
 	Matrix4 matProjection_;// -> es
+	Frustum frustum_;// -> ([hW)
 
 public:
 	/// <summary>
@@ -29,5 +31,8 @@ public:
 	// r[s̎擾
 	inline const Matrix4& GetMatView() { return matView_; }
 	inline const Matrix4& GetMatProjection() { return matProjection_; }
+
+	// ̎擾(Update()ōXV)
+	inline const Frustum& GetFrustum() { return frustum_; }
 #pragma endregion
 };
\ No newline at end of file
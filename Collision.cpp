@@ -0,0 +1,200 @@
+#include "Collision.h"
+#include "FloatV.h"
+#include <cmath>
+
+namespace {
+	// --ʂ̌W(a, b, c, d)𐳋KPlaneɂ-- //
+	Plane MakePlane(float a, float b, float c, float d) {
+		float len = std::sqrt(a * a + b * b + c * c);
+		Plane plane;
+		plane.normal = Float3(a / len, b / len, c / len);
+		plane.distance = -d / len;
+		return plane;
+	}
+
+	// --1ubN̔茋ʂrbgɏ-- //
+	void WriteMask(uint32_t* visible, size_t first, int bits) {
+		uint32_t& word = visible[first / 32];
+		int shift = static_cast<int>(first % 32);
+		if (shift == 0) word = 0;
+		word |= static_cast<uint32_t>(bits) << shift;
+	}
+
+	// --̕ʂWX^ɓWJ-- //
+	struct FrustumV
+	{
+		FloatV8 nx[Frustum::PlaneNum];// -> @x
+		FloatV8 ny[Frustum::PlaneNum];// -> @y
+		FloatV8 nz[Frustum::PlaneNum];// -> @z
+		FloatV8 ax[Frustum::PlaneNum];// -> @x̐Βl
+		FloatV8 ay[Frustum::PlaneNum];// -> @y̐Βl
+		FloatV8 az[Frustum::PlaneNum];// -> @z̐Βl
+		FloatV8 d[Frustum::PlaneNum];// --> _̋
+
+		explicit FrustumV(const Frustum& frustum) {
+			for (int i = 0; i < Frustum::PlaneNum; i++) {
+				const Plane& p = frustum.planes[i];
+				nx[i] = p.normal.x;
+				ny[i] = p.normal.y;
+				nz[i] = p.normal.z;
+				ax[i] = std::fabs(p.normal.x);
+				ay[i] = std::fabs(p.normal.y);
+				az[i] = std::fabs(p.normal.z);
+				d[i] = p.distance;
+			}
+		}
+	};
+}
+
+// --AABBsŕϊ̂͂AABB߂-- //
+AABB AABBTransform(const AABB& box, const Matrix4& m)
+{
+	// SϊȂ傫͍s̊evf̐ΒlōL
+	const float c[3] = { (box.min.x + box.max.x) * 0.5f, (box.min.y + box.max.y) * 0.5f, (box.min.z + box.max.z) * 0.5f };
+	const float e[3] = { (box.max.x - box.min.x) * 0.5f, (box.max.y - box.min.y) * 0.5f, (box.max.z - box.min.z) * 0.5f };
+	float center[3], extent[3];
+	for (int j = 0; j < 3; j++) {
+		center[j] = m.m[3][j];
+		extent[j] = 0.0f;
+		for (int i = 0; i < 3; i++) {
+			center[j] += c[i] * m.m[i][j];
+			extent[j] += e[i] * std::fabs(m.m[i][j]);
+		}
+	}
+	AABB result;
+	result.min = Float3(center[0] - extent[0], center[1] - extent[1], center[2] - extent[2]);
+	result.max = Float3(center[0] + extent[0], center[1] + extent[1], center[2] + extent[2]);
+	return result;
+}
+
+// --sŕϊ̂͂ދ߂-- //
+Sphere SphereTransform(const Sphere& sphere, const Matrix4& m)
+{
+	// sƂ̒e̊g嗦
+	float scaleSq = 0.0f;
+	for (int i = 0; i < 3; i++) {
+		float lengthSq = m.m[i][0] * m.m[i][0] + m.m[i][1] * m.m[i][1] + m.m[i][2] * m.m[i][2];
+		if (lengthSq > scaleSq) scaleSq = lengthSq;
+	}
+	Sphere result;
+	result.center = Float3(
+		sphere.center.x * m.m[0][0] + sphere.center.y * m.m[1][0] + sphere.center.z * m.m[2][0] + m.m[3][0],
+		sphere.center.x * m.m[0][1] + sphere.center.y * m.m[1][1] + sphere.center.z * m.m[2][1] + m.m[3][1],
+		sphere.center.x * m.m[0][2] + sphere.center.y * m.m[1][2] + sphere.center.z * m.m[2][2] + m.m[3][2]);
+	result.radius = sphere.radius * std::sqrt(scaleSq);
+	return result;
+}
+
+// --r[s * vWFNVs񂩂王߂-- //
+Frustum FrustumFromMatrix(const Matrix4& viewProjection)
+{
+	// sxNgȂ̂ŃNbvW̊e͍s̗Ƃ̓ςɂȂ
+	const float(*m)[4] = viewProjection.m;
+	Frustum frustum;
+	frustum.planes[Frustum::Left] = MakePlane(m[0][3] + m[0][0], m[1][3] + m[1][0], m[2][3] + m[2][0], m[3][3] + m[3][0]);// -> -w <= x
+	frustum.planes[Frustum::Right] = MakePlane(m[0][3] - m[0][0], m[1][3] - m[1][0], m[2][3] - m[2][0], m[3][3] - m[3][0]);// -> x <= w
+	frustum.planes[Frustum::Bottom] = MakePlane(m[0][3] + m[0][1], m[1][3] + m[1][1], m[2][3] + m[2][1], m[3][3] + m[3][1]);// -> -w <= y
+	frustum.planes[Frustum::Top] = MakePlane(m[0][3] - m[0][1], m[1][3] - m[1][1], m[2][3] - m[2][1], m[3][3] - m[3][1]);// -> y <= w
+	frustum.planes[Frustum::Near] = MakePlane(m[0][2], m[1][2], m[2][2], m[3][2]);// -> 0 <= z
+	frustum.planes[Frustum::Far] = MakePlane(m[0][3] - m[0][2], m[1][3] - m[1][2], m[2][3] - m[2][2], m[3][3] - m[3][2]);// -> z <= w
+	return frustum;
+}
+
+// --_ƕʂ̕t߂-- //
+float PlaneDistance(const Plane& plane, const Float3& point)
+{
+	return plane.normal.x * point.x + plane.normal.y * point.y + plane.normal.z * point.z - plane.distance;
+}
+
+// --AABB̔-- //
+bool CheckFrustum2AABB(const Frustum& frustum, const AABB& box)
+{
+	Float3 center = (box.min + box.max) * 0.5f;
+	Float3 extent = (box.max - box.min) * 0.5f;
+
+	for (const Plane& plane : frustum.planes) {
+		// S畽ʕֈԉ_܂ł̋
+		float r = std::fabs(plane.normal.x) * extent.x + std::fabs(plane.normal.y) * extent.y + std::fabs(plane.normal.z) * extent.z;
+		if (PlaneDistance(plane, center) < -r) return false;
+	}
+	return true;
+}
+
+// --Ƌ̔-- //
+bool CheckFrustum2Sphere(const Frustum& frustum, const Sphere& sphere)
+{
+	for (const Plane& plane : frustum.planes) {
+		if (PlaneDistance(plane, sphere.center) < -sphere.radius) return false;
+	}
+	return true;
+}
+
+// --ƕAABB܂Ƃ߂Ĕ肷-- //
+void CheckFrustum2AABB(const Frustum& frustum, const AABB* boxes, size_t count, uint32_t* visible)
+{
+	const FrustumV f(frustum);
+	const int width = FloatV8::Width;
+
+	for (size_t first = 0; first < count; first += width) {
+		size_t n = count - first < width ? count - first : width;
+
+		// SƔ̑傫SoAɕבւ
+		float tmp[6][FloatV8::Width] = {};
+		for (size_t i = 0; i < n; i++) {
+			const AABB& box = boxes[first + i];
+			Float3 center = (box.min + box.max) * 0.5f;
+			Float3 extent = (box.max - box.min) * 0.5f;
+			tmp[0][i] = center.x;
+			tmp[1][i] = center.y;
+			tmp[2][i] = center.z;
+			tmp[3][i] = extent.x;
+			tmp[4][i] = extent.y;
+			tmp[5][i] = extent.z;
+		}
+		FloatV8 cx = FloatV8::Load(tmp[0]), cy = FloatV8::Load(tmp[1]), cz = FloatV8::Load(tmp[2]);
+		FloatV8 ex = FloatV8::Load(tmp[3]), ey = FloatV8::Load(tmp[4]), ez = FloatV8::Load(tmp[5]);
+
+		// ǂꂩ1̕ʂ̊SɗɂΌȂ
+		FloatV8 outside(0.0f);
+		for (int i = 0; i < Frustum::PlaneNum; i++) {
+			FloatV8 s = f.nx[i] * cx + f.ny[i] * cy + f.nz[i] * cz - f.d[i];
+			FloatV8 r = f.ax[i] * ex + f.ay[i] * ey + f.az[i] * ez;
+			outside = outside | (s < -r);
+		}
+
+		int bits = ~outside.MoveMask() & ((1 << n) - 1);
+		WriteMask(visible, first, bits);
+	}
+}
+
+// --ƕ̋܂Ƃ߂Ĕ肷-- //
+void CheckFrustum2Sphere(const Frustum& frustum, const Sphere* spheres, size_t count, uint32_t* visible)
+{
+	const FrustumV f(frustum);
+	const int width = FloatV8::Width;
+
+	for (size_t first = 0; first < count; first += width) {
+		size_t n = count - first < width ? count - first : width;
+
+		// SƔaSoAɕבւ
+		float tmp[4][FloatV8::Width] = {};
+		for (size_t i = 0; i < n; i++) {
+			const Sphere& sphere = spheres[first + i];
+			tmp[0][i] = sphere.center.x;
+			tmp[1][i] = sphere.center.y;
+			tmp[2][i] = sphere.center.z;
+			tmp[3][i] = sphere.radius;
+		}
+		FloatV8 cx = FloatV8::Load(tmp[0]), cy = FloatV8::Load(tmp[1]), cz = FloatV8::Load(tmp[2]);
+		FloatV8 r = -FloatV8::Load(tmp[3]);
+
+		FloatV8 outside(0.0f);
+		for (int i = 0; i < Frustum::PlaneNum; i++) {
+			FloatV8 s = f.nx[i] * cx + f.ny[i] * cy + f.nz[i] * cz - f.d[i];
+			outside = outside | (s < r);
+		}
+
+		int bits = ~outside.MoveMask() & ((1 << n) - 1);
+		WriteMask(visible, first, bits);
+	}
+}
@@ -0,0 +1,32 @@
+#pragma once
+#include "CollisionPrimitive.h"
+#include "Matrix4.h"
+#include <cstdint>
+#include <cstddef>
+
+// --r[s * vWFNVs񂩂王߂-- //
+// --DirectX̍s(sxNgANbvԂz0`w)OƂ-- //
+Frustum FrustumFromMatrix(const Matrix4& viewProjection);
+
+// --_ƕʂ̕t߂(\Ȃ琳)-- //
+float PlaneDistance(const Plane& plane, const Float3& point);
+
+// --AABBsŕϊ̂͂AABB߂(AtBϊ̂)-- //
+AABB AABBTransform(const AABB& box, const Matrix4& m);
+
+// --sŕϊ̂͂ދ߂(AtBϊ̂݁Aa͈ԑ傫̊g嗦|)-- //
+Sphere SphereTransform(const Sphere& sphere, const Matrix4& m);
+
+// --AABB̔(ł̒ɂtrue)-- //
+bool CheckFrustum2AABB(const Frustum& frustum, const AABB& box);
+
+// --Ƌ̔(ł̒ɂtrue)-- //
+bool CheckFrustum2Sphere(const Frustum& frustum, const Sphere& sphere);
+
+// --ƕAABB܂Ƃ߂Ĕ肷-- //
+// --visiblei / 32Ԗڂ̗vfi % 32rbgڂAboxes[i]Ă1ɂȂ-- //
+// --visibleɂ(count + 31) / 32ȏ̗vfKv-- //
+void CheckFrustum2AABB(const Frustum& frustum, const AABB* boxes, size_t count, uint32_t* visible);
+
+// --ƕ̋܂Ƃ߂Ĕ肷(visible̕тAABBłƓ)-- //
+void CheckFrustum2Sphere(const Frustum& frustum, const Sphere* spheres, size_t count, uint32_t* visible);
@@ -0,0 +1,33 @@
+#pragma once
+#include "Float3.h"
+
+// ---- //
+// dot(normal, p) - distance Ȃ\(@̌Ă鑤)
+struct Plane
+{
+	Float3 normal;// ---> @(Kς)
+	float distance;// -> _̋
+};
+
+// --sE{bNX-- //
+struct AABB
+{
+	Float3 min;// -> ŏW
+	Float3 max;// -> őW
+};
+
+// ---- //
+struct Sphere
+{
+	Float3 center;// -> SW
+	float radius;// --> a
+};
+
+// ---- //
+// eʂ̖@͎̓Ă
+struct Frustum
+{
+	enum PlaneIndex { Left, Right, Bottom, Top, Near, Far, PlaneNum };
+
+	Plane planes[PlaneNum];// -> ͂6̕
+};
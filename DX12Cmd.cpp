@@ -19,6 +19,11 @@ ComPtr<ID3D12GraphicsCommandList> DX12Cmd::commandList = nullptr;
 // --XvCgp̃pCvC-- //
 PipelineSet DX12Cmd::spritePipeline_ = { nullptr, nullptr };
 PipelineSet DX12Cmd::object3DPipeline_ = { nullptr, nullptr };
+PipelineSet DX12Cmd::object3DQuantizedPipeline_ = { nullptr, nullptr };
+PipelineSet DX12Cmd::object3DSplitPipeline_ = { nullptr, nullptr };
+PipelineSet DX12Cmd::object3DQuantizedSplitPipeline_ = { nullptr, nullptr };
+PipelineSet DX12Cmd::object3DDepthPipeline_ = { nullptr, nullptr };
+PipelineSet DX12Cmd::object3DQuantizedDepthPipeline_ = { nullptr, nullptr };
 //PipelineSet DX12Cmd::billBoardPipeline_ = { nullptr, nullptr };
 
 // --RXgN^-- //
@@ -367,10 +372,34 @@ void DX12Cmd::Initialize(WinAPI* win) {
 	// --IuWFNg3Dp̃pCvC𐶐-- //
 	object3DPipeline_ = CreateObject3DPipeline();
 
+	// --IuWFNg3Dp̃pCvC(ʎq_f[^p)𐶐-- //
+	object3DQuantizedPipeline_ = CreateObject3DPipeline(MeshVertexFormat::Quantized);
+
+	// --IuWFNg3Dp̃pCvC(WƂȊO𕪂_obt@p)𐶐-- //
+	object3DSplitPipeline_ = CreateObject3DPipeline(MeshVertexFormat::Float, Object3DVertexInput::Split);
+	object3DQuantizedSplitPipeline_ = CreateObject3DPipeline(MeshVertexFormat::Quantized, Object3DVertexInput::Split);
+
+	// --IuWFNg3Dp̐[x`悷pCvC𐶐-- //
+	object3DDepthPipeline_ = CreateObject3DPipeline(MeshVertexFormat::Float, Object3DVertexInput::DepthOnly);
+	object3DQuantizedDepthPipeline_ = CreateObject3DPipeline(MeshVertexFormat::Quantized, Object3DVertexInput::DepthOnly);
+
 	// --r{[hp̃pCvC𐶐-- //
 	//billBoardPipeline_ = CreateBillBoardPipeline();
 }
 
+PipelineSet DX12Cmd::GetObject3DPipeline(MeshVertexFormat vertexFormat, Object3DVertexInput input)
+{
+	const bool isQuantized = vertexFormat == MeshVertexFormat::Quantized;
+	switch (input) {
+	case Object3DVertexInput::Split:
+		return isQuantized ? object3DQuantizedSplitPipeline_ : object3DSplitPipeline_;
+	case Object3DVertexInput::DepthOnly:
+		return isQuantized ? object3DQuantizedDepthPipeline_ : object3DDepthPipeline_;
+	default:
+		return isQuantized ? object3DQuantizedPipeline_ : object3DPipeline_;
+	}
+}
+
 void DX12Cmd::InitializeFixFPS()
 {
 	// ݎԂL^
@@ -59,6 +59,17 @@ private:
 	// --IuWFNg3Dp̃pCvC-- //
 	static PipelineSet object3DPipeline_;
 
+	// --IuWFNg3Dp̃pCvC(ʎq_f[^p)-- //
+	static PipelineSet object3DQuantizedPipeline_;
+
+	// --IuWFNg3Dp̃pCvC(WƂȊO𕪂_obt@p)-- //
+	static PipelineSet object3DSplitPipeline_;
+	static PipelineSet object3DQuantizedSplitPipeline_;
+
+	// --IuWFNg3Dp̐[x`悷pCvC-- //
+	static PipelineSet object3DDepthPipeline_;
+	static PipelineSet object3DQuantizedDepthPipeline_;
+
 	// --r{[hp̃pCvC-- //
 	//static PipelineSet billBoardPipeline_;
 
@@ -97,6 +108,12 @@ public:
 	// --IuWFNg3Dp̃pCvC擾-- //
 	static PipelineSet GetObject3DPipeline() { return object3DPipeline_; }
 
+	// --IuWFNg3Dp̃pCvC(ʎq_f[^p)擾-- //
+	static PipelineSet GetObject3DQuantizedPipeline() { return object3DQuantizedPipeline_; }
+
+	// --_f[^̌`ƒ_obt@̎gɍIuWFNg3Dp̃pCvC擾-- //
+	static PipelineSet GetObject3DPipeline(MeshVertexFormat vertexFormat, Object3DVertexInput input);
+
 	// --r{[hp̃pCvC擾
 	//static PipelineSet GetBillBoardPipeline() { return billBoardPipeline_; }
 #pragma endregion
@@ -1,80 +0,0 @@
-#include "Float2.h"
-
-// ̃RXgN^
-Float2::Float2() : x(0.0f), y(0.0f) {}
-
-// ̃RXgN^
-Float2::Float2(float x, float y) : x(x), y(y) {}
-
-// PZq+g悤ɂ
-Float2 Float2::operator+() const
-{
-    return *this;
-}
-
-// PZq-g悤ɂ
-Float2 Float2::operator-() const
-{
-    return Float2(-x, -y);
-}
-
-// +=gpł悤ɂ
-Float2& Float2::operator+=(const Float2& f)
-{
-    x += f.x;
-    y += f.y;
-    return *this;
-}
-
-// -=gpł悤ɂ
-Float2& Float2::operator-=(const Float2& f)
-{
-    x -= f.x;
-    y -= f.y;
-    return *this;
-}
-
-// xNgs{ɂ
-Float2& Float2::operator*=(float s)
-{
-    x *= s;
-    y *= s;
-    return *this;
-}
-
-// xNg1/s{ɂ
-Float2& Float2::operator/=(float s)
-{
-    x /= s;
-    y /= s;
-    return *this;
-}
-
-const Float2 operator+(const Float2& f1, const Float2& f2)
-{
-    Float2 tmp(f1);
-    return tmp += f2;
-}
-
-const Float2 operator-(const Float2& f1, const Float2& f2)
-{
-    Float2 tmp(f1);
-    return tmp -= f2;
-}
-
-const Float2 operator*(const Float2& f, float s)
-{
-    Float2 tmp(f);
-    return tmp *= s;
-}
-
-const Float2 operator*(float s, const Float2& f)
-{
-    return f * s;
-}
-
-const Float2 operator/(const Float2& f, float s)
-{
-    Float2 tmp(f);
-    return tmp /= s;
-}
@@ -5,24 +5,97 @@ struct Float2
 	float y;// -> y
 
 	// RXgN^
-	Float2();// -----------------> Ȃ
-	Float2(float x, float y);// -> 
+	constexpr Float2();// -----------------> Ȃ
+	constexpr Float2(float x, float y);// -> 
 
 	// PZqI[o[[h
-	Float2 operator+() const;
-	Float2 operator-() const;
+	constexpr Float2 operator+() const;
+	constexpr Float2 operator-() const;
 
 	// ZqI[o[[h
-	Float2& operator+=(const Float2& f);
-	Float2& operator-=(const Float2& f);
-	Float2& operator*=(float s);
-	Float2& operator/=(float s);
+	constexpr Float2& operator+=(const Float2& f);
+	constexpr Float2& operator-=(const Float2& f);
+	constexpr Float2& operator*=(float s);
+	constexpr Float2& operator/=(float s);
 };
 
 // 2ZqI[o[[h
 // Ȉ̃p^[ɑΉ邽߁Aȉ̂悤ɏĂ
-const Float2 operator+(const Float2& f1, const Float2& f2);
-const Float2 operator-(const Float2& f1, const Float2& f2);
-const Float2 operator*(const Float2& f, float s);
-const Float2 operator*(float s, const Float2& f);
-const Float2 operator/(const Float2& f, float s);
\ No newline at end of file
+constexpr const Float2 operator+(const Float2& f1, const Float2& f2);
+constexpr const Float2 operator-(const Float2& f1, const Float2& f2);
+constexpr const Float2 operator*(const Float2& f, float s);
+constexpr const Float2 operator*(float s, const Float2& f);
+constexpr const Float2 operator/(const Float2& f, float s);
+
+// Ȃ̃RXgN^
+constexpr Float2::Float2() : x(0.0f), y(0.0f) {}
+
+// ̃RXgN^
+constexpr Float2::Float2(float x, float y) : x(x), y(y) {}
+
+constexpr Float2 Float2::operator+() const
+{
+	return *this;
+}
+
+constexpr Float2 Float2::operator-() const
+{
+	return Float2(-x, -y);
+}
+
+constexpr Float2& Float2::operator+=(const Float2& f)
+{
+	x += f.x;
+	y += f.y;
+	return *this;
+}
+
+constexpr Float2& Float2::operator-=(const Float2& f)
+{
+	x -= f.x;
+	y -= f.y;
+	return *this;
+}
+
+constexpr Float2& Float2::operator*=(float s)
+{
+	x *= s;
+	y *= s;
+	return *this;
+}
+
+constexpr Float2& Float2::operator/=(float s)
+{
+	x /= s;
+	y /= s;
+	return *this;
+}
+
+constexpr const Float2 operator+(const Float2& f1, const Float2& f2)
+{
+	Float2 tmp(f1);
+	return tmp += f2;
+}
+
+constexpr const Float2 operator-(const Float2& f1, const Float2& f2)
+{
+	Float2 tmp(f1);
+	return tmp -= f2;
+}
+
+constexpr const Float2 operator*(const Float2& f, float s)
+{
+	Float2 tmp(f);
+	return tmp *= s;
+}
+
+constexpr const Float2 operator*(float s, const Float2& f)
+{
+	return f * s;
+}
+
+constexpr const Float2 operator/(const Float2& f, float s)
+{
+	Float2 tmp(f);
+	return tmp /= s;
+}
\ No newline at end of file
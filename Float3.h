@@ -6,24 +6,101 @@ struct Float3
 	float z;// -> z
 
 	// RXgN^
-	Float3();// --------------------------> Ȃ
-	Float3(float x, float y, float z);// -> 
+	constexpr Float3();// --------------------------> Ȃ
+	constexpr Float3(float x, float y, float z);// -> 
 
 	// PZqI[o[[h
-	Float3 operator+() const;
-	Float3 operator-() const;
+	constexpr Float3 operator+() const;
+	constexpr Float3 operator-() const;
 
 	// ZqI[o[[h
-	Float3& operator+=(const Float3& f);
-	Float3& operator-=(const Float3& f);
-	Float3& operator*=(float s);
-	Float3& operator/=(float s);
+	constexpr Float3& operator+=(const Float3& f);
+	constexpr Float3& operator-=(const Float3& f);
+	constexpr Float3& operator*=(float s);
+	constexpr Float3& operator/=(float s);
 };
 
 // 2ZqI[o[[h
 // Ȉ̃p^[ɑΉ(̏)邽߁Aȉ̂悤ɏĂ
-const Float3 operator+(const Float3& f1, const Float3& f2);
-const Float3 operator-(const Float3& f1, const Float3& f2);
-const Float3 operator*(const Float3& f, float s);
-const Float3 operator*(float s, const Float3& f);
-const Float3 operator/(const Float3& f, float s);
\ No newline at end of file
+constexpr const Float3 operator+(const Float3& f1, const Float3& f2);
+constexpr const Float3 operator-(const Float3& f1, const Float3& f2);
+constexpr const Float3 operator*(const Float3& f, float s);
+constexpr const Float3 operator*(float s, const Float3& f);
+constexpr const Float3 operator/(const Float3& f, float s);
+
+// Ȃ̃RXgN^
+constexpr Float3::Float3() : x(0.0f), y(0.0f), z(0.0f) {}
+
+// ̃RXgN^
+constexpr Float3::Float3(float x, float y, float z) : x(x), y(y), z(z) {}
+
+constexpr Float3 Float3::operator+() const
+{
+	return *this;
+}
+
+constexpr Float3 Float3::operator-() const
+{
+	return Float3(-x, -y, -z);
+}
+
+constexpr Float3& Float3::operator+=(const Float3& f)
+{
+	x += f.x;
+	y += f.y;
+	z += f.z;
+	return *this;
+}
+
+constexpr Float3& Float3::operator-=(const Float3& f)
+{
+	x -= f.x;
+	y -= f.y;
+	z -= f.z;
+	return *this;
+}
+
+constexpr Float3& Float3::operator*=(float s)
+{
+	x *= s;
+	y *= s;
+	z *= s;
+	return *this;
+}
+
+constexpr Float3& Float3::operator/=(float s)
+{
+	x /= s;
+	y /= s;
+	z /= s;
+	return *this;
+}
+
+constexpr const Float3 operator+(const Float3& f1, const Float3& f2)
+{
+	Float3 tmp(f1);
+	return tmp += f2;
+}
+
+constexpr const Float3 operator-(const Float3& f1, const Float3& f2)
+{
+	Float3 tmp(f1);
+	return tmp -= f2;
+}
+
+constexpr const Float3 operator*(const Float3& f, float s)
+{
+	Float3 tmp(f);
+	return tmp *= s;
+}
+
+constexpr const Float3 operator*(float s, const Float3& f)
+{
+	return f * s;
+}
+
+constexpr const Float3 operator/(const Float3& f, float s)
+{
+	Float3 tmp(f);
+	return tmp /= s;
+}
\ No newline at end of file
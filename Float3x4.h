@@ -0,0 +1,265 @@
+#pragma once
+#include "FloatV.h"
+#include "Float3.h"
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+// --Float3𕡐܂Ƃ߂āAx, y, zƂɃWX^ׂ֕^(SoA)-- //
+// Float3x4 -> 4AFloat3x8 -> 8
+// p[eBNoEfBO{[ȂǂʂɏƂɎg
+template <typename V>
+struct Float3Packet
+{
+	static constexpr int Width = V::Width;// -> ܂Ƃ߂ĈFloat3̐
+
+	V x;// -> x
+	V y;// -> y
+	V z;// -> z
+
+	// RXgN^
+	Float3Packet() = default;// -> Ȃ
+	Float3Packet(V x, V y, V z) : x(x), y(y), z(z) {}// -> ƂɎw
+	explicit Float3Packet(const Float3& f) : x(f.x), y(f.y), z(f.z) {}// -> Svfɓlݒ
+
+	// --AFloat3Widthǂݍ-- //
+	static Float3Packet Load(const Float3* src);
+
+	// --AFloat3count(Widthȉ)ǂݍށBȂvf0ɂȂ-- //
+	static Float3Packet LoadPartial(const Float3* src, size_t count);
+
+	// --zfirstԖڂǂݍ(𒴂镪0ɂȂ)-- //
+	static Float3Packet Load(const std::vector<Float3>& src, size_t first);
+
+	// --CfbNXz(Width)wvfW߂ēǂݍ-- //
+	static Float3Packet Gather(const std::vector<Float3>& src, const uint32_t* indices);
+
+	// --AFloat3ƂWidth-- //
+	void Store(Float3* dst) const;
+
+	// --擪count(Widthȉ)-- //
+	void StorePartial(Float3* dst, size_t count) const;
+
+	// --zfirstԖڂ珑(𒴂镪͏܂Ȃ)-- //
+	void Store(std::vector<Float3>& dst, size_t first) const;
+
+	// --CfbNXz(Width)wvf֏-- //
+	void Scatter(std::vector<Float3>& dst, const uint32_t* indices) const;
+
+	// --iԖڂ̗vfo-- //
+	Float3 Get(int i) const;
+
+	// PZqI[o[[h
+	Float3Packet operator+() const { return *this; }
+	Float3Packet operator-() const { return Float3Packet(-x, -y, -z); }
+
+	// ZqI[o[[h
+	Float3Packet& operator+=(const Float3Packet& p) { x = x + p.x; y = y + p.y; z = z + p.z; return *this; }
+	Float3Packet& operator-=(const Float3Packet& p) { x = x - p.x; y = y - p.y; z = z - p.z; return *this; }
+	Float3Packet& operator*=(const Float3Packet& p) { x = x * p.x; y = y * p.y; z = z * p.z; return *this; }
+	Float3Packet& operator*=(V s) { x = x * s; y = y * s; z = z * s; return *this; }
+	Float3Packet& operator/=(V s) { x = x / s; y = y / s; z = z / s; return *this; }
+};
+
+using Float3x4 = Float3Packet<FloatV4>;
+using Float3x8 = Float3Packet<FloatV8>;
+
+// --AFloat3̓ǂݍ݁A(x, y, z̕בւWX^ōs)-- //
+template <>
+inline Float3x4 Float3x4::Load(const Float3* src) {
+#if defined(FMATH_SSE)
+	const float* p = reinterpret_cast<const float*>(src);
+	__m128 a = _mm_loadu_ps(p + 0);
+	__m128 b = _mm_loadu_ps(p + 4);
+	__m128 c = _mm_loadu_ps(p + 8);
+	__m128 x, y, z;
+	FMATH_DEINTERLEAVE3(_mm_, a, b, c, x, y, z);
+	return Float3x4(x, y, z);
+#elif defined(FMATH_NEON)
+	float32x4x3_t v = vld3q_f32(reinterpret_cast<const float*>(src));
+	return Float3x4(v.val[0], v.val[1], v.val[2]);
+#else
+	return LoadPartial(src, Width);
+#endif
+}
+
+template <>
+inline void Float3x4::Store(Float3* dst) const {
+#if defined(FMATH_SSE)
+	float* p = reinterpret_cast<float*>(dst);
+	__m128 a, b, c;
+	FMATH_INTERLEAVE3(_mm_, x.v, y.v, z.v, a, b, c);
+	_mm_storeu_ps(p + 0, a);
+	_mm_storeu_ps(p + 4, b);
+	_mm_storeu_ps(p + 8, c);
+#elif defined(FMATH_NEON)
+	float32x4x3_t v = { { x.v, y.v, z.v } };
+	vst3q_f32(reinterpret_cast<float*>(dst), v);
+#else
+	StorePartial(dst, Width);
+#endif
+}
+
+template <>
+inline Float3x8 Float3x8::Load(const Float3* src) {
+#if defined(FMATH_AVX)
+	const float* p = reinterpret_cast<const float*>(src);
+	__m256 a = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(p + 0)), _mm_loadu_ps(p + 12), 1);
+	__m256 b = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(p + 4)), _mm_loadu_ps(p + 16), 1);
+	__m256 c = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(p + 8)), _mm_loadu_ps(p + 20), 1);
+	__m256 x, y, z;
+	FMATH_DEINTERLEAVE3(_mm256_, a, b, c, x, y, z);
+	return Float3x8(x, y, z);
+#else
+	Float3x4 lo = Float3x4::Load(src);
+	Float3x4 hi = Float3x4::Load(src + 4);
+	return Float3x8(FloatV8(lo.x, hi.x), FloatV8(lo.y, hi.y), FloatV8(lo.z, hi.z));
+#endif
+}
+
+template <>
+inline void Float3x8::Store(Float3* dst) const {
+#if defined(FMATH_AVX)
+	float* p = reinterpret_cast<float*>(dst);
+	__m256 a, b, c;
+	FMATH_INTERLEAVE3(_mm256_, x.v, y.v, z.v, a, b, c);
+	_mm_storeu_ps(p + 0, _mm256_castps256_ps128(a));
+	_mm_storeu_ps(p + 4, _mm256_castps256_ps128(b));
+	_mm_storeu_ps(p + 8, _mm256_castps256_ps128(c));
+	_mm_storeu_ps(p + 12, _mm256_extractf128_ps(a, 1));
+	_mm_storeu_ps(p + 16, _mm256_extractf128_ps(b, 1));
+	_mm_storeu_ps(p + 20, _mm256_extractf128_ps(c, 1));
+#else
+	Float3x4(x.lo, y.lo, z.lo).Store(dst);
+	Float3x4(x.hi, y.hi, z.hi).Store(dst + 4);
+#endif
+}
+
+// 2ZqI[o[[h(*Float3PacketmȂ琬Ƃ̐)
+template <typename V> inline const Float3Packet<V> operator+(const Float3Packet<V>& a, const Float3Packet<V>& b) { Float3Packet<V> tmp(a); return tmp += b; }
+template <typename V> inline const Float3Packet<V> operator-(const Float3Packet<V>& a, const Float3Packet<V>& b) { Float3Packet<V> tmp(a); return tmp -= b; }
+template <typename V> inline const Float3Packet<V> operator*(const Float3Packet<V>& a, const Float3Packet<V>& b) { Float3Packet<V> tmp(a); return tmp *= b; }
+template <typename V> inline const Float3Packet<V> operator*(const Float3Packet<V>& a, V s) { Float3Packet<V> tmp(a); return tmp *= s; }
+template <typename V> inline const Float3Packet<V> operator*(V s, const Float3Packet<V>& a) { return a * s; }
+template <typename V> inline const Float3Packet<V> operator/(const Float3Packet<V>& a, V s) { Float3Packet<V> tmp(a); return tmp /= s; }
+
+// --ς߂-- //
+template <typename V>
+inline V Dot(const Float3Packet<V>& a, const Float3Packet<V>& b) {
+	return a.x * b.x + a.y * b.y + a.z * b.z;
+}
+
+// --Oς߂-- //
+template <typename V>
+inline Float3Packet<V> Cross(const Float3Packet<V>& a, const Float3Packet<V>& b) {
+	return Float3Packet<V>(a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x);
+}
+
+// --m()2߂-- //
+template <typename V>
+inline V LengthSq(const Float3Packet<V>& a) {
+	return Dot(a, a);
+}
+
+// --m()߂-- //
+template <typename V>
+inline V Length(const Float3Packet<V>& a) {
+	return Sqrt(Dot(a, a));
+}
+
+// --K(0̗vf͂̂܂܁AVector3::normalizeƓ)-- //
+template <typename V>
+inline Float3Packet<V> Normalize(const Float3Packet<V>& a) {
+	V len = Length(a);
+	V nonZero = len != V(0.0f);
+	Float3Packet<V> n = a / Select(nonZero, len, V(1.0f));
+	return n;
+}
+
+// --mask ? a : b vfƂɑI-- //
+template <typename V>
+inline Float3Packet<V> Select(V mask, const Float3Packet<V>& a, const Float3Packet<V>& b) {
+	return Float3Packet<V>(Select(mask, a.x, b.x), Select(mask, a.y, b.y), Select(mask, a.z, b.z));
+}
+
+// --Ƃ̍ŏl-- //
+template <typename V>
+inline Float3Packet<V> Min(const Float3Packet<V>& a, const Float3Packet<V>& b) {
+	return Float3Packet<V>(Min(a.x, b.x), Min(a.y, b.y), Min(a.z, b.z));
+}
+
+// --Ƃ̍ől-- //
+template <typename V>
+inline Float3Packet<V> Max(const Float3Packet<V>& a, const Float3Packet<V>& b) {
+	return Float3Packet<V>(Max(a.x, b.x), Max(a.y, b.y), Max(a.z, b.z));
+}
+
+// --ǂݍ݁A݂̒`-- //
+
+template <typename V>
+inline Float3Packet<V> Float3Packet<V>::LoadPartial(const Float3* src, size_t count) {
+	float tmp[3][Width] = {};
+	for (size_t i = 0; i < count && i < Width; i++) {
+		tmp[0][i] = src[i].x;
+		tmp[1][i] = src[i].y;
+		tmp[2][i] = src[i].z;
+	}
+	return Float3Packet(V::Load(tmp[0]), V::Load(tmp[1]), V::Load(tmp[2]));
+}
+
+template <typename V>
+inline Float3Packet<V> Float3Packet<V>::Load(const std::vector<Float3>& src, size_t first) {
+	size_t rest = first < src.size() ? src.size() - first : 0;
+	if (rest >= Width) return Load(src.data() + first);
+	return LoadPartial(src.data() + first, rest);
+}
+
+template <typename V>
+inline Float3Packet<V> Float3Packet<V>::Gather(const std::vector<Float3>& src, const uint32_t* indices) {
+	float tmp[3][Width];
+	for (int i = 0; i < Width; i++) {
+		const Float3& f = src[indices[i]];
+		tmp[0][i] = f.x;
+		tmp[1][i] = f.y;
+		tmp[2][i] = f.z;
+	}
+	return Float3Packet(V::Load(tmp[0]), V::Load(tmp[1]), V::Load(tmp[2]));
+}
+
+template <typename V>
+inline void Float3Packet<V>::StorePartial(Float3* dst, size_t count) const {
+	float tmp[3][Width];
+	x.Store(tmp[0]);
+	y.Store(tmp[1]);
+	z.Store(tmp[2]);
+	for (size_t i = 0; i < count && i < Width; i++) {
+		dst[i] = Float3(tmp[0][i], tmp[1][i], tmp[2][i]);
+	}
+}
+
+template <typename V>
+inline void Float3Packet<V>::Store(std::vector<Float3>& dst, size_t first) const {
+	size_t rest = first < dst.size() ? dst.size() - first : 0;
+	if (rest >= Width) Store(dst.data() + first);
+	else StorePartial(dst.data() + first, rest);
+}
+
+template <typename V>
+inline void Float3Packet<V>::Scatter(std::vector<Float3>& dst, const uint32_t* indices) const {
+	float tmp[3][Width];
+	x.Store(tmp[0]);
+	y.Store(tmp[1]);
+	z.Store(tmp[2]);
+	for (int i = 0; i < Width; i++) {
+		dst[indices[i]] = Float3(tmp[0][i], tmp[1][i], tmp[2][i]);
+	}
+}
+
+template <typename V>
+inline Float3 Float3Packet<V>::Get(int i) const {
+	float tmp[3][Width];
+	x.Store(tmp[0]);
+	y.Store(tmp[1]);
+	z.Store(tmp[2]);
+	return Float3(tmp[0][i], tmp[1][i], tmp[2][i]);
+}
@@ -7,24 +7,105 @@ struct Float4
 	float w;// -> w
 
 	// RXgN^
-	Float4();// -----------------------------------> Ȃ
-	Float4(float x, float y, float z, float w);// -> 
+	constexpr Float4();// -----------------------------------> Ȃ
+	constexpr Float4(float x, float y, float z, float w);// -> 
 
 	// PZqI[o[[h
-	Float4 operator+() const;
-	Float4 operator-() const;
+	constexpr Float4 operator+() const;
+	constexpr Float4 operator-() const;
 
 	// ZqI[o[[h
-	Float4& operator+=(const Float4& f);
-	Float4& operator-=(const Float4& f);
-	Float4& operator*=(float s);
-	Float4& operator/=(float s);
+	constexpr Float4& operator+=(const Float4& f);
+	constexpr Float4& operator-=(const Float4& f);
+	constexpr Float4& operator*=(float s);
+	constexpr Float4& operator/=(float s);
 };
 
 // 2ZqI[o[[h
 // Ȉ̃p^[ɑΉ(̏)邽߁Aȉ̂悤ɏĂ
-const Float4 operator+(const Float4& f1, const Float4& f2);
-const Float4 operator-(const Float4& f1, const Float4& f2);
-const Float4 operator*(const Float4& f, float s);
-const Float4 operator*(float s, const Float4& f);
-const Float4 operator/(const Float4& f, float s);
\ No newline at end of file
+constexpr const Float4 operator+(const Float4& f1, const Float4& f2);
+constexpr const Float4 operator-(const Float4& f1, const Float4& f2);
+constexpr const Float4 operator*(const Float4& f, float s);
+constexpr const Float4 operator*(float s, const Float4& f);
+constexpr const Float4 operator/(const Float4& f, float s);
+
+// Ȃ̃RXgN^
+constexpr Float4::Float4() : x(0.0f), y(0.0f), z(0.0f), w(0.0f) {}
+
+// ̃RXgN^
+constexpr Float4::Float4(float x, float y, float z, float w) : x(x), y(y), z(z), w(w) {}
+
+constexpr Float4 Float4::operator+() const
+{
+	return *this;
+}
+
+constexpr Float4 Float4::operator-() const
+{
+	return Float4(-x, -y, -z, -w);
+}
+
+constexpr Float4& Float4::operator+=(const Float4& f)
+{
+	x += f.x;
+	y += f.y;
+	z += f.z;
+	w += f.w;
+	return *this;
+}
+
+constexpr Float4& Float4::operator-=(const Float4& f)
+{
+	x -= f.x;
+	y -= f.y;
+	z -= f.z;
+	w -= f.w;
+	return *this;
+}
+
+constexpr Float4& Float4::operator*=(float s)
+{
+	x *= s;
+	y *= s;
+	z *= s;
+	w *= s;
+	return *this;
+}
+
+constexpr Float4& Float4::operator/=(float s)
+{
+	x /= s;
+	y /= s;
+	z /= s;
+	w /= s;
+	return *this;
+}
+
+constexpr const Float4 operator+(const Float4& f1, const Float4& f2)
+{
+	Float4 tmp(f1);
+	return tmp += f2;
+}
+
+constexpr const Float4 operator-(const Float4& f1, const Float4& f2)
+{
+	Float4 tmp(f1);
+	return tmp -= f2;
+}
+
+constexpr const Float4 operator*(const Float4& f, float s)
+{
+	Float4 tmp(f);
+	return tmp *= s;
+}
+
+constexpr const Float4 operator*(float s, const Float4& f)
+{
+	return f * s;
+}
+
+constexpr const Float4 operator/(const Float4& f, float s)
+{
+	Float4 tmp(f);
+	return tmp /= s;
+}
\ No newline at end of file
@@ -0,0 +1,218 @@
+#pragma once
+#include "fSIMD.h"
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+// --float1̃WX^ł܂Ƃ߂ČvZ^-- //
+// FloatV4 -> 4vf(SSE / NEON)
+// FloatV8 -> 8vf(AVXAAVXꍇFloatV42ׂ)
+// rŽʂ́A^̗vf̑Srbg1ɂȂ}XNƂē^ŕԂ
+
+struct FloatV4
+{
+	static constexpr int Width = 4;// -> vf
+
+#if defined(FMATH_SSE)
+	__m128 v;
+#elif defined(FMATH_NEON)
+	float32x4_t v;
+#else
+	float v[4];
+#endif
+
+	// RXgN^
+	FloatV4() = default;// -> Ȃ
+	FloatV4(float s);// ----> Svfsݒ
+#if defined(FMATH_SSE)
+	FloatV4(__m128 v) : v(v) {}
+#elif defined(FMATH_NEON)
+	FloatV4(float32x4_t v) : v(v) {}
+#endif
+
+	// ǂݍ݁A
+	static FloatV4 Load(const float* p);
+	void Store(float* p) const;
+
+	// }XN̊evf̍ŏʃrbgׂlԂ(vf0bit0)
+	int MoveMask() const;
+};
+
+// --FloatV4̒`-- //
+#if defined(FMATH_SSE)
+inline FloatV4::FloatV4(float s) : v(_mm_set1_ps(s)) {}
+inline FloatV4 FloatV4::Load(const float* p) { return _mm_loadu_ps(p); }
+inline void FloatV4::Store(float* p) const { _mm_storeu_ps(p, v); }
+inline int FloatV4::MoveMask() const { return _mm_movemask_ps(v); }
+
+inline FloatV4 operator+(FloatV4 a, FloatV4 b) { return _mm_add_ps(a.v, b.v); }
+inline FloatV4 operator-(FloatV4 a, FloatV4 b) { return _mm_sub_ps(a.v, b.v); }
+inline FloatV4 operator*(FloatV4 a, FloatV4 b) { return _mm_mul_ps(a.v, b.v); }
+inline FloatV4 operator/(FloatV4 a, FloatV4 b) { return _mm_div_ps(a.v, b.v); }
+inline FloatV4 operator-(FloatV4 a) { return _mm_xor_ps(a.v, _mm_set1_ps(-0.0f)); }
+inline FloatV4 operator&(FloatV4 a, FloatV4 b) { return _mm_and_ps(a.v, b.v); }
+inline FloatV4 operator|(FloatV4 a, FloatV4 b) { return _mm_or_ps(a.v, b.v); }
+inline FloatV4 operator<(FloatV4 a, FloatV4 b) { return _mm_cmplt_ps(a.v, b.v); }
+inline FloatV4 operator<=(FloatV4 a, FloatV4 b) { return _mm_cmple_ps(a.v, b.v); }
+inline FloatV4 operator>(FloatV4 a, FloatV4 b) { return _mm_cmpgt_ps(a.v, b.v); }
+inline FloatV4 operator>=(FloatV4 a, FloatV4 b) { return _mm_cmpge_ps(a.v, b.v); }
+inline FloatV4 operator==(FloatV4 a, FloatV4 b) { return _mm_cmpeq_ps(a.v, b.v); }
+inline FloatV4 operator!=(FloatV4 a, FloatV4 b) { return _mm_cmpneq_ps(a.v, b.v); }
+inline FloatV4 Min(FloatV4 a, FloatV4 b) { return _mm_min_ps(a.v, b.v); }
+inline FloatV4 Max(FloatV4 a, FloatV4 b) { return _mm_max_ps(a.v, b.v); }
+inline FloatV4 Sqrt(FloatV4 a) { return _mm_sqrt_ps(a.v); }
+inline FloatV4 Abs(FloatV4 a) { return _mm_andnot_ps(_mm_set1_ps(-0.0f), a.v); }
+// mask ? a : b
+inline FloatV4 Select(FloatV4 mask, FloatV4 a, FloatV4 b) { return _mm_or_ps(_mm_and_ps(mask.v, a.v), _mm_andnot_ps(mask.v, b.v)); }
+#elif defined(FMATH_NEON)
+inline FloatV4::FloatV4(float s) : v(vdupq_n_f32(s)) {}
+inline FloatV4 FloatV4::Load(const float* p) { return vld1q_f32(p); }
+inline void FloatV4::Store(float* p) const { vst1q_f32(p, v); }
+inline int FloatV4::MoveMask() const {
+	static const int32_t shift[4] = { 0, 1, 2, 3 };
+	uint32x4_t bits = vshlq_u32(vshrq_n_u32(vreinterpretq_u32_f32(v), 31), vld1q_s32(shift));
+	return static_cast<int>(vaddvq_u32(bits));
+}
+
+inline FloatV4 operator+(FloatV4 a, FloatV4 b) { return vaddq_f32(a.v, b.v); }
+inline FloatV4 operator-(FloatV4 a, FloatV4 b) { return vsubq_f32(a.v, b.v); }
+inline FloatV4 operator*(FloatV4 a, FloatV4 b) { return vmulq_f32(a.v, b.v); }
+inline FloatV4 operator/(FloatV4 a, FloatV4 b) { return vdivq_f32(a.v, b.v); }
+inline FloatV4 operator-(FloatV4 a) { return vnegq_f32(a.v); }
+inline FloatV4 operator&(FloatV4 a, FloatV4 b) { return vreinterpretq_f32_u32(vandq_u32(vreinterpretq_u32_f32(a.v), vreinterpretq_u32_f32(b.v))); }
+inline FloatV4 operator|(FloatV4 a, FloatV4 b) { return vreinterpretq_f32_u32(vorrq_u32(vreinterpretq_u32_f32(a.v), vreinterpretq_u32_f32(b.v))); }
+inline FloatV4 operator<(FloatV4 a, FloatV4 b) { return vreinterpretq_f32_u32(vcltq_f32(a.v, b.v)); }
+inline FloatV4 operator<=(FloatV4 a, FloatV4 b) { return vreinterpretq_f32_u32(vcleq_f32(a.v, b.v)); }
+inline FloatV4 operator>(FloatV4 a, FloatV4 b) { return vreinterpretq_f32_u32(vcgtq_f32(a.v, b.v)); }
+inline FloatV4 operator>=(FloatV4 a, FloatV4 b) { return vreinterpretq_f32_u32(vcgeq_f32(a.v, b.v)); }
+inline FloatV4 operator==(FloatV4 a, FloatV4 b) { return vreinterpretq_f32_u32(vceqq_f32(a.v, b.v)); }
+inline FloatV4 operator!=(FloatV4 a, FloatV4 b) { return vreinterpretq_f32_u32(vmvnq_u32(vceqq_f32(a.v, b.v))); }
+inline FloatV4 Min(FloatV4 a, FloatV4 b) { return vminq_f32(a.v, b.v); }
+inline FloatV4 Max(FloatV4 a, FloatV4 b) { return vmaxq_f32(a.v, b.v); }
+inline FloatV4 Sqrt(FloatV4 a) { return vsqrtq_f32(a.v); }
+inline FloatV4 Abs(FloatV4 a) { return vabsq_f32(a.v); }
+// mask ? a : b
+inline FloatV4 Select(FloatV4 mask, FloatV4 a, FloatV4 b) { return vbslq_f32(vreinterpretq_u32_f32(mask.v), a.v, b.v); }
+#else
+// --XJ[(}XN͑Srbg1floatŕ\)-- //
+namespace FloatVDetail {
+	inline float Bits(uint32_t u) { float f; std::memcpy(&f, &u, sizeof(f)); return f; }
+	inline uint32_t Bits(float f) { uint32_t u; std::memcpy(&u, &f, sizeof(u)); return u; }
+	inline float Mask(bool b) { return Bits(b ? 0xffffffffu : 0u); }
+}
+
+#define FMATH_V4_OP(expr) FloatV4 r; for (int i = 0; i < 4; i++) r.v[i] = (expr); return r;
+
+inline FloatV4::FloatV4(float s) : v{ s, s, s, s } {}
+inline FloatV4 FloatV4::Load(const float* p) { FMATH_V4_OP(p[i]) }
+inline void FloatV4::Store(float* p) const { for (int i = 0; i < 4; i++) p[i] = v[i]; }
+inline int FloatV4::MoveMask() const {
+	int bits = 0;
+	for (int i = 0; i < 4; i++) bits |= static_cast<int>(FloatVDetail::Bits(v[i]) >> 31) << i;
+	return bits;
+}
+
+inline FloatV4 operator+(FloatV4 a, FloatV4 b) { FMATH_V4_OP(a.v[i] + b.v[i]) }
+inline FloatV4 operator-(FloatV4 a, FloatV4 b) { FMATH_V4_OP(a.v[i] - b.v[i]) }
+inline FloatV4 operator*(FloatV4 a, FloatV4 b) { FMATH_V4_OP(a.v[i] * b.v[i]) }
+inline FloatV4 operator/(FloatV4 a, FloatV4 b) { FMATH_V4_OP(a.v[i] / b.v[i]) }
+inline FloatV4 operator-(FloatV4 a) { FMATH_V4_OP(-a.v[i]) }
+inline FloatV4 operator&(FloatV4 a, FloatV4 b) { FMATH_V4_OP(FloatVDetail::Bits(FloatVDetail::Bits(a.v[i]) & FloatVDetail::Bits(b.v[i]))) }
+inline FloatV4 operator|(FloatV4 a, FloatV4 b) { FMATH_V4_OP(FloatVDetail::Bits(FloatVDetail::Bits(a.v[i]) | FloatVDetail::Bits(b.v[i]))) }
+inline FloatV4 operator<(FloatV4 a, FloatV4 b) { FMATH_V4_OP(FloatVDetail::Mask(a.v[i] < b.v[i])) }
+inline FloatV4 operator<=(FloatV4 a, FloatV4 b) { FMATH_V4_OP(FloatVDetail::Mask(a.v[i] <= b.v[i])) }
+inline FloatV4 operator>(FloatV4 a, FloatV4 b) { FMATH_V4_OP(FloatVDetail::Mask(a.v[i] > b.v[i])) }
+inline FloatV4 operator>=(FloatV4 a, FloatV4 b) { FMATH_V4_OP(FloatVDetail::Mask(a.v[i] >= b.v[i])) }
+inline FloatV4 operator==(FloatV4 a, FloatV4 b) { FMATH_V4_OP(FloatVDetail::Mask(a.v[i] == b.v[i])) }
+inline FloatV4 operator!=(FloatV4 a, FloatV4 b) { FMATH_V4_OP(FloatVDetail::Mask(a.v[i] != b.v[i])) }
+inline FloatV4 Min(FloatV4 a, FloatV4 b) { FMATH_V4_OP(a.v[i] < b.v[i] ? a.v[i] : b.v[i]) }
+inline FloatV4 Max(FloatV4 a, FloatV4 b) { FMATH_V4_OP(a.v[i] > b.v[i] ? a.v[i] : b.v[i]) }
+inline FloatV4 Sqrt(FloatV4 a) { FMATH_V4_OP(std::sqrt(a.v[i])) }
+inline FloatV4 Abs(FloatV4 a) { FMATH_V4_OP(std::fabs(a.v[i])) }
+// mask ? a : b
+inline FloatV4 Select(FloatV4 mask, FloatV4 a, FloatV4 b) { FMATH_V4_OP((FloatVDetail::Bits(mask.v[i]) >> 31) ? a.v[i] : b.v[i]) }
+
+#undef FMATH_V4_OP
+#endif
+
+struct FloatV8
+{
+	static constexpr int Width = 8;// -> vf
+
+#if defined(FMATH_AVX)
+	__m256 v;
+#else
+	FloatV4 lo;// -> vf0`3
+	FloatV4 hi;// -> vf4`7
+#endif
+
+	// RXgN^
+	FloatV8() = default;// -> Ȃ
+	FloatV8(float s);// ----> Svfsݒ
+#if defined(FMATH_AVX)
+	FloatV8(__m256 v) : v(v) {}
+#else
+	FloatV8(FloatV4 lo, FloatV4 hi) : lo(lo), hi(hi) {}
+#endif
+
+	// ǂݍ݁A
+	static FloatV8 Load(const float* p);
+	void Store(float* p) const;
+
+	// }XN̊evf̍ŏʃrbgׂlԂ(vf0bit0)
+	int MoveMask() const;
+};
+
+// --FloatV8̒`-- //
+#if defined(FMATH_AVX)
+inline FloatV8::FloatV8(float s) : v(_mm256_set1_ps(s)) {}
+inline FloatV8 FloatV8::Load(const float* p) { return _mm256_loadu_ps(p); }
+inline void FloatV8::Store(float* p) const { _mm256_storeu_ps(p, v); }
+inline int FloatV8::MoveMask() const { return _mm256_movemask_ps(v); }
+
+inline FloatV8 operator+(FloatV8 a, FloatV8 b) { return _mm256_add_ps(a.v, b.v); }
+inline FloatV8 operator-(FloatV8 a, FloatV8 b) { return _mm256_sub_ps(a.v, b.v); }
+inline FloatV8 operator*(FloatV8 a, FloatV8 b) { return _mm256_mul_ps(a.v, b.v); }
+inline FloatV8 operator/(FloatV8 a, FloatV8 b) { return _mm256_div_ps(a.v, b.v); }
+inline FloatV8 operator-(FloatV8 a) { return _mm256_xor_ps(a.v, _mm256_set1_ps(-0.0f)); }
+inline FloatV8 operator&(FloatV8 a, FloatV8 b) { return _mm256_and_ps(a.v, b.v); }
+inline FloatV8 operator|(FloatV8 a, FloatV8 b) { return _mm256_or_ps(a.v, b.v); }
+inline FloatV8 operator<(FloatV8 a, FloatV8 b) { return _mm256_cmp_ps(a.v, b.v, _CMP_LT_OQ); }
+inline FloatV8 operator<=(FloatV8 a, FloatV8 b) { return _mm256_cmp_ps(a.v, b.v, _CMP_LE_OQ); }
+inline FloatV8 operator>(FloatV8 a, FloatV8 b) { return _mm256_cmp_ps(a.v, b.v, _CMP_GT_OQ); }
+inline FloatV8 operator>=(FloatV8 a, FloatV8 b) { return _mm256_cmp_ps(a.v, b.v, _CMP_GE_OQ); }
+inline FloatV8 operator==(FloatV8 a, FloatV8 b) { return _mm256_cmp_ps(a.v, b.v, _CMP_EQ_OQ); }
+inline FloatV8 operator!=(FloatV8 a, FloatV8 b) { return _mm256_cmp_ps(a.v, b.v, _CMP_NEQ_UQ); }
+inline FloatV8 Min(FloatV8 a, FloatV8 b) { return _mm256_min_ps(a.v, b.v); }
+inline FloatV8 Max(FloatV8 a, FloatV8 b) { return _mm256_max_ps(a.v, b.v); }
+inline FloatV8 Sqrt(FloatV8 a) { return _mm256_sqrt_ps(a.v); }
+inline FloatV8 Abs(FloatV8 a) { return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), a.v); }
+// mask ? a : b
+inline FloatV8 Select(FloatV8 mask, FloatV8 a, FloatV8 b) { return _mm256_blendv_ps(b.v, a.v, mask.v); }
+#else
+// --FloatV42gČvZ-- //
+inline FloatV8::FloatV8(float s) : lo(s), hi(s) {}
+inline FloatV8 FloatV8::Load(const float* p) { return FloatV8(FloatV4::Load(p), FloatV4::Load(p + 4)); }
+inline void FloatV8::Store(float* p) const { lo.Store(p); hi.Store(p + 4); }
+inline int FloatV8::MoveMask() const { return lo.MoveMask() | (hi.MoveMask() << 4); }
+
+inline FloatV8 operator+(FloatV8 a, FloatV8 b) { return FloatV8(a.lo + b.lo, a.hi + b.hi); }
+inline FloatV8 operator-(FloatV8 a, FloatV8 b) { return FloatV8(a.lo - b.lo, a.hi - b.hi); }
+inline FloatV8 operator*(FloatV8 a, FloatV8 b) { return FloatV8(a.lo * b.lo, a.hi * b.hi); }
+inline FloatV8 operator/(FloatV8 a, FloatV8 b) { return FloatV8(a.lo / b.lo, a.hi / b.hi); }
+inline FloatV8 operator-(FloatV8 a) { return FloatV8(-a.lo, -a.hi); }
+inline FloatV8 operator&(FloatV8 a, FloatV8 b) { return FloatV8(a.lo & b.lo, a.hi & b.hi); }
+inline FloatV8 operator|(FloatV8 a, FloatV8 b) { return FloatV8(a.lo | b.lo, a.hi | b.hi); }
+inline FloatV8 operator<(FloatV8 a, FloatV8 b) { return FloatV8(a.lo < b.lo, a.hi < b.hi); }
+inline FloatV8 operator<=(FloatV8 a, FloatV8 b) { return FloatV8(a.lo <= b.lo, a.hi <= b.hi); }
+inline FloatV8 operator>(FloatV8 a, FloatV8 b) { return FloatV8(a.lo > b.lo, a.hi > b.hi); }
+inline FloatV8 operator>=(FloatV8 a, FloatV8 b) { return FloatV8(a.lo >= b.lo, a.hi >= b.hi); }
+inline FloatV8 operator==(FloatV8 a, FloatV8 b) { return FloatV8(a.lo == b.lo, a.hi == b.hi); }
+inline FloatV8 operator!=(FloatV8 a, FloatV8 b) { return FloatV8(a.lo != b.lo, a.hi != b.hi); }
+inline FloatV8 Min(FloatV8 a, FloatV8 b) { return FloatV8(Min(a.lo, b.lo), Min(a.hi, b.hi)); }
+inline FloatV8 Max(FloatV8 a, FloatV8 b) { return FloatV8(Max(a.lo, b.lo), Max(a.hi, b.hi)); }
+inline FloatV8 Sqrt(FloatV8 a) { return FloatV8(Sqrt(a.lo), Sqrt(a.hi)); }
+inline FloatV8 Abs(FloatV8 a) { return FloatV8(Abs(a.lo), Abs(a.hi)); }
+// mask ? a : b
+inline FloatV8 Select(FloatV8 mask, FloatV8 a, FloatV8 b) { return FloatV8(Select(mask.lo, a.lo, b.lo), Select(mask.hi, a.hi, b.hi)); }
+#endif
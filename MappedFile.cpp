@@ -0,0 +1,104 @@
+#include "MappedFile.h"
+
+#ifdef _WIN32
+#include <Windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+MappedFile::~MappedFile() {
+	Close();
+}
+
+#ifdef _WIN32
+bool MappedFile::Open(const std::string& path) {
+	Close();
+
+	// --t@CJ-- //
+	HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+	if (file == INVALID_HANDLE_VALUE) return false;
+	file_ = file;
+
+	LARGE_INTEGER size;
+	if (!GetFileSizeEx(file, &size) || size.QuadPart == 0) {
+		Close();
+		return false;
+	}
+	size_ = static_cast<size_t>(size.QuadPart);
+
+	// --t@CŜ}bv-- //
+	mapping_ = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+	if (mapping_ == nullptr) {
+		Close();
+		return false;
+	}
+
+	data_ = static_cast<const uint8_t*>(MapViewOfFile(mapping_, FILE_MAP_READ, 0, 0, 0));
+	if (data_ == nullptr) {
+		Close();
+		return false;
+	}
+	return true;
+}
+
+void MappedFile::Close() {
+	if (data_) UnmapViewOfFile(data_);
+	if (mapping_) CloseHandle(mapping_);
+	if (file_) CloseHandle(file_);
+	data_ = nullptr;
+	mapping_ = nullptr;
+	file_ = nullptr;
+	size_ = 0;
+}
+
+bool GetFileStamp(const std::string& path, uint64_t* size, uint64_t* time) {
+	WIN32_FILE_ATTRIBUTE_DATA attribute;
+	if (!GetFileAttributesExA(path.c_str(), GetFileExInfoStandard, &attribute)) return false;
+	*size = (uint64_t(attribute.nFileSizeHigh) << 32) | attribute.nFileSizeLow;
+	*time = (uint64_t(attribute.ftLastWriteTime.dwHighDateTime) << 32) | attribute.ftLastWriteTime.dwLowDateTime;
+	return true;
+}
+#else
+bool MappedFile::Open(const std::string& path) {
+	Close();
+
+	// --t@CJ-- //
+	fd_ = open(path.c_str(), O_RDONLY);
+	if (fd_ < 0) return false;
+
+	struct stat st;
+	if (fstat(fd_, &st) != 0 || st.st_size == 0) {
+		Close();
+		return false;
+	}
+	size_ = static_cast<size_t>(st.st_size);
+
+	// --t@CŜ}bv-- //
+	void* data = mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd_, 0);
+	if (data == MAP_FAILED) {
+		Close();
+		return false;
+	}
+	data_ = static_cast<const uint8_t*>(data);
+	return true;
+}
+
+void MappedFile::Close() {
+	if (data_) munmap(const_cast<uint8_t*>(data_), size_);
+	if (fd_ >= 0) close(fd_);
+	data_ = nullptr;
+	fd_ = -1;
+	size_ = 0;
+}
+
+bool GetFileStamp(const std::string& path, uint64_t* size, uint64_t* time) {
+	struct stat st;
+	if (stat(path.c_str(), &st) != 0) return false;
+	*size = static_cast<uint64_t>(st.st_size);
+	*time = static_cast<uint64_t>(st.st_mtim.tv_sec) * 1000000000ull + static_cast<uint64_t>(st.st_mtim.tv_nsec);
+	return true;
+}
+#endif
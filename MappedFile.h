@@ -0,0 +1,41 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+// --t@CǂݍݐpŃɃ}bv-- //
+class MappedFile {
+public:// o֐
+	MappedFile() = default;
+	~MappedFile();
+	MappedFile(const MappedFile&) = delete;
+	MappedFile& operator=(const MappedFile&) = delete;
+
+	// t@CJă}bv(sfalse)
+	bool Open(const std::string& path);
+
+	// }bvăt@C
+	void Close();
+
+#pragma region Qb^[
+	// }bv擪AhX̎擾
+	inline const uint8_t* GetData() const { return data_; }
+
+	// t@CTCY̎擾
+	inline size_t GetSize() const { return size_; }
+#pragma endregion
+
+private:// oϐ
+	const uint8_t* data_ = nullptr;// -> }bv擪AhX
+	size_t size_ = 0;// ---------------> t@CTCY
+
+#ifdef _WIN32
+	void* file_ = nullptr;// ----> t@Cnh
+	void* mapping_ = nullptr;// -> t@C}bsOIuWFNg
+#else
+	int fd_ = -1;// -> t@CfBXNv^
+#endif
+};
+
+// --t@C̃TCYƍŏIXV擾(sfalse)-- //
+bool GetFileStamp(const std::string& path, uint64_t* size, uint64_t* time);
@@ -1,34 +1,13 @@
 #include "Matrix4.h"
+#include "fSIMD.h"
+#include "fMath.h"
+#include "Util.h"
 #include <cmath>
 
-// --Pʍs߂-- //
-Matrix4 Matrix4Identity() {
-	static const Matrix4 result{
-		1.0f, 0.0f, 0.0f, 0.0f,
-		0.0f, 1.0f, 0.0f, 0.0f,
-		0.0f, 0.0f, 1.0f, 0.0f,
-		0.0f, 0.0f, 0.0f, 1.0f
-	};
-
-	return result;
-}
-
-// --gks߂-- //
-Matrix4 Matrix4Scale(const Float3& s) {
-	Matrix4 result{
-		s.x, 0.0f, 0.0f, 0.0f,
-		0.0f, s.y, 0.0f, 0.0f,
-		0.0f, 0.0f, s.z, 0.0f,
-		0.0f, 0.0f, 0.0f, 1.0f
-	};
-
-	return result;
-}
-
 // --X܂̉]s߂-- //
 Matrix4 Matrix4RotateX(float angle) {
-	float sin = std::sin(angle);
-	float cos = std::cos(angle);
+	float sin, cos;
+	Util::SinCos(angle, &sin, &cos);
 
 	Matrix4 result{
 		1.0f, 0.0f, 0.0f, 0.0f,
@@ -42,8 +21,8 @@ Matrix4 Matrix4RotateX(float angle) {
 
 // --Y܂̉]s߂-- //
 Matrix4 Matrix4RotateY(float angle) {
-	float sin = std::sin(angle);
-	float cos = std::cos(angle);
+	float sin, cos;
+	Util::SinCos(angle, &sin, &cos);
 
 	Matrix4 result{
 		cos, 0.0f, -sin, 0.0f,
@@ -57,8 +36,8 @@ Matrix4 Matrix4RotateY(float angle) {
 
 // --Z܂̉]s߂-- //
 Matrix4 Matrix4RotateZ(float angle) {
-	float sin = std::sin(angle);
-	float cos = std::cos(angle);
+	float sin, cos;
+	Util::SinCos(angle, &sin, &cos);
 
 	Matrix4 result{
 		cos, sin, 0.0f, 0.0f,
@@ -70,12 +49,22 @@ Matrix4 Matrix4RotateZ(float angle) {
 	return result;
 }
 
-// --sړs߂-- //
-Matrix4 Matrix4Translate(const Float3& t) {
+// --NH[^jI]s߂-- //
+Matrix4 Matrix4Rotate(const Quaternion& q) {
+	return Matrix4ComposeTRS(Float3(1.0f, 1.0f, 1.0f), q, Float3(0.0f, 0.0f, 0.0f));
+}
+
+// --gkA]Asړ[hs߂-- //
+// --]s̊esgk{AŌ̍sɕsړ邾Ȃ̂ōs̐ς͕sv-- //
+Matrix4 Matrix4ComposeTRS(const Float3& s, const Quaternion& r, const Float3& t) {
+	float xx = r.x * r.x, yy = r.y * r.y, zz = r.z * r.z;
+	float xy = r.x * r.y, xz = r.x * r.z, yz = r.y * r.z;
+	float wx = r.w * r.x, wy = r.w * r.y, wz = r.w * r.z;
+
 	Matrix4 result{
-		1.0f, 0.0f, 0.0f, 0.0f,
-		0.0f, 1.0f, 0.0f, 0.0f,
-		0.0f, 0.0f, 1.0f, 0.0f,
+		s.x * (1.0f - 2.0f * (yy + zz)), s.x * (2.0f * (xy + wz)), s.x * (2.0f * (xz - wy)), 0.0f,
+		s.y * (2.0f * (xy - wz)), s.y * (1.0f - 2.0f * (xx + zz)), s.y * (2.0f * (yz + wx)), 0.0f,
+		s.z * (2.0f * (xz + wy)), s.z * (2.0f * (yz - wx)), s.z * (1.0f - 2.0f * (xx + yy)), 0.0f,
 		t.x, t.y, t.z, 1.0f
 	};
 
@@ -83,7 +72,35 @@ Matrix4 Matrix4Translate(const Float3& t) {
 }
 
 // --WϊixNgƍs̊|Zjstransform֐쐬BiϊɂΉĂj-- //
+// --Z̏Ԃ̓XJ[łƓɂĂ̂ŁAʂ̓rbgPʂňv-- //
 Float3 Matrix4Transform(const Float3& v, const Matrix4& m) {
+#if defined(FMATH_SSE)
+	__m128 r = _mm_add_ps(_mm_add_ps(_mm_add_ps(
+		_mm_mul_ps(_mm_set1_ps(v.x), _mm_loadu_ps(m.m[0])),
+		_mm_mul_ps(_mm_set1_ps(v.y), _mm_loadu_ps(m.m[1]))),
+		_mm_mul_ps(_mm_set1_ps(v.z), _mm_loadu_ps(m.m[2]))),
+		_mm_loadu_ps(m.m[3]));
+
+	// --wŊit̋ߎ͎g킸Zj-- //
+	r = _mm_div_ps(r, _mm_shuffle_ps(r, r, _MM_SHUFFLE(3, 3, 3, 3)));
+
+	float f[4];
+	_mm_storeu_ps(f, r);
+	return Float3(f[0], f[1], f[2]);
+#elif defined(FMATH_NEON)
+	float32x4_t r = vaddq_f32(vaddq_f32(vaddq_f32(
+		vmulq_n_f32(vld1q_f32(m.m[0]), v.x),
+		vmulq_n_f32(vld1q_f32(m.m[1]), v.y)),
+		vmulq_n_f32(vld1q_f32(m.m[2]), v.z)),
+		vld1q_f32(m.m[3]));
+
+	// --wŊit̋ߎ͎g킸Zj-- //
+	r = vdivq_f32(r, vdupq_laneq_f32(r, 3));
+
+	float f[4];
+	vst1q_f32(f, r);
+	return Float3(f[0], f[1], f[2]);
+#else
 	float w = v.x * m.m[0][3] + v.y * m.m[1][3] + v.z * m.m[2][3] + m.m[3][3];
 
 	Float3 result{
@@ -92,11 +109,269 @@ Float3 Matrix4Transform(const Float3& v, const Matrix4& m) {
 		(v.x * m.m[0][2] + v.y * m.m[1][2] + v.z * m.m[2][2] + m.m[3][2]) / w
 	};
 
+	return result;
+#endif
+}
+
+// --]us߂-- //
+Matrix4 Matrix4Transpose(const Matrix4& m) {
+	Matrix4 result;
+#if defined(FMATH_SSE)
+	__m128 r0 = _mm_loadu_ps(m.m[0]);
+	__m128 r1 = _mm_loadu_ps(m.m[1]);
+	__m128 r2 = _mm_loadu_ps(m.m[2]);
+	__m128 r3 = _mm_loadu_ps(m.m[3]);
+	_MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+	_mm_storeu_ps(result.m[0], r0);
+	_mm_storeu_ps(result.m[1], r1);
+	_mm_storeu_ps(result.m[2], r2);
+	_mm_storeu_ps(result.m[3], r3);
+#elif defined(FMATH_NEON)
+	// --vld44vfɓǂݍނ̂ŁÂ܂ܗɂȂ-- //
+	float32x4x4_t c = vld4q_f32(&m.m[0][0]);
+	vst1q_f32(result.m[0], c.val[0]);
+	vst1q_f32(result.m[1], c.val[1]);
+	vst1q_f32(result.m[2], c.val[2]);
+	vst1q_f32(result.m[3], c.val[3]);
+#else
+	for (int i = 0; i < 4; i++) {
+		for (int j = 0; j < 4; j++) {
+			result.m[i][j] = m.m[j][i];
+		}
+	}
+#endif
+	return result;
+}
+
+#if defined(FMATH_SSE)
+// --2x2s(1̃WX^ɍsDŊi[)̉Z-- //
+#define FMATH_SWIZZLE(v, x, y, z, w) _mm_shuffle_ps(v, v, _MM_SHUFFLE(w, z, y, x))
+
+// A * B
+static inline __m128 Mat2Mul(__m128 a, __m128 b) {
+	return _mm_add_ps(_mm_mul_ps(a, FMATH_SWIZZLE(b, 0, 3, 0, 3)),
+		_mm_mul_ps(FMATH_SWIZZLE(a, 1, 0, 3, 2), FMATH_SWIZZLE(b, 2, 1, 2, 1)));
+}
+
+// adj(A) * B
+static inline __m128 Mat2AdjMul(__m128 a, __m128 b) {
+	return _mm_sub_ps(_mm_mul_ps(FMATH_SWIZZLE(a, 3, 3, 0, 0), b),
+		_mm_mul_ps(FMATH_SWIZZLE(a, 1, 1, 2, 2), FMATH_SWIZZLE(b, 2, 3, 0, 1)));
+}
+
+// A * adj(B)
+static inline __m128 Mat2MulAdj(__m128 a, __m128 b) {
+	return _mm_sub_ps(_mm_mul_ps(a, FMATH_SWIZZLE(b, 3, 0, 3, 0)),
+		_mm_mul_ps(FMATH_SWIZZLE(a, 1, 0, 3, 2), FMATH_SWIZZLE(b, 2, 1, 2, 1)));
+}
+#endif
+
+// --ts߂-- //
+Matrix4 Matrix4Inverse(const Matrix4& m, float* det) {
+	Matrix4 result;
+#if defined(FMATH_SSE)
+	// --2x2̃ubN | A B | ɕČvZ-- //
+	// --              | C D |                   -- //
+	__m128 r0 = _mm_loadu_ps(m.m[0]);
+	__m128 r1 = _mm_loadu_ps(m.m[1]);
+	__m128 r2 = _mm_loadu_ps(m.m[2]);
+	__m128 r3 = _mm_loadu_ps(m.m[3]);
+
+	__m128 a = _mm_movelh_ps(r0, r1);
+	__m128 b = _mm_movehl_ps(r1, r0);
+	__m128 c = _mm_movelh_ps(r2, r3);
+	__m128 d = _mm_movehl_ps(r3, r2);
+
+	// eubN̍s (|A| |B| |C| |D|)
+	__m128 detSub = _mm_sub_ps(
+		_mm_mul_ps(_mm_shuffle_ps(r0, r2, _MM_SHUFFLE(2, 0, 2, 0)), _mm_shuffle_ps(r1, r3, _MM_SHUFFLE(3, 1, 3, 1))),
+		_mm_mul_ps(_mm_shuffle_ps(r0, r2, _MM_SHUFFLE(3, 1, 3, 1)), _mm_shuffle_ps(r1, r3, _MM_SHUFFLE(2, 0, 2, 0))));
+	__m128 detA = FMATH_SWIZZLE(detSub, 0, 0, 0, 0);
+	__m128 detB = FMATH_SWIZZLE(detSub, 1, 1, 1, 1);
+	__m128 detC = FMATH_SWIZZLE(detSub, 2, 2, 2, 2);
+	__m128 detD = FMATH_SWIZZLE(detSub, 3, 3, 3, 3);
+
+	__m128 dc = Mat2AdjMul(d, c);
+	__m128 ab = Mat2AdjMul(a, b);
+
+	// ts̊eubN(̗]q)
+	__m128 x = _mm_sub_ps(_mm_mul_ps(detD, a), Mat2Mul(b, dc));
+	__m128 w = _mm_sub_ps(_mm_mul_ps(detA, d), Mat2Mul(c, ab));
+	__m128 y = _mm_sub_ps(_mm_mul_ps(detB, c), Mat2MulAdj(d, ab));
+	__m128 z = _mm_sub_ps(_mm_mul_ps(detC, b), Mat2MulAdj(a, dc));
+
+	// |M| = |A||D| + |B||C| - tr(adj(A)B adj(D)C)
+	__m128 tr = _mm_mul_ps(ab, FMATH_SWIZZLE(dc, 0, 2, 1, 3));
+	tr = _mm_add_ps(tr, FMATH_SWIZZLE(tr, 2, 3, 0, 1));
+	tr = _mm_add_ps(tr, FMATH_SWIZZLE(tr, 1, 0, 3, 2));
+	__m128 detM = _mm_sub_ps(_mm_add_ps(_mm_mul_ps(detA, detD), _mm_mul_ps(detB, detC)), tr);
+
+	__m128 rDetM = _mm_div_ps(_mm_setr_ps(1.0f, -1.0f, -1.0f, 1.0f), detM);
+	x = _mm_mul_ps(x, rDetM);
+	y = _mm_mul_ps(y, rDetM);
+	z = _mm_mul_ps(z, rDetM);
+	w = _mm_mul_ps(w, rDetM);
+
+	// ]qs̕בւƏ݂܂Ƃ߂čs
+	_mm_storeu_ps(result.m[0], _mm_shuffle_ps(x, y, _MM_SHUFFLE(1, 3, 1, 3)));
+	_mm_storeu_ps(result.m[1], _mm_shuffle_ps(x, y, _MM_SHUFFLE(0, 2, 0, 2)));
+	_mm_storeu_ps(result.m[2], _mm_shuffle_ps(z, w, _MM_SHUFFLE(1, 3, 1, 3)));
+	_mm_storeu_ps(result.m[3], _mm_shuffle_ps(z, w, _MM_SHUFFLE(0, 2, 0, 2)));
+
+	if (det) *det = _mm_cvtss_f32(detM);
+#else
+	const float(*a)[4] = m.m;
+
+	// 2sƉ2s2x2s
+	float s0 = a[0][0] * a[1][1] - a[1][0] * a[0][1];
+	float s1 = a[0][0] * a[1][2] - a[1][0] * a[0][2];
+	float s2 = a[0][0] * a[1][3] - a[1][0] * a[0][3];
+	float s3 = a[0][1] * a[1][2] - a[1][1] * a[0][2];
+	float s4 = a[0][1] * a[1][3] - a[1][1] * a[0][3];
+	float s5 = a[0][2] * a[1][3] - a[1][2] * a[0][3];
+
+	float c5 = a[2][2] * a[3][3] - a[3][2] * a[2][3];
+	float c4 = a[2][1] * a[3][3] - a[3][1] * a[2][3];
+	float c3 = a[2][1] * a[3][2] - a[3][1] * a[2][2];
+	float c2 = a[2][0] * a[3][3] - a[3][0] * a[2][3];
+	float c1 = a[2][0] * a[3][2] - a[3][0] * a[2][2];
+	float c0 = a[2][0] * a[3][1] - a[3][0] * a[2][1];
+
+	float d = s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
+	float inv = 1.0f / d;
+
+	result.m[0][0] = (a[1][1] * c5 - a[1][2] * c4 + a[1][3] * c3) * inv;
+	result.m[0][1] = (-a[0][1] * c5 + a[0][2] * c4 - a[0][3] * c3) * inv;
+	result.m[0][2] = (a[3][1] * s5 - a[3][2] * s4 + a[3][3] * s3) * inv;
+	result.m[0][3] = (-a[2][1] * s5 + a[2][2] * s4 - a[2][3] * s3) * inv;
+
+	result.m[1][0] = (-a[1][0] * c5 + a[1][2] * c2 - a[1][3] * c1) * inv;
+	result.m[1][1] = (a[0][0] * c5 - a[0][2] * c2 + a[0][3] * c1) * inv;
+	result.m[1][2] = (-a[3][0] * s5 + a[3][2] * s2 - a[3][3] * s1) * inv;
+	result.m[1][3] = (a[2][0] * s5 - a[2][2] * s2 + a[2][3] * s1) * inv;
+
+	result.m[2][0] = (a[1][0] * c4 - a[1][1] * c2 + a[1][3] * c0) * inv;
+	result.m[2][1] = (-a[0][0] * c4 + a[0][1] * c2 - a[0][3] * c0) * inv;
+	result.m[2][2] = (a[3][0] * s4 - a[3][1] * s2 + a[3][3] * s0) * inv;
+	result.m[2][3] = (-a[2][0] * s4 + a[2][1] * s2 - a[2][3] * s0) * inv;
+
+	result.m[3][0] = (-a[1][0] * c3 + a[1][1] * c1 - a[1][2] * c0) * inv;
+	result.m[3][1] = (a[0][0] * c3 - a[0][1] * c1 + a[0][2] * c0) * inv;
+	result.m[3][2] = (-a[3][0] * s3 + a[3][1] * s1 - a[3][2] * s0) * inv;
+	result.m[3][3] = (a[2][0] * s3 - a[2][1] * s1 + a[2][2] * s0) * inv;
+
+	if (det) *det = d;
+#endif
+	return result;
+}
+
+// --3x3̊es̊O(]q)߂-- //
+// --n0 = r1~r2, n1 = r2~r0, n2 = r0~r1 ŁAׂƍ3x3̋t]us ~ s ɂȂ-- //
+static inline float Cofactor3(const Matrix4& m, Float3* n) {
+	const float(*a)[4] = m.m;
+	n[0] = Float3(a[1][1] * a[2][2] - a[1][2] * a[2][1], a[1][2] * a[2][0] - a[1][0] * a[2][2], a[1][0] * a[2][1] - a[1][1] * a[2][0]);
+	n[1] = Float3(a[2][1] * a[0][2] - a[2][2] * a[0][1], a[2][2] * a[0][0] - a[2][0] * a[0][2], a[2][0] * a[0][1] - a[2][1] * a[0][0]);
+	n[2] = Float3(a[0][1] * a[1][2] - a[0][2] * a[1][1], a[0][2] * a[1][0] - a[0][0] * a[1][2], a[0][0] * a[1][1] - a[0][1] * a[1][0]);
+
+	// s = r0E(r1~r2)
+	return a[0][0] * n[0].x + a[0][1] * n[0].y + a[0][2] * n[0].z;
+}
+
+// --AtBϊs̋ts߂-- //
+Matrix4 Matrix4AffineInverse(const Matrix4& m, float* det) {
+	Float3 n[3];
+	float d = Cofactor3(m, n);
+	float inv = 1.0f / d;
+
+	// 3x3̋ts͗]q]u
+	Matrix4 result{
+		n[0].x * inv, n[1].x * inv, n[2].x * inv, 0.0f,
+		n[0].y * inv, n[1].y * inv, n[2].y * inv, 0.0f,
+		n[0].z * inv, n[1].z * inv, n[2].z * inv, 0.0f,
+		0.0f, 0.0f, 0.0f, 1.0f
+	};
+
+	// sړ -t * (3x3̋ts)
+	const float* t = m.m[3];
+	for (int j = 0; j < 3; j++) {
+		result.m[3][j] = -(t[0] * result.m[0][j] + t[1] * result.m[1][j] + t[2] * result.m[2][j]);
+	}
+
+	if (det) *det = d;
+	return result;
+}
+
+// --@ϊp̍s߂-- //
+Matrix4 Matrix4NormalMatrix(const Matrix4& m) {
+	Float3 n[3];
+	float inv = 1.0f / Cofactor3(m, n);
+
+	Matrix4 result{
+		n[0].x * inv, n[0].y * inv, n[0].z * inv, 0.0f,
+		n[1].x * inv, n[1].y * inv, n[1].z * inv, 0.0f,
+		n[2].x * inv, n[2].y * inv, n[2].z * inv, 0.0f,
+		0.0f, 0.0f, 0.0f, 1.0f
+	};
+
 	return result;
 }
 
 // --Zq *= ̃I[o[[h֐isƍs̐ρj-- //
+// --ʂ i s = m1  i sڂ̊evf ~ m2 ̊es ̘aƂčsPʂŌvZ-- //
+// --0珇ɑĂXJ[łƓԂŉẐŁAʂ̓rbgPʂňv-- //
 Matrix4& operator*=(Matrix4& m1, const Matrix4& m2) {
+#if defined(FMATH_AVX)
+	// --m2ɓǂݍł̂ m *= m łȂ-- //
+	const __m256 b0 = _mm256_broadcast_ps((const __m128*)m2.m[0]);
+	const __m256 b1 = _mm256_broadcast_ps((const __m128*)m2.m[1]);
+	const __m256 b2 = _mm256_broadcast_ps((const __m128*)m2.m[2]);
+	const __m256 b3 = _mm256_broadcast_ps((const __m128*)m2.m[3]);
+
+	// --2svZ-- //
+	for (int i = 0; i < 4; i += 2) {
+		const float* a0 = m1.m[i];
+		const float* a1 = m1.m[i + 1];
+		__m256 r = _mm256_setzero_ps();
+		r = _mm256_add_ps(r, _mm256_mul_ps(_mm256_setr_m128(_mm_set1_ps(a0[0]), _mm_set1_ps(a1[0])), b0));
+		r = _mm256_add_ps(r, _mm256_mul_ps(_mm256_setr_m128(_mm_set1_ps(a0[1]), _mm_set1_ps(a1[1])), b1));
+		r = _mm256_add_ps(r, _mm256_mul_ps(_mm256_setr_m128(_mm_set1_ps(a0[2]), _mm_set1_ps(a1[2])), b2));
+		r = _mm256_add_ps(r, _mm256_mul_ps(_mm256_setr_m128(_mm_set1_ps(a0[3]), _mm_set1_ps(a1[3])), b3));
+		_mm256_storeu_ps(m1.m[i], r);
+	}
+#elif defined(FMATH_SSE)
+	// --m2ɓǂݍł̂ m *= m łȂ-- //
+	const __m128 b0 = _mm_loadu_ps(m2.m[0]);
+	const __m128 b1 = _mm_loadu_ps(m2.m[1]);
+	const __m128 b2 = _mm_loadu_ps(m2.m[2]);
+	const __m128 b3 = _mm_loadu_ps(m2.m[3]);
+
+	for (int i = 0; i < 4; i++) {
+		const __m128 a = _mm_loadu_ps(m1.m[i]);
+		__m128 r = _mm_setzero_ps();
+		r = _mm_add_ps(r, _mm_mul_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(0, 0, 0, 0)), b0));
+		r = _mm_add_ps(r, _mm_mul_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(1, 1, 1, 1)), b1));
+		r = _mm_add_ps(r, _mm_mul_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(2, 2, 2, 2)), b2));
+		r = _mm_add_ps(r, _mm_mul_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(3, 3, 3, 3)), b3));
+		_mm_storeu_ps(m1.m[i], r);
+	}
+#elif defined(FMATH_NEON)
+	// --m2ɓǂݍł̂ m *= m łȂ-- //
+	const float32x4_t b0 = vld1q_f32(m2.m[0]);
+	const float32x4_t b1 = vld1q_f32(m2.m[1]);
+	const float32x4_t b2 = vld1q_f32(m2.m[2]);
+	const float32x4_t b3 = vld1q_f32(m2.m[3]);
+
+	// --vmlaq FMAɂȂ̂Ŏg킸AZƉZ𕪂Ă-- //
+	for (int i = 0; i < 4; i++) {
+		const float32x4_t a = vld1q_f32(m1.m[i]);
+		float32x4_t r = vdupq_n_f32(0.0f);
+		r = vaddq_f32(r, vmulq_laneq_f32(b0, a, 0));
+		r = vaddq_f32(r, vmulq_laneq_f32(b1, a, 1));
+		r = vaddq_f32(r, vmulq_laneq_f32(b2, a, 2));
+		r = vaddq_f32(r, vmulq_laneq_f32(b3, a, 3));
+		vst1q_f32(m1.m[i], r);
+	}
+#else
 	Matrix4 result{ 0 };
 
 	for (int i = 0; i < 4; i++) {
@@ -107,6 +382,7 @@ Matrix4& operator*=(Matrix4& m1, const Matrix4& m2) {
 		}
 	}
 	m1 = result;
+#endif
 	return m1;
 }
 
@@ -119,4 +395,188 @@ const Matrix4 operator*(const Matrix4& m1, const Matrix4& m2) {
 // --2Zq*̃I[o[[h֐ixNgƍs̐ρj-- //
 const Float3 operator*(const Float3& v, const Matrix4& m) {
 	return Matrix4Transform(v, m);
-}
\ No newline at end of file
+}
+
+// --ꊇWϊ̎-- //
+enum class TransformMode {
+	Affine,
+	Perspective,
+	Direction,
+};
+
+// --1_̕ϊiSIMDŏȂ[pj-- //
+template <TransformMode mode>
+static inline Float3 TransformOne(const Float3& v, const Matrix4& m) {
+	Float3 r{
+		v.x * m.m[0][0] + v.y * m.m[1][0] + v.z * m.m[2][0],
+		v.x * m.m[0][1] + v.y * m.m[1][1] + v.z * m.m[2][1],
+		v.x * m.m[0][2] + v.y * m.m[1][2] + v.z * m.m[2][2]
+	};
+
+	if (mode == TransformMode::Direction) return r;
+
+	r.x = r.x + m.m[3][0];
+	r.y = r.y + m.m[3][1];
+	r.z = r.z + m.m[3][2];
+
+	if (mode == TransformMode::Perspective) {
+		float w = v.x * m.m[0][3] + v.y * m.m[1][3] + v.z * m.m[2][3] + m.m[3][3];
+		r.x = r.x / w;
+		r.y = r.y / w;
+		r.z = r.z / w;
+	}
+
+	return r;
+}
+
+// --ꊇWϊ{-- //
+// --ẻZMatrix4TransformƓ-- //
+template <TransformMode mode>
+static void TransformArray(Float3* dst, const Float3* src, size_t count, const Matrix4& m) {
+	size_t i = 0;
+#if defined(FMATH_SSE) || defined(FMATH_NEON)
+	const float* in = reinterpret_cast<const float*>(src);
+	float* out = reinterpret_cast<float*>(dst);
+#endif
+
+#if defined(FMATH_AVX)
+	// --8_-- //
+	{
+		__m256 mm[4][4];
+		for (int r = 0; r < 4; r++) {
+			for (int c = 0; c < 4; c++) mm[r][c] = _mm256_set1_ps(m.m[r][c]);
+		}
+
+		for (; i + 8 <= count; i += 8) {
+			const float* p = in + i * 3;
+			__m256 a = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(p + 0)), _mm_loadu_ps(p + 12), 1);
+			__m256 b = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(p + 4)), _mm_loadu_ps(p + 16), 1);
+			__m256 c = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(p + 8)), _mm_loadu_ps(p + 20), 1);
+			__m256 x, y, z;
+			FMATH_DEINTERLEAVE3(_mm256_, a, b, c, x, y, z);
+
+			__m256 rx = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(x, mm[0][0]), _mm256_mul_ps(y, mm[1][0])), _mm256_mul_ps(z, mm[2][0]));
+			__m256 ry = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(x, mm[0][1]), _mm256_mul_ps(y, mm[1][1])), _mm256_mul_ps(z, mm[2][1]));
+			__m256 rz = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(x, mm[0][2]), _mm256_mul_ps(y, mm[1][2])), _mm256_mul_ps(z, mm[2][2]));
+			if (mode != TransformMode::Direction) {
+				rx = _mm256_add_ps(rx, mm[3][0]);
+				ry = _mm256_add_ps(ry, mm[3][1]);
+				rz = _mm256_add_ps(rz, mm[3][2]);
+			}
+			if (mode == TransformMode::Perspective) {
+				__m256 w = _mm256_add_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(x, mm[0][3]), _mm256_mul_ps(y, mm[1][3])), _mm256_mul_ps(z, mm[2][3])), mm[3][3]);
+				rx = _mm256_div_ps(rx, w);
+				ry = _mm256_div_ps(ry, w);
+				rz = _mm256_div_ps(rz, w);
+			}
+
+			FMATH_INTERLEAVE3(_mm256_, rx, ry, rz, a, b, c);
+			float* q = out + i * 3;
+			_mm_storeu_ps(q + 0, _mm256_castps256_ps128(a));
+			_mm_storeu_ps(q + 4, _mm256_castps256_ps128(b));
+			_mm_storeu_ps(q + 8, _mm256_castps256_ps128(c));
+			_mm_storeu_ps(q + 12, _mm256_extractf128_ps(a, 1));
+			_mm_storeu_ps(q + 16, _mm256_extractf128_ps(b, 1));
+			_mm_storeu_ps(q + 20, _mm256_extractf128_ps(c, 1));
+		}
+	}
+#endif
+
+#if defined(FMATH_SSE)
+	// --4_-- //
+	{
+		__m128 mm[4][4];
+		for (int r = 0; r < 4; r++) {
+			for (int c = 0; c < 4; c++) mm[r][c] = _mm_set1_ps(m.m[r][c]);
+		}
+
+		for (; i + 4 <= count; i += 4) {
+			const float* p = in + i * 3;
+			__m128 a = _mm_loadu_ps(p + 0);
+			__m128 b = _mm_loadu_ps(p + 4);
+			__m128 c = _mm_loadu_ps(p + 8);
+			__m128 x, y, z;
+			FMATH_DEINTERLEAVE3(_mm_, a, b, c, x, y, z);
+
+			__m128 rx = _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, mm[0][0]), _mm_mul_ps(y, mm[1][0])), _mm_mul_ps(z, mm[2][0]));
+			__m128 ry = _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, mm[0][1]), _mm_mul_ps(y, mm[1][1])), _mm_mul_ps(z, mm[2][1]));
+			__m128 rz = _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, mm[0][2]), _mm_mul_ps(y, mm[1][2])), _mm_mul_ps(z, mm[2][2]));
+			if (mode != TransformMode::Direction) {
+				rx = _mm_add_ps(rx, mm[3][0]);
+				ry = _mm_add_ps(ry, mm[3][1]);
+				rz = _mm_add_ps(rz, mm[3][2]);
+			}
+			if (mode == TransformMode::Perspective) {
+				__m128 w = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(x, mm[0][3]), _mm_mul_ps(y, mm[1][3])), _mm_mul_ps(z, mm[2][3])), mm[3][3]);
+				rx = _mm_div_ps(rx, w);
+				ry = _mm_div_ps(ry, w);
+				rz = _mm_div_ps(rz, w);
+			}
+
+			FMATH_INTERLEAVE3(_mm_, rx, ry, rz, a, b, c);
+			float* q = out + i * 3;
+			_mm_storeu_ps(q + 0, a);
+			_mm_storeu_ps(q + 4, b);
+			_mm_storeu_ps(q + 8, c);
+		}
+	}
+#elif defined(FMATH_NEON)
+	// --4_ivld3/vst3ŕבւɍsj-- //
+	for (; i + 4 <= count; i += 4) {
+		float32x4x3_t v = vld3q_f32(in + i * 3);
+		float32x4_t rx = vaddq_f32(vaddq_f32(vmulq_n_f32(v.val[0], m.m[0][0]), vmulq_n_f32(v.val[1], m.m[1][0])), vmulq_n_f32(v.val[2], m.m[2][0]));
+		float32x4_t ry = vaddq_f32(vaddq_f32(vmulq_n_f32(v.val[0], m.m[0][1]), vmulq_n_f32(v.val[1], m.m[1][1])), vmulq_n_f32(v.val[2], m.m[2][1]));
+		float32x4_t rz = vaddq_f32(vaddq_f32(vmulq_n_f32(v.val[0], m.m[0][2]), vmulq_n_f32(v.val[1], m.m[1][2])), vmulq_n_f32(v.val[2], m.m[2][2]));
+		if (mode != TransformMode::Direction) {
+			rx = vaddq_f32(rx, vdupq_n_f32(m.m[3][0]));
+			ry = vaddq_f32(ry, vdupq_n_f32(m.m[3][1]));
+			rz = vaddq_f32(rz, vdupq_n_f32(m.m[3][2]));
+		}
+		if (mode == TransformMode::Perspective) {
+			float32x4_t w = vaddq_f32(vaddq_f32(vaddq_f32(vmulq_n_f32(v.val[0], m.m[0][3]), vmulq_n_f32(v.val[1], m.m[1][3])), vmulq_n_f32(v.val[2], m.m[2][3])), vdupq_n_f32(m.m[3][3]));
+			rx = vdivq_f32(rx, w);
+			ry = vdivq_f32(ry, w);
+			rz = vdivq_f32(rz, w);
+		}
+		v.val[0] = rx;
+		v.val[1] = ry;
+		v.val[2] = rz;
+		vst3q_f32(out + i * 3, v);
+	}
+#endif
+
+	// --c̒[-- //
+	for (; i < count; i++) {
+		dst[i] = TransformOne<mode>(src[i], m);
+	}
+}
+
+// --ꊇWϊisړ݁AwŊȂj-- //
+void Matrix4TransformAffine(Float3* dst, const Float3* src, size_t count, const Matrix4& m) {
+	TransformArray<TransformMode::Affine>(dst, src, count, m);
+}
+
+// --ꊇWϊiwŊj-- //
+void Matrix4TransformPerspective(Float3* dst, const Float3* src, size_t count, const Matrix4& m) {
+	TransformArray<TransformMode::Perspective>(dst, src, count, m);
+}
+
+// --ꊇWϊixNgpAsړ𖳎j-- //
+void Matrix4TransformDirection(Float3* dst, const Float3* src, size_t count, const Matrix4& m) {
+	TransformArray<TransformMode::Direction>(dst, src, count, m);
+}
+
+// --Vector3ŁiFloat3ƃzuȂ̂ł̂܂ܓnj-- //
+static_assert(sizeof(Vector3) == sizeof(Float3), "Vector3Float3̃TCYႢ܂");
+
+void Matrix4TransformAffine(Vector3* dst, const Vector3* src, size_t count, const Matrix4& m) {
+	Matrix4TransformAffine(reinterpret_cast<Float3*>(dst), reinterpret_cast<const Float3*>(src), count, m);
+}
+
+void Matrix4TransformPerspective(Vector3* dst, const Vector3* src, size_t count, const Matrix4& m) {
+	Matrix4TransformPerspective(reinterpret_cast<Float3*>(dst), reinterpret_cast<const Float3*>(src), count, m);
+}
+
+void Matrix4TransformDirection(Vector3* dst, const Vector3* src, size_t count, const Matrix4& m) {
+	Matrix4TransformDirection(reinterpret_cast<Float3*>(dst), reinterpret_cast<const Float3*>(src), count, m);
+}
@@ -1,5 +1,8 @@
 #pragma once
 #include "Float3.h"
+#include "Vector3.h"
+#include "Quaternion.h"
+#include <cstddef>
 
 // --Matrix4\-- //
 struct Matrix4 {
@@ -7,25 +10,86 @@ struct Matrix4 {
 };
 
 // --Pʍs߂-- //
-Matrix4 Matrix4Identity();
+constexpr Matrix4 Matrix4Identity();
 
 // --gks̐ݒ-- //
-Matrix4 Matrix4Scale(const Float3& s);
+constexpr Matrix4 Matrix4Scale(const Float3& s);
 
 // --]s̐ݒ-- //
 Matrix4 Matrix4RotateX(float angle);
 Matrix4 Matrix4RotateY(float angle);
 Matrix4 Matrix4RotateZ(float angle);
+Matrix4 Matrix4Rotate(const Quaternion& q);
 
 // --sړs̍쐬-- //
-Matrix4 Matrix4Translate(const Float3& t);
+constexpr Matrix4 Matrix4Translate(const Float3& t);
+
+// --gkA]Asړ[hs𒼐ڍ쐬-- //
+// --Matrix4Scale(s) * Matrix4Rotate(r) * Matrix4Translate(t) ƓsɂȂ-- //
+Matrix4 Matrix4ComposeTRS(const Float3& s, const Quaternion& r, const Float3& t);
 
 // --WϊixNgƍs̊|Zj-- //
 Float3 Matrix4Transform(const Float3& v, const Matrix4& m);
 
+// --z̈ꊇWϊisrc  dst ͓zł悢j-- //
+// Affine ------> sړ݁AwŊȂi[hsȂǁj
+// Perspective -> wŊiMatrix4TransformƓʁj
+// Direction ---> sړ𖳎ixNgA@Ȃǁj
+void Matrix4TransformAffine(Float3* dst, const Float3* src, size_t count, const Matrix4& m);
+void Matrix4TransformPerspective(Float3* dst, const Float3* src, size_t count, const Matrix4& m);
+void Matrix4TransformDirection(Float3* dst, const Float3* src, size_t count, const Matrix4& m);
+void Matrix4TransformAffine(Vector3* dst, const Vector3* src, size_t count, const Matrix4& m);
+void Matrix4TransformPerspective(Vector3* dst, const Vector3* src, size_t count, const Matrix4& m);
+void Matrix4TransformDirection(Vector3* dst, const Vector3* src, size_t count, const Matrix4& m);
+
+// --]us߂-- //
+Matrix4 Matrix4Transpose(const Matrix4& m);
+
+// --ts߂idetɍs񎮂ԂBdet0̂Ƃ͌ʂj-- //
+Matrix4 Matrix4Inverse(const Matrix4& m, float* det = nullptr);
+
+// --AtBϊsi4ڂ(0,0,0,1)j̋ts߂-- //
+// --Matrix4ComposeTRSōsȂǂ͂̕啝Ɉ-- //
+Matrix4 Matrix4AffineInverse(const Matrix4& m, float* det = nullptr);
+
+// --@ϊp̍si3x3̋t]usAsړ0j߂-- //
+Matrix4 Matrix4NormalMatrix(const Matrix4& m);
+
 // --ZqI[o[[h-- //
 Matrix4& operator*=(Matrix4& m1, const Matrix4& m2);
 
 // --2ZqI[o[[h-- //
 const Matrix4 operator*(const Matrix4& m1, const Matrix4& m2);
-const Float3 operator*(const Float3& v, const Matrix4& m);
\ No newline at end of file
+const Float3 operator*(const Float3& v, const Matrix4& m);
+
+// --萔łg悤Ƀwb_[Œ`Ă-- //
+
+// --Pʍs߂-- //
+constexpr Matrix4 Matrix4Identity() {
+	return Matrix4{
+		1.0f, 0.0f, 0.0f, 0.0f,
+		0.0f, 1.0f, 0.0f, 0.0f,
+		0.0f, 0.0f, 1.0f, 0.0f,
+		0.0f, 0.0f, 0.0f, 1.0f
+	};
+}
+
+// --gks߂-- //
+constexpr Matrix4 Matrix4Scale(const Float3& s) {
+	return Matrix4{
+		s.x, 0.0f, 0.0f, 0.0f,
+		0.0f, s.y, 0.0f, 0.0f,
+		0.0f, 0.0f, s.z, 0.0f,
+		0.0f, 0.0f, 0.0f, 1.0f
+	};
+}
+
+// --sړs߂-- //
+constexpr Matrix4 Matrix4Translate(const Float3& t) {
+	return Matrix4{
+		1.0f, 0.0f, 0.0f, 0.0f,
+		0.0f, 1.0f, 0.0f, 0.0f,
+		0.0f, 0.0f, 1.0f, 0.0f,
+		t.x, t.y, t.z, 1.0f
+	};
+}
\ No newline at end of file
@@ -0,0 +1,522 @@
+#include "Mesh.h"
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstring>
+#include <unordered_map>
+
+namespace {
+	// --̃nbVl-- //
+	inline uint64_t HashMix(uint64_t h) {
+		h ^= h >> 33;
+		h *= 0xff51afd7ed558ccdull;
+		h ^= h >> 33;
+		h *= 0xc4ceb9fe1a85ec53ull;
+		h ^= h >> 33;
+		return h;
+	}
+
+	// --CfbNX̑g̃nbVl-- //
+	inline uint64_t HashIndex(const ObjIndex& index) {
+		return HashMix((uint64_t(index.position) << 32 | index.texcoord) ^ HashMix(index.normal));
+	}
+
+	// --2̒_ׂ̂Ă̐̍epsilonȉ-- //
+	inline bool IsNear(const MeshVertex& a, const MeshVertex& b, float epsilon) {
+		return std::fabs(a.pos.x - b.pos.x) <= epsilon && std::fabs(a.pos.y - b.pos.y) <= epsilon && std::fabs(a.pos.z - b.pos.z) <= epsilon &&
+			std::fabs(a.normal.x - b.normal.x) <= epsilon && std::fabs(a.normal.y - b.normal.y) <= epsilon && std::fabs(a.normal.z - b.normal.z) <= epsilon &&
+			std::fabs(a.uv.x - b.uv.x) <= epsilon && std::fabs(a.uv.y - b.uv.y) <= epsilon;
+	}
+
+	// --Xg[~Oǂݍ݂œ_1čL鋫E-- //
+	struct StreamBounds
+	{
+		AABB box = {};// -------> _͂AABB
+		Sphere sphere = {};// --> _Ɋ܂ނ悤ɍL
+		bool isEmpty = true;// -> ܂_
+
+		// _܂ނ悤ɍL(̊O̓_ȂA̋Ɠ_̗܂ދɂ)
+		void Add(const Float3& p) {
+			if (isEmpty) {
+				box = { p, p };
+				sphere = { p, 0.0f };
+				isEmpty = false;
+				return;
+			}
+			box.min = Float3(std::min(box.min.x, p.x), std::min(box.min.y, p.y), std::min(box.min.z, p.z));
+			box.max = Float3(std::max(box.max.x, p.x), std::max(box.max.y, p.y), std::max(box.max.z, p.z));
+
+			const Float3& c = sphere.center;
+			float d = std::sqrt((p.x - c.x) * (p.x - c.x) + (p.y - c.y) * (p.y - c.y) + (p.z - c.z) * (p.z - c.z));
+			if (d <= sphere.radius) return;
+			float newRadius = (sphere.radius + d) * 0.5f;
+			float t = (newRadius - sphere.radius) / d;
+			sphere = { Float3(c.x + (p.x - c.x) * t, c.y + (p.y - c.y) * t, c.z + (p.z - c.z) * t), newRadius };
+		}
+
+		// E߂(AABBɊOڂ鋅̕΂g)
+		MeshBounds Get() const {
+			MeshBounds bounds = {};
+			if (isEmpty) return bounds;
+
+			bounds.box = box;
+			const Float3 half((box.max.x - box.min.x) * 0.5f, (box.max.y - box.min.y) * 0.5f, (box.max.z - box.min.z) * 0.5f);
+			const Float3 center(box.min.x + half.x, box.min.y + half.y, box.min.z + half.z);
+			const float radius = std::sqrt(half.x * half.x + half.y * half.y + half.z * half.z);
+
+			// ۂߌ덷œ_킸ɂ͂ݏoȂ悤ɁAaL
+			bounds.sphere = sphere.radius < radius ? Sphere{ sphere.center, sphere.radius * (1.0f + 1e-5f) } : Sphere{ center, radius * (1.0f + 1e-5f) };
+			return bounds;
+		}
+	};
+
+	// --_WƂɁAŏɎgꂽeNX`UVƖ@xNg̑g̒_ԍ-- //
+	struct StreamSlot
+	{
+		uint32_t texcoord;// -> eNX`UṼCfbNX
+		uint32_t normal;// ---> @xNg̃CfbNX
+		uint32_t vertex;// ---> _ԍ(܂gĂȂObjIndex::None)
+	};
+
+	// --2ʂڈȍ~̑g̒_ԍ(I[vAhX@̃nbV\̗vf)-- //
+	struct StreamEntry
+	{
+		ObjIndex index;// --> CfbNX̑g
+		uint32_t vertex;// -> _ԍ(󂫂ȂObjIndex::None)
+	};
+
+	// --StreamObj󂯎Op`𒸓_ƃCfbNXɂāA`NƂɓn-- //
+	// _ԍ͑g߂ďoĂACfbNX̓}eAƂ͈̔͂ɎOp`̏ɏ(ǂMeshFromObjƓ)
+	class MeshStreamBuilder : public ObjStreamSink {
+	public:
+		MeshStreamBuilder(const ObjScan& scan, MeshStreamSink* sink) : scan_(scan), sink_(sink) {
+			slots_.resize(scan.positionCount, { ObjIndex::None, ObjIndex::None, ObjIndex::None });
+			entries_.resize(InitialEntryCount, { { ObjIndex::None, ObjIndex::None, ObjIndex::None }, ObjIndex::None });
+			vertexes_.reserve(MeshStreamChunkSize);
+			indexes_.reserve(MeshStreamChunkSize);
+
+			// }eAƂ̃CfbNX͈̔(}eAŏɏoĂɕׂ)
+			subsetStarts_.resize(scan.materialNames.size() + 1);
+			for (size_t i = 0; i < scan.materialNames.size(); i++) subsetStarts_[i + 1] = subsetStarts_[i] + scan.materialTriangles[i] * 3;
+			cursors_.assign(subsetStarts_.begin(), subsetStarts_.end() - 1);
+			subsetBounds_.resize(scan.materialNames.size());
+		}
+
+		// Op`󂯎
+		bool OnTriangles(const ObjData& obj, uint32_t material, const ObjIndex* corners, size_t triangleCount) override {
+			// }eAςAÕ}eÃCfbNXnĂ
+			if (material != indexMaterial_ && !FlushIndexes()) return false;
+			indexMaterial_ = material;
+
+			for (size_t i = 0; i < triangleCount * 3; i++) {
+				uint32_t vertex;
+				if (!FindVertex(obj, corners[i], &vertex)) return false;
+				subsetBounds_[material].Add(obj.positions[corners[i].position]);
+				indexes_.push_back(vertex);
+				if (indexes_.size() == MeshStreamChunkSize && !FlushIndexes()) return false;
+			}
+			return true;
+		}
+
+		// cnāA͈͂ƋElayoutɐݒ肷
+		bool Finish(MeshData* layout, size_t* vertexCount) {
+			if (!FlushIndexes() || !FlushVertexes()) return false;
+
+			// 1ڂ̑ƎOp`̐Ȃ΁ArŃt@CςĂ
+			for (size_t i = 0; i < cursors_.size(); i++) {
+				if (cursors_[i] != subsetStarts_[i + 1]) return false;
+			}
+
+			*layout = MeshData();
+			layout->materialNames = scan_.materialNames;
+			for (size_t i = 0; i < scan_.materialNames.size(); i++) {
+				layout->subsets.push_back({ static_cast<uint32_t>(i), static_cast<uint32_t>(subsetStarts_[i]),
+					static_cast<uint32_t>(subsetStarts_[i + 1] - subsetStarts_[i]), subsetBounds_[i].Get() });
+			}
+			layout->lods.push_back({ 0.0f, 0, static_cast<uint32_t>(layout->subsets.size()) });
+			layout->bounds = meshBounds_.Get();
+			*vertexCount = vertexCount_;
+			return true;
+		}
+
+	private:
+		static const size_t InitialEntryCount = 1024;// -> 2ʂڈȍ~̑g̃nbV\̍ŏ̑傫
+
+		// CfbNX̑g̒_ԍ߂(߂Ă̑gȂ璸_)
+		bool FindVertex(const ObjData& obj, const ObjIndex& index, uint32_t* vertex) {
+			if (index.position >= slots_.size()) return false;
+
+			// قƂǂ̒_W1ʂ̑głgȂ̂ŁA_WƂ̕\ɒׂ
+			StreamSlot& slot = slots_[index.position];
+			if (slot.vertex == ObjIndex::None) {
+				slot = { index.texcoord, index.normal, static_cast<uint32_t>(vertexCount_) };
+				return AddVertex(obj, index, vertex);
+			}
+			if (slot.texcoord == index.texcoord && slot.normal == index.normal) {
+				*vertex = slot.vertex;
+				return true;
+			}
+
+			// g邩A󂫂܂Ő`ɒT
+			const size_t mask = entries_.size() - 1;
+			for (size_t i = static_cast<size_t>(HashIndex(index)) & mask;; i = (i + 1) & mask) {
+				StreamEntry& entry = entries_[i];
+				if (entry.vertex == ObjIndex::None) {
+					entry = { index, static_cast<uint32_t>(vertexCount_) };
+					if (++entryCount_ * 2 > entries_.size()) GrowEntries();
+					return AddVertex(obj, index, vertex);
+				}
+				if (entry.index.position == index.position && entry.index.texcoord == index.texcoord && entry.index.normal == index.normal) {
+					*vertex = entry.vertex;
+					return true;
+				}
+			}
+		}
+
+		// _ă`Nɒǉ
+		bool AddVertex(const ObjData& obj, const ObjIndex& index, uint32_t* vertex) {
+			if (vertexCount_ >= ObjIndex::None) return false;
+
+			MeshVertex result;
+			result.pos = obj.positions[index.position];
+			if (index.normal != ObjIndex::None) result.normal = obj.normals[index.normal];
+			if (index.texcoord != ObjIndex::None) {
+				const Float2& texcoord = obj.texcoords[index.texcoord];
+				result.uv = Float2(texcoord.x, 1.0f - texcoord.y);// -> V]
+			}
+			meshBounds_.Add(result.pos);
+			vertexes_.push_back(result);
+			*vertex = static_cast<uint32_t>(vertexCount_++);
+			return vertexes_.size() < MeshStreamChunkSize || FlushVertexes();
+		}
+
+		// nbV\2{ɍLē꒼
+		void GrowEntries() {
+			std::vector<StreamEntry> entries(entries_.size() * 2, { { ObjIndex::None, ObjIndex::None, ObjIndex::None }, ObjIndex::None });
+			const size_t mask = entries.size() - 1;
+			for (const StreamEntry& entry : entries_) {
+				if (entry.vertex == ObjIndex::None) continue;
+				size_t i = static_cast<size_t>(HashIndex(entry.index)) & mask;
+				while (entries[i].vertex != ObjIndex::None) i = (i + 1) & mask;
+				entries[i] = entry;
+			}
+			entries_.swap(entries);
+		}
+
+		// `N̒_n
+		bool FlushVertexes() {
+			if (vertexes_.empty()) return true;
+			if (!sink_->WriteVertexes(vertexCount_ - vertexes_.size(), vertexes_.data(), vertexes_.size())) return false;
+			vertexes_.clear();
+			return true;
+		}
+
+		// `ÑCfbNXA}eA͈̔͂̑ɓn
+		bool FlushIndexes() {
+			if (indexes_.empty()) return true;
+			size_t& cursor = cursors_[indexMaterial_];
+			if (cursor + indexes_.size() > subsetStarts_[indexMaterial_ + 1]) return false;
+			if (!sink_->WriteIndexes(cursor, indexes_.data(), indexes_.size())) return false;
+			cursor += indexes_.size();
+			indexes_.clear();
+			return true;
+		}
+
+		const ObjScan& scan_;// ------------------------> 1ڂ̑̌
+		MeshStreamSink* sink_;// -----------------------> _ƃCfbNXn
+		std::vector<StreamSlot> slots_;// --------------> _WƂ̍ŏ̑g
+		std::vector<StreamEntry> entries_;// -----------> 2ʂڈȍ~̑g(vf2ׂ̂)
+		size_t entryCount_ = 0;// ----------------------> entries_ɓĂg̐
+		std::vector<MeshVertex> vertexes_;// -----------> ܂nĂȂ_
+		size_t vertexCount_ = 0;// ---------------------> _̐
+		std::vector<uint32_t> indexes_;// --------------> ܂nĂȂCfbNX(indexMaterial_͈̔͂̑)
+		uint32_t indexMaterial_ = ObjIndex::None;// -----> indexes_̃}eA
+		std::vector<size_t> subsetStarts_;// -----------> }eAƂ̃CfbNX͈̔͂̐擪(Ō͑Ŝ̐)
+		std::vector<size_t> cursors_;// ----------------> }eAƂ̎ɏވʒu
+		std::vector<StreamBounds> subsetBounds_;// -----> }eAƂ̎Op`̒_̋E
+		StreamBounds meshBounds_;// --------------------> ׂĂ̒_̋E
+	};
+}
+
+// --OBJ̃f[^璸_ƃCfbNX-- //
+MeshData MeshFromObj(const ObjData& obj)
+{
+	MeshData mesh;
+	mesh.indexes.resize(obj.indices.size());
+
+	// CfbNX̑g -> _ԍ ̃nbV\(I[vAhX@Avf2{ȏ2ׂ̂)
+	size_t capacity = 16;
+	while (capacity < obj.indices.size() * 2) capacity *= 2;
+	std::vector<uint32_t> table(capacity, ObjIndex::None);
+	std::vector<ObjIndex> unique;
+	unique.reserve(obj.indices.size() / 2);
+
+	for (size_t i = 0; i < obj.indices.size(); i++) {
+		const ObjIndex& index = obj.indices[i];
+		size_t slot = static_cast<size_t>(HashIndex(index)) & (capacity - 1);
+
+		// g邩A󂫂܂Ő`ɒT
+		for (;;) {
+			uint32_t vertex = table[slot];
+			if (vertex == ObjIndex::None) {
+				vertex = static_cast<uint32_t>(unique.size());
+				table[slot] = vertex;
+				unique.emplace_back(index);
+				mesh.indexes[i] = vertex;
+				break;
+			}
+			const ObjIndex& other = unique[vertex];
+			if (other.position == index.position && other.texcoord == index.texcoord && other.normal == index.normal) {
+				mesh.indexes[i] = vertex;
+				break;
+			}
+			slot = (slot + 1) & (capacity - 1);
+		}
+	}
+
+	// --Op`}eAƂɂ܂Ƃ߂-- //
+	// usemtl͈̔͂Op`Ƃ̃}eAԍ߂(O͍ŏɏoĂԍɂ)
+	const size_t triangleCount = obj.indices.size() / 3;
+	std::vector<uint32_t> triangleMaterial(triangleCount);
+	std::unordered_map<std::string, uint32_t> materialIndex;
+	std::vector<size_t> materialTriangles;// -> }eAƂ̎Op`
+	for (size_t r = 0, triangle = 0; triangle < triangleCount; r++) {
+		// rԖڂ͈̔͂[usemtls[r - 1].indexFirst, usemtls[r].indexFirst)(r == 0 ͍ŏusemtlO)
+		size_t last = r < obj.usemtls.size() ? obj.usemtls[r].indexFirst / 3 : triangleCount;
+		if (last > triangleCount) last = triangleCount;
+		if (triangle >= last) continue;
+
+		const std::string& name = r == 0 ? std::string() : obj.usemtls[r - 1].material;
+		auto inserted = materialIndex.emplace(name, static_cast<uint32_t>(mesh.materialNames.size()));
+		if (inserted.second) {
+			mesh.materialNames.push_back(name);
+			materialTriangles.push_back(0);
+		}
+		uint32_t material = inserted.first->second;
+		materialTriangles[material] += last - triangle;
+		for (; triangle < last; triangle++) triangleMaterial[triangle] = material;
+	}
+
+	// }eA2ȏ゠Ƃבւ(v\[gȂ̂Ń}eȀԂ͕ςȂ)
+	mesh.subsets.resize(mesh.materialNames.size());
+	size_t start = 0;
+	for (size_t i = 0; i < mesh.subsets.size(); i++) {
+		mesh.subsets[i] = { static_cast<uint32_t>(i), static_cast<uint32_t>(start), static_cast<uint32_t>(materialTriangles[i] * 3), MeshBounds{} };
+		start += materialTriangles[i] * 3;
+	}
+	if (mesh.subsets.size() > 1) {
+		std::vector<uint32_t> sorted(mesh.indexes.size());
+		std::vector<size_t> cursor(mesh.subsets.size());
+		for (size_t i = 0; i < cursor.size(); i++) cursor[i] = mesh.subsets[i].indexStart;
+		for (size_t triangle = 0; triangle < triangleCount; triangle++) {
+			size_t& dst = cursor[triangleMaterial[triangle]];
+			sorted[dst + 0] = mesh.indexes[triangle * 3 + 0];
+			sorted[dst + 1] = mesh.indexes[triangle * 3 + 1];
+			sorted[dst + 2] = mesh.indexes[triangle * 3 + 2];
+			dst += 3;
+		}
+		mesh.indexes.swap(sorted);
+	}
+
+	// _łLOD͌̃bV
+	mesh.lods.push_back({ 0.0f, 0, static_cast<uint32_t>(mesh.subsets.size()) });
+
+	// d̂Ȃg璸_f[^
+	mesh.vertexes.resize(unique.size());
+	for (size_t i = 0; i < unique.size(); i++) {
+		const ObjIndex& index = unique[i];
+		MeshVertex& vertex = mesh.vertexes[i];
+
+		vertex.pos = obj.positions[index.position];
+		if (index.normal != ObjIndex::None) vertex.normal = obj.normals[index.normal];
+		if (index.texcoord != ObjIndex::None) {
+			const Float2& texcoord = obj.texcoords[index.texcoord];
+			vertex.uv = Float2(texcoord.x, 1.0f - texcoord.y);// -> V]
+		}
+	}
+
+	return mesh;
+}
+
+// --OBJt@C͂āA_ƃCfbNX`NƂsink֓n-- //
+bool MeshFromObjStream(const char* begin, const char* end, const ObjScan& scan, MeshStreamSink* sink, MeshData* layout, size_t* vertexCount)
+{
+	MeshStreamBuilder builder(scan, sink);
+	return StreamObj(begin, end, scan, &builder) && builder.Finish(layout, vertexCount);
+}
+
+// --Xg[~Oǂݍ݂ł̒_̏-- //
+size_t MeshStreamMaxVertexCount(const ObjScan& scan)
+{
+	// _͎Op`̊p̐ƁA(_W, eNX`UV, @xNg)̑gݍ킹̐𒴂Ȃ
+	const size_t cornerCount = scan.triangleCount * 3;
+	const size_t factors[] = { scan.positionCount, std::max<size_t>(scan.texcoordCount, 1), std::max<size_t>(scan.normalCount, 1) };
+	size_t combinations = 1;
+	for (size_t factor : factors) {
+		combinations = factor != 0 && combinations > cornerCount / factor ? cornerCount : combinations * factor;
+	}
+	return std::min(cornerCount, combinations);
+}
+
+// --Xg[~Oǂݍ݂Ŋmۂ郁̌ς-- //
+size_t MeshStreamMemorySize(const ObjScan& scan)
+{
+	return scan.positionCount * (sizeof(Float3) + sizeof(StreamSlot)) + scan.texcoordCount * sizeof(Float2) + scan.normalCount * sizeof(Float3) +
+		MeshStreamChunkSize * (sizeof(MeshVertex) + sizeof(uint32_t));
+}
+
+// --߂l̒_1ɂ܂Ƃ߂-- //
+void MeshWeld(MeshData* mesh, float epsilon)
+{
+	if (!(epsilon > 0.0f)) return;
+
+	// WepsilonԊůiqɕāAאڂ27}Xɂ\̒_Ƃׂ
+	// }X̔ԍׂ͗𑫂Ăint64_tɎ܂悤Ɂ}2^62Ŏ~߂(NaN[ɓ)B}XɏW܂ĂŊm߂̂Ōʂ͕ςȂ
+	const double cellLimit = 4611686018427387904.0;
+	auto cellOf = [epsilon, cellLimit](float v) {
+		double cell = std::floor(static_cast<double>(v) / epsilon);
+		if (!(cell > -cellLimit)) cell = -cellLimit;
+		if (cell > cellLimit) cell = cellLimit;
+		return static_cast<int64_t>(cell);
+	};
+	auto cellKey = [](int64_t x, int64_t y, int64_t z) {
+		return HashMix(static_cast<uint64_t>(x) * 73856093u ^ static_cast<uint64_t>(y) * 19349663u ^ static_cast<uint64_t>(z) * 83492791u);
+	};
+
+	std::unordered_multimap<uint64_t, uint32_t> cells;
+	cells.reserve(mesh->vertexes.size());
+	std::vector<uint32_t> remap(mesh->vertexes.size());
+	std::vector<MeshVertex> welded;
+	welded.reserve(mesh->vertexes.size());
+
+	for (size_t i = 0; i < mesh->vertexes.size(); i++) {
+		const MeshVertex& vertex = mesh->vertexes[i];
+		int64_t cx = cellOf(vertex.pos.x), cy = cellOf(vertex.pos.y), cz = cellOf(vertex.pos.z);
+
+		uint32_t found = ObjIndex::None;
+		for (int64_t dz = -1; dz <= 1 && found == ObjIndex::None; dz++) {
+			for (int64_t dy = -1; dy <= 1 && found == ObjIndex::None; dy++) {
+				for (int64_t dx = -1; dx <= 1 && found == ObjIndex::None; dx++) {
+					auto range = cells.equal_range(cellKey(cx + dx, cy + dy, cz + dz));
+					for (auto it = range.first; it != range.second; ++it) {
+						if (IsNear(welded[it->second], vertex, epsilon)) {
+							found = it->second;
+							break;
+						}
+					}
+				}
+			}
+		}
+
+		if (found == ObjIndex::None) {
+			found = static_cast<uint32_t>(welded.size());
+			welded.emplace_back(vertex);
+			cells.emplace(cellKey(cx, cy, cz), found);
+		}
+		remap[i] = found;
+	}
+
+	for (uint32_t& index : mesh->indexes) index = remap[index];
+	mesh->vertexes.swap(welded);
+}
+
+// --bVŜƃTuZbgƂ̋E߂-- //
+void MeshComputeBounds(MeshData* mesh)
+{
+	mesh->bounds = MeshComputeBounds(mesh->vertexes.data(), nullptr, mesh->vertexes.size());
+	for (MeshSubset& subset : mesh->subsets) {
+		subset.bounds = MeshComputeBounds(mesh->vertexes.data(), mesh->indexes.data() + subset.indexStart, subset.indexCount);
+	}
+}
+
+// --CfbNXw_͂ދE߂-- //
+MeshBounds MeshComputeBounds(const MeshVertex* vertexes, const uint32_t* indexes, size_t count)
+{
+	MeshBounds bounds = {};
+	if (count == 0) return bounds;
+
+	auto point = [vertexes, indexes](size_t i) -> const Float3& { return vertexes[indexes ? indexes[i] : i].pos; };
+	auto distanceSq = [](const Float3& a, const Float3& b) {
+		float x = a.x - b.x, y = a.y - b.y, z = a.z - b.z;
+		return x * x + y * y + z * z;
+	};
+
+	// --AABBƁAeňԊOɂ_-- //
+	Float3 min = point(0), max = point(0);
+	size_t minIndex[3] = {}, maxIndex[3] = {};
+	for (size_t i = 1; i < count; i++) {
+		const Float3& p = point(i);
+		if (p.x < min.x) { min.x = p.x; minIndex[0] = i; }
+		if (p.y < min.y) { min.y = p.y; minIndex[1] = i; }
+		if (p.z < min.z) { min.z = p.z; minIndex[2] = i; }
+		if (p.x > max.x) { max.x = p.x; maxIndex[0] = i; }
+		if (p.y > max.y) { max.y = p.y; maxIndex[1] = i; }
+		if (p.z > max.z) { max.z = p.z; maxIndex[2] = i; }
+	}
+	bounds.box = { min, max };
+
+	// --AABB̒Sg-- //
+	const Float3 center((min.x + max.x) * 0.5f, (min.y + max.y) * 0.5f, (min.z + max.z) * 0.5f);
+	float radiusSq = 0.0f;
+	for (size_t i = 0; i < count; i++) radiusSq = std::max(radiusSq, distanceSq(point(i), center));
+
+	// --Ritter̕@(ԗꂽ̗[̓_𒼌aɂāAOɂ_܂ނ悤ɍL)-- //
+	int axis = 0;
+	float axisLengthSq = 0.0f;
+	for (int k = 0; k < 3; k++) {
+		float lengthSq = distanceSq(point(minIndex[k]), point(maxIndex[k]));
+		if (lengthSq > axisLengthSq) {
+			axisLengthSq = lengthSq;
+			axis = k;
+		}
+	}
+	const Float3& a = point(minIndex[axis]);
+	const Float3& b = point(maxIndex[axis]);
+	Float3 ritterCenter((a.x + b.x) * 0.5f, (a.y + b.y) * 0.5f, (a.z + b.z) * 0.5f);
+	float ritterRadius = std::sqrt(axisLengthSq) * 0.5f;
+	for (size_t i = 0; i < count; i++) {
+		const Float3& p = point(i);
+		float d = std::sqrt(distanceSq(p, ritterCenter));
+		if (d <= ritterRadius) continue;
+
+		// S_̕ւ炵āA̋Ɠ_̗܂ދɂ
+		float newRadius = (ritterRadius + d) * 0.5f;
+		float t = (newRadius - ritterRadius) / d;
+		ritterCenter = Float3(ritterCenter.x + (p.x - ritterCenter.x) * t, ritterCenter.y + (p.y - ritterCenter.y) * t, ritterCenter.z + (p.z - ritterCenter.z) * t);
+		ritterRadius = newRadius;
+	}
+
+	// g(ۂߌ덷œ_킸ɂ͂ݏoȂ悤ɁAaL)
+	ritterRadius *= 1.0f + 1e-5f;
+	float radius = std::sqrt(radiusSq) * (1.0f + 1e-5f);
+	bounds.sphere = ritterRadius < radius ? Sphere{ ritterCenter, ritterRadius } : Sphere{ center, radius };
+	return bounds;
+}
+
+// --LOD̃CfbNX͈̔͂̏I-- //
+size_t MeshLodIndexEnd(const MeshData& mesh, size_t lod)
+{
+	if (lod >= mesh.lods.size()) return mesh.indexes.size();
+
+	size_t end = 0;
+	for (uint32_t i = 0; i < mesh.lods[lod].subsetCount; i++) {
+		const MeshSubset& subset = mesh.subsets[mesh.lods[lod].subsetStart + i];
+		end = std::max<size_t>(end, subset.indexStart + subset.indexCount);
+	}
+	return end;
+}
+
+// --CfbNXw肵oCgŏ-- //
+void MeshWriteIndexes(void* dst, const uint32_t* src, size_t count, size_t stride)
+{
+	if (stride == sizeof(uint32_t)) {
+		std::memcpy(dst, src, count * sizeof(uint32_t));
+		return;
+	}
+
+	uint16_t* dst16 = static_cast<uint16_t*>(dst);
+	for (size_t i = 0; i < count; i++) {
+		assert(src[i] <= 0xffff);
+		dst16[i] = static_cast<uint16_t>(src[i]);
+	}
+}
@@ -0,0 +1,125 @@
+#pragma once
+#include "Float2.h"
+#include "Float3.h"
+#include "CollisionPrimitive.h"
+#include "ObjLoader.h"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// --_f[^(Model.hVertex3DƓ)-- //
+struct MeshVertex
+{
+	Float3 pos;// ----> W
+	Float3 normal;// -> @
+	Float2 uv;// -----> UVW
+};
+
+// --_͂ދE(f̍Wn)-- //
+struct MeshBounds
+{
+	AABB box;// -------> _͂ލŏAABB
+	Sphere sphere;// --> _͂ދ(AABB̒SĝRitter̕@̂A)
+};
+
+// --}eAŕ`悷CfbNX͈̔-- //
+struct MeshSubset
+{
+	uint32_t material;// ----> MeshData::materialNames̔ԍ
+	uint32_t indexStart;// --> ŏ̃CfbNẌʒu
+	uint32_t indexCount;// --> CfbNX
+	MeshBounds bounds;// ----> ͈͂̎Op`̒_͂ދE(MeshComputeBoundsŋ߂)
+};
+
+// --ڍדx(LOD)Ƃ̃TuZbg͈̔-- //
+struct MeshLod
+{
+	float error;// -----------> ̃bV̌덷(f̍Wnł̋ALOD00)
+	uint32_t subsetStart;// --> MeshData::subsetsł̍ŏ̈ʒu
+	uint32_t subsetCount;// --> TuZbg
+};
+
+// --NX^(bVbg)1ɓ钸_ƎOp`̏-- //
+const size_t MeshletMaxVertices = 64;
+const size_t MeshletMaxTriangles = 124;
+
+// --CfbNX̘A͈͂(◠ł܂Ƃ߂ăJOP)-- //
+struct Meshlet
+{
+	Sphere bounds;// -------> Op`͂ދ
+	Float3 coneAxis;// -----> Op`̖@(\)͂މ~̎(Kς)
+	float coneCutoff;// ----> ~̍Lsin(L肪90xȏȂ1ŁAɂ͂ȂȂ)
+	uint32_t indexStart;// -> ŏ̃CfbNẌʒu
+	uint32_t indexCount;// -> CfbNX
+};
+
+// --_ƃCfbNX̑g-- //
+struct MeshData
+{
+	std::vector<MeshVertex> vertexes;// ---------> _f[^(dȂ)
+	std::vector<uint32_t> indexes;// ------------> CfbNXf[^(}eA̎Op`A悤ɕׂ)
+	std::vector<std::string> materialNames;// ---> gĂ}eA(usemtl̑O̖ʂ"")
+	std::vector<MeshSubset> subsets;// ----------> }eAƂ͈̔(LODƂ1}eAɂ1)
+	std::vector<MeshLod> lods;// ----------------> LODƂsubsets͈̔(擪̃bV)
+	std::vector<Meshlet> meshlets;// ------------> TuZbg𕪂NX^(CfbNẌʒȕ)
+	MeshBounds bounds;// ------------------------> ׂĂ̒_͂ދE(MeshComputeBoundsŋ߂)
+};
+
+// --OBJ̃f[^璸_ƃCfbNX-- //
+// --(_W, eNX`UV, @xNg)̃CfbNX̑g_1ɂ܂Ƃ߂-- //
+// --eNX`UVV𔽓]-- //
+// --Op`usemtl̃}eAƂɂ܂Ƃ߂āAŏɏoĂ}eȀɕׂ(}eȀԂ͕ςȂ)-- //
+MeshData MeshFromObj(const ObjData& obj);
+
+// --Xg[~Oǂݍ(MeshFromObjStream)Œ_ƃCfbNX󂯎-- //
+class MeshStreamSink {
+public:
+	virtual ~MeshStreamSink() = default;
+
+	// _󂯎(first͍ŏ̒_̔ԍA_͔ԍ̏ɓnAfalseԂƓǂݍ݂𒆒f)
+	virtual bool WriteVertexes(size_t first, const MeshVertex* vertexes, size_t count) = 0;
+
+	// CfbNX󂯎(first̓}eAƂɂ܂Ƃ߂̈ʒuAʒȕɓnƂ͌Ȃ)
+	virtual bool WriteIndexes(size_t first, const uint32_t* indexes, size_t count) = 0;
+};
+
+// --MeshFromObjStreamňxɓn_ƃCfbNX̏-- //
+const size_t MeshStreamChunkSize = 65536;
+
+// --OBJt@CStreamObjŏ͂āA_ƃCfbNX`NƂsink֓n(Xg[~Oǂݍ݂2)-- //
+// --_ƃCfbNXMeshFromObjƓɂȂ(weldEpsilonł̂܂Ƃ߁ALODAœKANX^͑ŜKvȂ̂ōsȂ)-- //
+// --layoutɂmaterialNamesAsubsetsAlodsAboundsݒ肵(vertexesAindexes͋)A_vertexCountɕԂ-- //
+// --E̋AABBɊOڂ鋅ƁA_Ɋ܂ނ悤ɍL̂(MeshComputeBounds菭傫Ȃ邱Ƃ)-- //
+bool MeshFromObjStream(const char* begin, const char* end, const ObjScan& scan, MeshStreamSink* sink, MeshData* layout, size_t* vertexCount);
+
+// --Xg[~Oǂݍ݂ł̒_̏(CfbNX̃oCgɌ߂̂Ɏg)-- //
+size_t MeshStreamMaxVertexCount(const ObjScan& scan);
+
+// --Xg[~Oǂݍ݂Ŋmۂ郁̌ς[oCg]-- //
+// --_WAeNX`UVA@xNgA_WƂ̏dmF̕\A`N̍v(1ubN̖ʂ͊܂܂Ȃ)-- //
+// --1̒_W2ʂȏUVƖ@̑gŎgꍇ́A2ʂڈȍ~̕ʂ̕\-- //
+// --t@CŜƂׂĂ̖ʂLoadObj + MeshFromObj菭ȂOɌς邪A_WȂǂ̐ɔႷ̂ňł͂Ȃ-- //
+size_t MeshStreamMemorySize(const ObjScan& scan);
+
+// --WA@AUV̊eׂ̍epsilonȉ̒_1ɂ܂Ƃ߂-- //
+// --܂Ƃ߂_͍ŏɏoĂ̂̒lg-- //
+void MeshWeld(MeshData* mesh, float epsilon);
+
+// --bVŜƃTuZbgƂ̋E߂-- //
+// --_̍WƃTuZbg͈̔͂ςȂ̌ȂAĂłʂɂȂ(ǂݍ݂ł͍Ō1񂾂Ă)-- //
+void MeshComputeBounds(MeshData* mesh);
+
+// --CfbNXw_͂ދE߂(indexesnullptrȂ擪count̒_g)-- //
+MeshBounds MeshComputeBounds(const MeshVertex* vertexes, const uint32_t* indexes, size_t count);
+
+// --LOD̃CfbNX͈̔͂̏I(LOD̃TuZbg̒ňԌ̈ʒuALOD΃CfbNX)-- //
+size_t MeshLodIndexEnd(const MeshData& mesh, size_t lod);
+
+// --CfbNX1̃oCg߂-- //
+// --_65536ȉ(ő̃CfbNX0xffffȉ)Ȃ16bitAȏȂ32bit-- //
+constexpr size_t MeshIndexStride(size_t vertexCount) { return vertexCount <= 0x10000 ? sizeof(uint16_t) : sizeof(uint32_t); }
+static_assert(MeshIndexStride(0xFFFF) == 2 && MeshIndexStride(0x10000) == 2 && MeshIndexStride(0x10001) == 4, "index stride boundary");
+
+// --CfbNXstrideoCg(24)l߂dstɏ-- //
+void MeshWriteIndexes(void* dst, const uint32_t* src, size_t count, size_t stride);
@@ -0,0 +1,691 @@
+#include "MeshCodec.h"
+#include "fSIMD.h"
+#include <cassert>
+#include <cstring>
+
+namespace {
+	// --ubN̑傫(LZ̎QƋ16bitɎ܂AWJ悪L2LbVɎ܂傫)-- //
+	const size_t IndexBlockCount = 16384;// -> CfbNX̃ubNɓ鐔
+	const size_t VertexBlockBytes = 65536;// -> _̃ubN̍őoCg
+
+	// --l߂P(16oCg̃O[v)-- //
+	// O[v1oCgbit2bit̕ŕ\A4O[v1oCgɂ܂Ƃ߂ăO[v̑Oɒu
+	const size_t GroupSize = 16;
+	const size_t PackBits[4] = { 0, 2, 4, 8 };// ----> Ƃ1oCgbit
+	const size_t GroupBytes[4] = { 0, 4, 8, 16 };// -> Ƃ̋l߂O[ṽoCg
+
+	// --LZk̐ݒ-- //
+	const size_t LzMinMatch = 4;// ------------> vƂ݂ȂŒZ̒
+	const size_t LzMaxOffset = 65535;// -------> QƂłő̋
+	const int LzHashBits = 14;// --------------> vTnbV\̑傫(2ׂ̂)
+	const size_t LzSlack = 16;// --------------> WJ̌Ɋmۂ](܂Ƃ߂ăRs[Ƃ̂͂ݏo)
+	const size_t LzMinSequenceBytes = 64;// ---> LZkgA1̓WJ̃oCg̉(ZтƓWJxȂ)
+
+	// --4oCgǂݍ-- //
+	inline uint32_t Read32(const uint8_t* p) {
+		uint32_t value;
+		std::memcpy(&value, p, sizeof(value));
+		return value;
+	}
+
+	// --8oCgRs[(Rs[ƃRs[悪dȂĂĂ悢)-- //
+	inline void Copy8(uint8_t* dst, const uint8_t* src) {
+		uint64_t value;
+		std::memcpy(&value, src, sizeof(value));
+		std::memcpy(dst, &value, sizeof(value));
+	}
+
+	// --WOUO(0, -1, 1, -2c0, 1, 2, 3cɂ)-- //
+	inline uint32_t Zigzag(uint32_t delta) { return (delta << 1) ^ (0u - (delta >> 31)); }
+	inline uint32_t Unzigzag(uint32_t value) { return (value >> 1) ^ (0u - (value & 1)); }
+
+	// --O[v̕̕o-- //
+	inline unsigned GroupCode(const uint8_t* header, size_t group) { return header[group / 4] >> (group % 4 * 2) & 3; }
+
+	// --ϒ(7bitAŏbiẗ)-- //
+	void WriteVarint(std::vector<uint8_t>* dst, uint64_t value) {
+		while (value >= 0x80) {
+			dst->push_back(static_cast<uint8_t>(value | 0x80));
+			value >>= 7;
+		}
+		dst->push_back(static_cast<uint8_t>(value));
+	}
+
+	bool ReadVarint(const uint8_t** src, const uint8_t* end, uint64_t* value) {
+		const uint8_t* p = *src;
+		uint64_t result = 0;
+		for (int shift = 0; shift < 64; shift += 7) {
+			if (p == end) return false;
+			uint8_t byte = *p++;
+			result |= static_cast<uint64_t>(byte & 0x7f) << shift;
+			if (byte < 0x80) {
+				*src = p;
+				*value = result;
+				return true;
+			}
+		}
+		return false;
+	}
+
+	// --LZ̒̑(255A255̒lŏI)-- //
+	void WriteLzLength(std::vector<uint8_t>* dst, size_t length) {
+		for (; length >= 255; length -= 255) dst->push_back(255);
+		dst->push_back(static_cast<uint8_t>(length));
+	}
+
+	// --LZk(LZ4Ɠ`̕сAт̐Ԃ)-- //
+	// [g[N(4bit:eA4bit:v - 4)][ȇ][e][(2oCg)][v̑]JԂA
+	// Ō̓eŏI
+	size_t LzCompress(const uint8_t* src, size_t size, std::vector<uint32_t>* table, std::vector<uint8_t>* dst) {
+		table->assign(size_t(1) << LzHashBits, 0);
+		auto hash = [](uint32_t value) { return (value * 2654435761u) >> (32 - LzHashBits); };
+
+		size_t anchor = 0, i = 0, misses = 0, sequences = 1;
+		while (i + LzMinMatch <= size) {
+			// OɏoĂ4oCgT(\ɂ͈ʒu + 1A0͋)
+			uint32_t& slot = (*table)[hash(Read32(src + i))];
+			size_t candidate = slot;
+			slot = static_cast<uint32_t>(i + 1);
+			size_t match = candidate - 1, length = 0;
+			if (candidate != 0 && i - match <= LzMaxOffset && Read32(src + match) == Read32(src + i)) {
+				// vL΂
+				length = 4;
+				while (i + length < size && src[match + length] == src[i + length]) length++;
+			}
+			if (length < LzMinMatch) {
+				// vȂԂ͏΂ĒT(kłȂf[^ŎԂȂ)
+				i += 1 + (misses++ >> 6);
+				continue;
+			}
+			misses = 0;
+
+			// OɂL΂邾L΂(eAт̐)
+			while (i > anchor && match > 0 && src[i - 1] == src[match - 1]) {
+				i--;
+				match--;
+				length++;
+			}
+
+			const size_t literals = i - anchor, extra = length - LzMinMatch;
+			dst->push_back(static_cast<uint8_t>((literals < 15 ? literals : 15) << 4 | (extra < 15 ? extra : 15)));
+			if (literals >= 15) WriteLzLength(dst, literals - 15);
+			dst->insert(dst->end(), src + anchor, src + i);
+			const size_t offset = i - match;
+			dst->push_back(static_cast<uint8_t>(offset));
+			dst->push_back(static_cast<uint8_t>(offset >> 8));
+			if (extra >= 15) WriteLzLength(dst, extra - 15);
+			sequences++;
+
+			i += length;
+			anchor = i;
+		}
+
+		// ceƂď
+		const size_t literals = size - anchor;
+		dst->push_back(static_cast<uint8_t>((literals < 15 ? literals : 15) << 4));
+		if (literals >= 15) WriteLzLength(dst, literals - 15);
+		dst->insert(dst->end(), src + anchor, src + size);
+		return sequences;
+	}
+
+	// --LZWJ(dsťɂLzSlackoCg̗]Kv)-- //
+	bool LzDecompress(const uint8_t* src, size_t size, uint8_t* dst, size_t dstSize) {
+		const uint8_t* ip = src;
+		const uint8_t* const iend = src + size;
+		uint8_t* op = dst;
+		uint8_t* const oend = dst + dstSize;
+
+		for (;;) {
+			if (ip == iend) return false;
+			const unsigned token = *ip++;
+
+			// --e-- //
+			size_t literals = token >> 4;
+			if (literals < 15 && iend - ip >= 16 && literals <= static_cast<size_t>(oend - op)) {
+				// Ze͒Ɋ֌WȂ16oCg܂Ƃ߂ăRs[(]ɂ͂ݏo)
+				std::memcpy(op, ip, 16);
+			}
+			else {
+				if (literals == 15) {
+					unsigned byte;
+					do {
+						if (ip == iend) return false;
+						byte = *ip++;
+						literals += byte;
+					} while (byte == 255);
+				}
+				if (literals > static_cast<size_t>(iend - ip) || literals > static_cast<size_t>(oend - op)) return false;
+				std::memcpy(op, ip, literals);
+			}
+			op += literals;
+			ip += literals;
+
+			// Ō̃eœ͂I
+			if (ip == iend) return op == oend;
+
+			// --v-- //
+			if (iend - ip < 2) return false;
+			const size_t offset = ip[0] | static_cast<size_t>(ip[1]) << 8;
+			ip += 2;
+			if (offset == 0 || offset > static_cast<size_t>(op - dst)) return false;
+
+			size_t length = token & 15;
+			if (length == 15) {
+				unsigned byte;
+				do {
+					if (ip == iend) return false;
+					byte = *ip++;
+					length += byte;
+				} while (byte == 255);
+			}
+			length += LzMinMatch;
+			if (length > static_cast<size_t>(oend - op)) return false;
+
+			// ܂Ƃ߂ăRs[(Ō͗]ɂ͂ݏo)
+			const uint8_t* match = op - offset;
+			if (offset >= 16) {
+				for (size_t k = 0; k < length; k += 16) std::memcpy(op + k, match + k, 16);
+			}
+			else if (offset == 1) {
+				// oCǧJԂ͑̂Ŗ߂邾ɂ
+				std::memset(op, *match, length);
+			}
+			else if (offset >= 8) {
+				for (size_t k = 0; k < length; k += 8) Copy8(op + k, match + k);
+			}
+			else {
+				// 8ȂAŏ8oCg1oCgAƂ͋̔{(8ȉōő)O8oCgRs[
+				for (size_t k = 0; k < 8; k++) op[k] = match[k];
+				const size_t step = offset * (8 / offset);
+				for (size_t k = step; k < length; k += step) Copy8(op + k, op + k - step);
+			}
+			op += length;
+		}
+	}
+
+	// --1ubNo-- //
+	// LZk1/8ȏk܂ȂAтZēWJxȂꍇ͂̂܂܊i[
+	void WriteBlock(const uint8_t* data, size_t size, std::vector<uint32_t>* table, std::vector<uint8_t>* compressed, std::vector<uint8_t>* dst) {
+		compressed->clear();
+		const size_t sequences = LzCompress(data, size, table, compressed);
+
+		WriteVarint(dst, size);
+		if (compressed->size() < size - size / 8 && size >= sequences * LzMinSequenceBytes) {
+			WriteVarint(dst, compressed->size() * 2 + 1);
+			dst->insert(dst->end(), compressed->begin(), compressed->end());
+		}
+		else {
+			WriteVarint(dst, size * 2);
+			dst->insert(dst->end(), data, data + size);
+		}
+	}
+
+	// --1ubNǂݍ(WJf[^̈ʒuƃoCgԂAscratcȟɂLzSlackoCg̗]mۂ)-- //
+	bool ReadBlock(const uint8_t** src, const uint8_t* end, std::vector<uint8_t>* scratch, const uint8_t** data, size_t* size) {
+		uint64_t decodedSize, stored;
+		if (!ReadVarint(src, end, &decodedSize) || !ReadVarint(src, end, &stored)) return false;
+		const uint64_t storedSize = stored >> 1;
+		if (storedSize > static_cast<uint64_t>(end - *src)) return false;
+
+		if (stored & 1) {
+			if (decodedSize > VertexBlockBytes * 2) return false;// -> ubN̑傫𒴂͉̂Ă
+			if (scratch->size() < decodedSize + LzSlack) scratch->resize(static_cast<size_t>(decodedSize) + LzSlack);
+			if (!LzDecompress(*src, static_cast<size_t>(storedSize), scratch->data(), static_cast<size_t>(decodedSize))) return false;
+			*data = scratch->data();
+		}
+		else {
+			if (storedSize != decodedSize) return false;
+			*data = *src;// -> ̂܂܊i[Ă΃Rs[Ȃ
+		}
+		*size = static_cast<size_t>(decodedSize);
+		*src += storedSize;
+		return true;
+	}
+
+	// --O[v(16oCg)̕̕I-- //
+	inline unsigned PackCode(uint8_t bits) { return bits == 0 ? 0 : bits < 4 ? 1 : bits < 16 ? 2 : 3; }
+
+	// --O[v(16oCg)1oCgbit낦ċl߁A̕Ԃ(bit珇ɋl߂)-- //
+	unsigned PackGroup(const uint8_t* values, std::vector<uint8_t>* dst) {
+		uint8_t bits = 0;
+		for (size_t k = 0; k < GroupSize; k++) bits |= values[k];
+
+		const unsigned code = PackCode(bits);
+		const size_t width = PackBits[code];
+		if (width == 0) return code;
+		const size_t perByte = 8 / width;
+		for (size_t k = 0; k < GroupSize; k += perByte) {
+			uint8_t byte = 0;
+			for (size_t b = 0; b < perByte; b++) byte |= static_cast<uint8_t>(values[k + b] << (b * width));
+			dst->push_back(byte);
+		}
+		return code;
+	}
+
+	// --l߂O[v(16oCg)߂-- //
+	void UnpackGroupScalar(const uint8_t* p, unsigned code, uint8_t* out) {
+		switch (code) {
+		case 0:
+			std::memset(out, 0, GroupSize);
+			break;
+		case 1:
+			for (size_t k = 0; k < 4; k++) {
+				out[k * 4] = p[k] & 3;
+				out[k * 4 + 1] = p[k] >> 2 & 3;
+				out[k * 4 + 2] = p[k] >> 4 & 3;
+				out[k * 4 + 3] = p[k] >> 6;
+			}
+			break;
+		case 2:
+			for (size_t k = 0; k < 8; k++) {
+				out[k * 2] = p[k] & 15;
+				out[k * 2 + 1] = p[k] >> 4;
+			}
+			break;
+		default:
+			std::memcpy(out, p, GroupSize);
+			break;
+		}
+	}
+
+#if defined(FMATH_SSE)
+	// --̕ƂɁA2bitA4bitA8bit̂ǂꂩ߂lg̑I}XN-- //
+	const __m128i PackSelect[4][3] = {
+		{ _mm_setzero_si128(), _mm_setzero_si128(), _mm_setzero_si128() },
+		{ _mm_set1_epi8(-1), _mm_setzero_si128(), _mm_setzero_si128() },
+		{ _mm_setzero_si128(), _mm_set1_epi8(-1), _mm_setzero_si128() },
+		{ _mm_setzero_si128(), _mm_setzero_si128(), _mm_set1_epi8(-1) },
+	};
+
+	// --l߂O[v(16oCg)߂(p16oCgǂݍ߂邱)-- //
+	// 3ʂ̖߂ׂČvZĕőI(̗\OȂ悤ɂ)
+	// 4bit͉ʂƏʂ݂ɕׁA2bit4bitɖ߂̂ɓ悤ɕ(1oCgɓ42bit̏Ԃ̂܂ܕۂ)
+	inline __m128i UnpackGroup(const uint8_t* p, unsigned code) {
+		const __m128i mask2 = _mm_set1_epi8(3), mask4 = _mm_set1_epi8(15);
+		const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+		const __m128i x4 = _mm_unpacklo_epi8(_mm_and_si128(b, mask4), _mm_and_si128(_mm_srli_epi16(b, 4), mask4));
+		const __m128i x2 = _mm_unpacklo_epi8(_mm_and_si128(x4, mask2), _mm_and_si128(_mm_srli_epi16(x4, 2), mask2));
+
+		const __m128i* select = PackSelect[code];
+		__m128i x = _mm_and_si128(b, select[2]);
+		x = _mm_or_si128(x, _mm_and_si128(x4, select[1]));
+		return _mm_or_si128(x, _mm_and_si128(x2, select[0]));
+	}
+#endif
+
+	// --̕̕тAl߂f[^̃oCg߂-- //
+	size_t PackedSize(const uint8_t* header, size_t codes) {
+		size_t size = 0;
+		for (size_t c = 0; c < codes; c++) size += GroupBytes[GroupCode(header, c)];
+		return size;
+	}
+
+	// --1ubÑCfbNX̍AO[v(16)̃oCgƂɋl߂ĕׂ-- //
+	// [̕(2bit x O[v x CfbNX̃oCg)][O[vƂɁAWOUO0oCgځA1oCgځcl߂]
+	// Ō̃O[v̑Ȃ͍0ɂ
+	// 16bit̃CfbNX͍16bitŋ߂(߂Ƃ16bit̂܂ܑA͈͂o邱ƂȂ)
+	void FilterIndexes(const void* indexes, size_t first, size_t last, size_t stride, uint32_t* previous, std::vector<uint8_t>* dst) {
+		const size_t groups = (last - first + GroupSize - 1) / GroupSize;
+		dst->assign((groups * stride + 3) / 4, 0);
+		for (size_t g = 0; g < groups; g++) {
+			uint32_t deltas[GroupSize] = {};
+			for (size_t k = 0; k < GroupSize && first + g * GroupSize + k < last; k++) {
+				const size_t i = first + g * GroupSize + k;
+				if (stride == sizeof(uint16_t)) {
+					const uint16_t index = static_cast<const uint16_t*>(indexes)[i];
+					deltas[k] = Zigzag(static_cast<uint32_t>(static_cast<int16_t>(index - *previous))) & 0xffff;
+					*previous = index;
+				}
+				else {
+					const uint32_t index = static_cast<const uint32_t*>(indexes)[i];
+					deltas[k] = Zigzag(index - *previous);
+					*previous = index;
+				}
+			}
+
+			for (size_t b = 0; b < stride; b++) {
+				uint8_t values[GroupSize];
+				for (size_t k = 0; k < GroupSize; k++) values[k] = static_cast<uint8_t>(deltas[k] >> (b * 8));
+				const size_t c = g * stride + b;
+				const unsigned code = PackGroup(values, dst);
+				(*dst)[c / 4] |= static_cast<uint8_t>(code << (c % 4 * 2));
+			}
+		}
+	}
+
+#if defined(FMATH_SSE)
+	// --16̃CfbNX߂ď(carry͒O̒lS[ɓꂽ)-- //
+	// oCgƂɖ߂đgݗāAWOUO߂AWX^̒ō𑫂Ă璼O̒l𑫂
+	inline void UnfilterIndexGroup(const uint8_t* header, size_t group, const uint8_t** p, __m128i* carry, uint32_t* dst) {
+		__m128i b[4];
+		for (size_t k = 0; k < 4; k++) {
+			const unsigned code = GroupCode(header, group * 4 + k);
+			b[k] = UnpackGroup(*p, code);
+			*p += GroupBytes[code];
+		}
+		const __m128i lo01 = _mm_unpacklo_epi8(b[0], b[1]), hi01 = _mm_unpackhi_epi8(b[0], b[1]);
+		const __m128i lo23 = _mm_unpacklo_epi8(b[2], b[3]), hi23 = _mm_unpackhi_epi8(b[2], b[3]);
+		const __m128i x[4] = {
+			_mm_unpacklo_epi16(lo01, lo23), _mm_unpackhi_epi16(lo01, lo23),
+			_mm_unpacklo_epi16(hi01, hi23), _mm_unpackhi_epi16(hi01, hi23) };
+
+		const __m128i zero = _mm_setzero_si128(), one = _mm_set1_epi32(1);
+		for (int q = 0; q < 4; q++) {
+			__m128i v = _mm_xor_si128(_mm_srli_epi32(x[q], 1), _mm_sub_epi32(zero, _mm_and_si128(x[q], one)));
+			v = _mm_add_epi32(v, _mm_slli_si128(v, 4));
+			v = _mm_add_epi32(v, _mm_slli_si128(v, 8));
+			v = _mm_add_epi32(v, *carry);
+			*carry = _mm_shuffle_epi32(v, _MM_SHUFFLE(3, 3, 3, 3));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(dst + q * 4), v);
+		}
+	}
+
+	inline void UnfilterIndexGroup(const uint8_t* header, size_t group, const uint8_t** p, __m128i* carry, uint16_t* dst) {
+		const unsigned code0 = GroupCode(header, group * 2), code1 = GroupCode(header, group * 2 + 1);
+		const __m128i lo = UnpackGroup(*p, code0);
+		const __m128i hi = UnpackGroup(*p + GroupBytes[code0], code1);
+		*p += GroupBytes[code0] + GroupBytes[code1];
+		const __m128i x[2] = { _mm_unpacklo_epi8(lo, hi), _mm_unpackhi_epi8(lo, hi) };
+
+		const __m128i zero = _mm_setzero_si128(), one = _mm_set1_epi16(1);
+		for (int q = 0; q < 2; q++) {
+			__m128i v = _mm_xor_si128(_mm_srli_epi16(x[q], 1), _mm_sub_epi16(zero, _mm_and_si128(x[q], one)));
+			v = _mm_add_epi16(v, _mm_slli_si128(v, 2));
+			v = _mm_add_epi16(v, _mm_slli_si128(v, 4));
+			v = _mm_add_epi16(v, _mm_slli_si128(v, 8));
+			v = _mm_add_epi16(v, *carry);
+			const __m128i last = _mm_shufflehi_epi16(v, _MM_SHUFFLE(3, 3, 3, 3));
+			*carry = _mm_unpackhi_epi64(last, last);
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(dst + q * 8), v);
+		}
+	}
+
+	// --O̒lS[ɓAS[ɓlo-- //
+	inline __m128i SplatIndex(uint32_t value, uint32_t*) { return _mm_set1_epi32(static_cast<int>(value)); }
+	inline __m128i SplatIndex(uint32_t value, uint16_t*) { return _mm_set1_epi16(static_cast<short>(value)); }
+	inline uint32_t ExtractIndex(__m128i carry, uint32_t*) { return static_cast<uint32_t>(_mm_cvtsi128_si32(carry)); }
+	inline uint32_t ExtractIndex(__m128i carry, uint16_t*) { return static_cast<uint32_t>(_mm_extract_epi16(carry, 0)); }
+#endif
+
+	// --CfbNX̍߂(T͏o͂^An̓ubÑCfbNX)-- //
+	template <typename T>
+	bool UnfilterIndexes(const uint8_t* data, size_t size, size_t n, uint32_t* previous, T* dst) {
+		const size_t groups = (n + GroupSize - 1) / GroupSize;
+		const size_t headerSize = (groups * sizeof(T) + 3) / 4;
+
+		// l߂f[^̑傫cƈv邩Ɋm߂(O[vǂނƂɔ͈͂mFȂčς)
+		if (size < headerSize || PackedSize(data, groups * sizeof(T)) != size - headerSize) return false;
+
+		const uint8_t* p = data + headerSize;
+		const uint8_t* const end = data + size;
+		uint32_t value = *previous;
+		size_t g = 0;
+
+#if defined(FMATH_SSE)
+		// --16oCgǂݍł͈͂oȂԂ16܂Ƃ߂Ė߂-- //
+		__m128i carry = SplatIndex(value, dst);
+		for (; g < n / GroupSize && static_cast<size_t>(end - p) >= GroupSize * sizeof(T); g++) {
+			UnfilterIndexGroup(data, g, &p, &carry, dst + g * GroupSize);
+		}
+		value = ExtractIndex(carry, dst);
+#endif
+
+		// --c̃O[v(Ō̃O[v͑Ȃ܂Ȃ)-- //
+		for (; g < groups; g++) {
+			uint8_t bytes[sizeof(T)][GroupSize];
+			for (size_t b = 0; b < sizeof(T); b++) {
+				const unsigned code = GroupCode(data, g * sizeof(T) + b);
+				UnpackGroupScalar(p, code, bytes[b]);
+				p += GroupBytes[code];
+			}
+			const size_t count = n - g * GroupSize < GroupSize ? n - g * GroupSize : GroupSize;
+			for (size_t k = 0; k < count; k++) {
+				uint32_t delta = 0;
+				for (size_t b = 0; b < sizeof(T); b++) delta |= static_cast<uint32_t>(bytes[b][k]) << (b * 8);
+				value = static_cast<T>(value + Unzigzag(delta));
+				dst[g * GroupSize + k] = static_cast<T>(value);
+			}
+		}
+
+		*previous = value;
+		return true;
+	}
+
+	// --CfbNX߂(T͏o͂^)-- //
+	template <typename T>
+	bool DecodeIndexes(T* dst, size_t count, const uint8_t* src, size_t size) {
+		const uint8_t* end = src + size;
+		std::vector<uint8_t> scratch;
+
+		uint32_t previous = 0;
+		for (size_t first = 0; first < count; first += IndexBlockCount) {
+			const size_t n = first + IndexBlockCount < count ? IndexBlockCount : count - first;
+			const uint8_t* data;
+			size_t dataSize;
+			if (!ReadBlock(&src, end, &scratch, &data, &dataSize) || !UnfilterIndexes(data, dataSize, n, &previous, dst + first)) return false;
+		}
+		return src == end;
+	}
+
+	// --1_̃oCgAubNɓ钸_߂-- //
+	inline size_t VertexBlockCount(size_t stride) {
+		size_t count = VertexBlockBytes / stride;
+		return count > 0 ? count : 1;
+	}
+
+	// --oCg̖ʂO[v(16oCg)Ƃɋl߂-- //
+	// [̕(2bit x O[v)][O[vƂɋl߂](Ō̃O[v̑Ȃ0ɂ)
+	void PackPlane(const uint8_t* plane, size_t n, std::vector<uint8_t>* dst) {
+		const size_t groups = (n + GroupSize - 1) / GroupSize;
+		const size_t header = dst->size();
+		dst->resize(header + (groups + 3) / 4, 0);
+		for (size_t g = 0; g < groups; g++) {
+			uint8_t values[GroupSize] = {};
+			for (size_t k = 0; k < GroupSize && g * GroupSize + k < n; k++) values[k] = plane[g * GroupSize + k];
+			const unsigned code = PackGroup(values, dst);
+			(*dst)[header + g / 4] |= static_cast<uint8_t>(code << (g % 4 * 2));
+		}
+	}
+
+	// --l߂oCg̖ʂ߂(outɂ̓O[v x 16oCgށAǂݍ񂾃oCgԂAĂ0Ԃ)-- //
+	size_t UnpackPlane(const uint8_t* src, size_t size, size_t n, uint8_t* out) {
+		const size_t groups = (n + GroupSize - 1) / GroupSize;
+		const size_t headerSize = (groups + 3) / 4;
+		if (size < headerSize) return 0;
+
+		// l߂f[^cɎ܂邩Ɋm߂
+		const size_t total = headerSize + PackedSize(src, groups);
+		if (total > size) return 0;
+
+		const uint8_t* p = src + headerSize;
+		size_t g = 0;
+#if defined(FMATH_SSE)
+		// --16oCgǂݍł͈͂oȂԂSSEŖ߂(̕1oCgA4O[v)-- //
+		for (; g + 4 <= groups && static_cast<size_t>(src + size - p) >= GroupSize * 4; g += 4) {
+			const unsigned header = src[g / 4];
+			for (unsigned k = 0; k < 4; k++) {
+				const unsigned code = header >> (k * 2) & 3;
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(out + (g + k) * GroupSize), UnpackGroup(p, code));
+				p += GroupBytes[code];
+			}
+		}
+		for (; g < groups && static_cast<size_t>(src + size - p) >= GroupSize; g++) {
+			const unsigned code = GroupCode(src, g);
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(out + g * GroupSize), UnpackGroup(p, code));
+			p += GroupBytes[code];
+		}
+#endif
+
+		// --c̃O[v-- //
+		for (; g < groups; g++) {
+			const unsigned code = GroupCode(src, g);
+			UnpackGroupScalar(p, code, out + g * GroupSize);
+			p += GroupBytes[code];
+		}
+		return total;
+	}
+
+	// --_̃tB^߂(n_̃oCg̖ʂ4oCgɖ߂č𑫂ĂAoutɏ)-- //
+	// --ʂplaneStrideoCgɕł-- //
+	void UnfilterVertexes(const uint8_t* data, size_t n, size_t planeStride, size_t stride, uint32_t* previous, uint8_t* out) {
+		const size_t words = stride / 4;
+		size_t first = 0;
+
+#if defined(FMATH_SSE)
+		// --4P x 16_߂(1_16oCg̔{̏ꍇ)-- //
+		// PꂲƂ4̖ʂ16_̍ǂݍőgݗĂăWOUO߂A4x4œ]uĒ_Ƃ4PɂĂA
+		// O̒_4PɑĂ(_Ƃ̑Z1߂ōς)
+		if (words % 4 == 0) {
+			first = n & ~size_t(15);
+			const __m128i one = _mm_set1_epi32(1);
+			for (size_t g = 0; g < words; g += 4) {
+				__m128i last = _mm_loadu_si128(reinterpret_cast<const __m128i*>(previous + g));// -> O̒_4P
+
+				for (size_t i = 0; i < first; i += 16) {
+					__m128i deltas[4][4];// -> [P][4_]
+					for (int w = 0; w < 4; w++) {
+						const uint8_t* plane = data + (g + w) * 4 * planeStride + i;
+						const __m128i b0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(plane));
+						const __m128i b1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(plane + planeStride));
+						const __m128i b2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(plane + planeStride * 2));
+						const __m128i b3 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(plane + planeStride * 3));
+						const __m128i lo01 = _mm_unpacklo_epi8(b0, b1), hi01 = _mm_unpackhi_epi8(b0, b1);
+						const __m128i lo23 = _mm_unpacklo_epi8(b2, b3), hi23 = _mm_unpackhi_epi8(b2, b3);
+						const __m128i x[4] = {
+							_mm_unpacklo_epi16(lo01, lo23), _mm_unpackhi_epi16(lo01, lo23),
+							_mm_unpacklo_epi16(hi01, hi23), _mm_unpackhi_epi16(hi01, hi23) };
+						for (int q = 0; q < 4; q++) {
+							deltas[w][q] = _mm_xor_si128(_mm_srli_epi32(x[q], 1), _mm_sub_epi32(_mm_setzero_si128(), _mm_and_si128(x[q], one)));
+						}
+					}
+
+					for (int q = 0; q < 4; q++) {
+						const __m128i t0 = _mm_unpacklo_epi32(deltas[0][q], deltas[1][q]);
+						const __m128i t1 = _mm_unpacklo_epi32(deltas[2][q], deltas[3][q]);
+						const __m128i t2 = _mm_unpackhi_epi32(deltas[0][q], deltas[1][q]);
+						const __m128i t3 = _mm_unpackhi_epi32(deltas[2][q], deltas[3][q]);
+						uint8_t* o = out + (i + q * 4) * stride + g * 4;
+						last = _mm_add_epi32(last, _mm_unpacklo_epi64(t0, t1));
+						_mm_storeu_si128(reinterpret_cast<__m128i*>(o), last);
+						last = _mm_add_epi32(last, _mm_unpackhi_epi64(t0, t1));
+						_mm_storeu_si128(reinterpret_cast<__m128i*>(o + stride), last);
+						last = _mm_add_epi32(last, _mm_unpacklo_epi64(t2, t3));
+						_mm_storeu_si128(reinterpret_cast<__m128i*>(o + stride * 2), last);
+						last = _mm_add_epi32(last, _mm_unpackhi_epi64(t2, t3));
+						_mm_storeu_si128(reinterpret_cast<__m128i*>(o + stride * 3), last);
+					}
+				}
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(previous + g), last);
+			}
+		}
+#endif
+
+		// --c̒_(ʂƂɐ擪ǂނ̂ŁAǂݍ݂͘AɂȂ)-- //
+		for (size_t w = 0; w < words; w++) {
+			const uint8_t* plane = data + w * 4 * planeStride;
+			uint32_t value = previous[w];
+			for (size_t i = first; i < n; i++) {
+				const uint32_t delta = plane[i] | static_cast<uint32_t>(plane[i + planeStride]) << 8 |
+					static_cast<uint32_t>(plane[i + planeStride * 2]) << 16 | static_cast<uint32_t>(plane[i + planeStride * 3]) << 24;
+				value += Unzigzag(delta);
+				std::memcpy(out + i * stride + w * 4, &value, sizeof(value));
+			}
+			previous[w] = value;
+		}
+	}
+}
+
+// --CfbNXk-- //
+void MeshEncodeIndexes(const void* indexes, size_t count, size_t stride, std::vector<uint8_t>* dst)
+{
+	assert(stride == sizeof(uint16_t) || stride == sizeof(uint32_t));
+	std::vector<uint8_t> filtered, compressed;
+	std::vector<uint32_t> table;
+	filtered.reserve(IndexBlockCount * sizeof(uint32_t) + IndexBlockCount / GroupSize);
+
+	uint32_t previous = 0;
+	for (size_t first = 0; first < count; first += IndexBlockCount) {
+		const size_t last = first + IndexBlockCount < count ? first + IndexBlockCount : count;
+		FilterIndexes(indexes, first, last, stride, &previous, &filtered);
+		WriteBlock(filtered.data(), filtered.size(), &table, &compressed, dst);
+	}
+}
+
+// --kCfbNX߂-- //
+bool MeshDecodeIndexes(void* dst, size_t count, size_t stride, const uint8_t* src, size_t size)
+{
+	if (stride == sizeof(uint16_t)) return DecodeIndexes(static_cast<uint16_t*>(dst), count, src, size);
+	if (stride == sizeof(uint32_t)) return DecodeIndexes(static_cast<uint32_t*>(dst), count, src, size);
+	return false;
+}
+
+// --_k-- //
+void MeshEncodeVertexes(const void* vertexes, size_t count, size_t stride, std::vector<uint8_t>* dst)
+{
+	assert(stride > 0 && stride % 4 == 0);
+	const size_t words = stride / 4;
+	const size_t blockCount = VertexBlockCount(stride);
+	const uint8_t* bytes = static_cast<const uint8_t*>(vertexes);
+
+	std::vector<uint8_t> planes(blockCount * stride), packed, compressed;
+	std::vector<uint32_t> table;
+	std::vector<uint32_t> previous(words, 0);
+
+	for (size_t first = 0; first < count; first += blockCount) {
+		const size_t n = first + blockCount < count ? blockCount : count - first;
+
+		// 4oCgƂ1O̒_Ƃ̍ƂAoCgƂ̖ʂɕ(ʂ̕т P0̃oCg0AP0̃oCg1c)
+		for (size_t w = 0; w < words; w++) {
+			uint8_t* plane = planes.data() + w * 4 * n;
+			for (size_t i = 0; i < n; i++) {
+				const uint32_t value = Read32(bytes + (first + i) * stride + w * 4);
+				const uint32_t delta = Zigzag(value - previous[w]);
+				previous[w] = value;
+				plane[i] = static_cast<uint8_t>(delta);
+				plane[i + n] = static_cast<uint8_t>(delta >> 8);
+				plane[i + n * 2] = static_cast<uint8_t>(delta >> 16);
+				plane[i + n * 3] = static_cast<uint8_t>(delta >> 24);
+			}
+		}
+
+		// ʂƂɕ낦ċl߂
+		packed.clear();
+		for (size_t k = 0; k < stride; k++) PackPlane(planes.data() + k * n, n, &packed);
+		WriteBlock(packed.data(), packed.size(), &table, &compressed, dst);
+	}
+}
+
+// --k_߂-- //
+bool MeshDecodeVertexes(void* dst, size_t count, size_t stride, const uint8_t* src, size_t size)
+{
+	if (stride == 0 || stride % 4 != 0) return false;
+	const size_t words = stride / 4;
+	const size_t blockCount = VertexBlockCount(stride);
+	const uint8_t* end = src + size;
+	uint8_t* bytes = static_cast<uint8_t*>(dst);
+
+	// ʂ̓O[vP(16oCg)Ŗ߂̂ŁAʂ̊Ԋu16oCg̔{ɂ
+	const size_t maxCount = count < blockCount ? count : blockCount;
+	const size_t planeStride = (maxCount + GroupSize - 1) / GroupSize * GroupSize;
+	std::vector<uint8_t> scratch, planes(planeStride * stride);
+	std::vector<uint32_t> previous(words, 0);
+
+	for (size_t first = 0; first < count; first += blockCount) {
+		const size_t n = first + blockCount < count ? blockCount : count - first;
+		const uint8_t* data;
+		size_t dataSize;
+		if (!ReadBlock(&src, end, &scratch, &data, &dataSize)) return false;
+
+		const uint8_t* p = data;
+		const uint8_t* const pend = data + dataSize;
+		for (size_t k = 0; k < stride; k++) {
+			const size_t read = UnpackPlane(p, static_cast<size_t>(pend - p), n, planes.data() + k * planeStride);
+			if (read == 0) return false;
+			p += read;
+		}
+		if (p != pend) return false;
+
+		UnfilterVertexes(planes.data(), n, planeStride, stride, previous.data(), bytes + first * stride);
+	}
+	return src == end;
+}
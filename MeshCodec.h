@@ -0,0 +1,24 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// --_ƃCfbNX̉tk-- //
+// ǂO(tB^)16oCg̃O[vƂɋl߂ĂAubNƂLZk
+// CfbNX : 1ÕCfbNXƂ̍WOUOA16oCg(0oCgځA1oCgځc)ɋl߂
+// _         : 4oCgƂ1O̒_Ƃ̍WOUOAoCgƂ̖(S_0oCgځA1oCgځc)ɕבւċl߂
+// O[v̋lߕ : 16oCg1oCg0A2A4A8bit̂ǂꂩɂ낦(_LbV̍͂قƂ4bitȉɎ܂)
+// ubŇ` : [WJ̃oCg(ϒ)][i[oCg * 2 + LZk(ϒ)][f[^]
+// LZk1/8ȏk܂ȂAтZēWJxȂubN͂̂܂܊i[(WJSSEŐGB/sۂ)
+
+// --CfbNXkdsťɒǉ(indexesstrideoCg(24)񂾂)-- //
+void MeshEncodeIndexes(const void* indexes, size_t count, size_t stride, std::vector<uint8_t>* dst);
+
+// --kCfbNX߂(srcsizeoCgA傤count߂Ȃfalse)-- //
+bool MeshDecodeIndexes(void* dst, size_t count, size_t stride, const uint8_t* src, size_t size);
+
+// --_kdsťɒǉ(stride4̔{)-- //
+void MeshEncodeVertexes(const void* vertexes, size_t count, size_t stride, std::vector<uint8_t>* dst);
+
+// --k_߂(srcsizeoCgA傤count߂Ȃfalse)-- //
+bool MeshDecodeVertexes(void* dst, size_t count, size_t stride, const uint8_t* src, size_t size);
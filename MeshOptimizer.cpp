@@ -0,0 +1,299 @@
+#include "MeshOptimizer.h"
+#include <algorithm>
+#include <cmath>
+
+namespace {
+	// --FIFO̒_LbV-- //
+	// _ƂɓoĂA̎Ƃ̍LbV̑傫ȂcĂƂ݂Ȃ
+	class FifoCache
+	{
+	public:
+		FifoCache(size_t vertexCount, size_t cacheSize) : stamps_(vertexCount, 0), cacheSize_(cacheSize), time_(cacheSize + 1) {}
+
+		// _g(LbVɖꍇtrue)
+		bool Access(uint32_t vertex) {
+			if (time_ - stamps_[vertex] < cacheSize_) return false;
+			stamps_[vertex] = time_++;
+			return true;
+		}
+
+		// LbVɂ(i߂āA܂ł̒_ׂĒǂoꂽƂɂ)
+		void Reset() { time_ += cacheSize_ + 1; }
+
+	private:
+		std::vector<size_t> stamps_;
+		size_t cacheSize_;
+		size_t time_;
+	};
+
+	// --͈͓̎Op`FIFOŏƂ̃~X-- //
+	size_t CountMisses(const uint32_t* indexes, size_t indexCount, size_t vertexCount, size_t cacheSize) {
+		FifoCache cache(vertexCount, cacheSize);
+		size_t misses = 0;
+		for (size_t i = 0; i < indexCount; i++) misses += cache.Access(indexes[i]);
+		return misses;
+	}
+
+	// --Op`̌vZ-- //
+	inline Float3 Sub(const Float3& a, const Float3& b) { return Float3(a.x - b.x, a.y - b.y, a.z - b.z); }
+	inline Float3 Cross(const Float3& a, const Float3& b) { return Float3(a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x); }
+	inline float Dot(const Float3& a, const Float3& b) { return a.x * b.x + a.y * b.y + a.z * b.z; }
+}
+
+// --FIFO̒_LbV^ăCfbNX̕т]-- //
+MeshCacheStats MeshAnalyzeVertexCache(const uint32_t* indexes, size_t indexCount, size_t vertexCount, size_t cacheSize)
+{
+	MeshCacheStats stats = { 0.0f, 0.0f };
+	if (indexCount < 3 || vertexCount == 0) return stats;
+
+	// gĂ钸_𐔂
+	std::vector<char> used(vertexCount, 0);
+	size_t usedCount = 0;
+	for (size_t i = 0; i < indexCount; i++) {
+		if (!used[indexes[i]]) {
+			used[indexes[i]] = 1;
+			usedCount++;
+		}
+	}
+
+	size_t misses = CountMisses(indexes, indexCount, vertexCount, cacheSize);
+	stats.acmr = static_cast<float>(misses) / static_cast<float>(indexCount / 3);
+	stats.atvr = static_cast<float>(misses) / static_cast<float>(usedCount);
+	return stats;
+}
+
+// --_LbVɓ₷悤ɎOp`בւ(Tipsify)-- //
+// Sander et al. "Fast Triangle Reordering for Vertex Locality and Reduced Overdraw" (2007)
+void MeshOptimizeVertexCache(uint32_t* indexes, size_t indexCount, size_t vertexCount, size_t cacheSize, std::vector<uint32_t>* clusters)
+{
+	clusters->clear();
+	const size_t triangleCount = indexCount / 3;
+	if (triangleCount == 0) return;
+
+	// --_ -> ̒_gOp` ̕\(CSR`)-- //
+	std::vector<uint32_t> liveCount(vertexCount, 0);// -> ܂oĂȂOp`̐
+	for (size_t i = 0; i < triangleCount * 3; i++) liveCount[indexes[i]]++;
+
+	std::vector<uint32_t> adjacencyFirst(vertexCount + 1, 0);
+	for (size_t v = 0; v < vertexCount; v++) adjacencyFirst[v + 1] = adjacencyFirst[v] + liveCount[v];
+	std::vector<uint32_t> adjacency(triangleCount * 3);
+	{
+		std::vector<uint32_t> cursor(adjacencyFirst.begin(), adjacencyFirst.end() - 1);
+		for (size_t i = 0; i < triangleCount * 3; i++) adjacency[cursor[indexes[i]]++] = static_cast<uint32_t>(i / 3);
+	}
+
+	// --ɎOp`oĂ-- //
+	std::vector<size_t> stamps(vertexCount, 0);// -> _LbVɓ
+	std::vector<char> emitted(triangleCount, 0);
+	std::vector<uint32_t> deadEnd;// -> o_̗(߂ɑȂƂɖ߂)
+	std::vector<uint32_t> candidates;
+	std::vector<uint32_t> result;
+	result.reserve(triangleCount * 3);
+
+	size_t time = cacheSize + 1;
+	size_t scan = 0;// -> ȂƂɐ擪Tʒu
+	int64_t fan = -1;
+
+	// ŏ̒S͎gĂŏ̒_
+	while (scan < vertexCount && liveCount[scan] == 0) scan++;
+	if (scan < vertexCount) fan = static_cast<int64_t>(scan);
+	clusters->push_back(0);
+
+	while (fan >= 0) {
+		// S̒_̂܂oĂȂOp`ׂďo
+		candidates.clear();
+		for (uint32_t a = adjacencyFirst[fan]; a < adjacencyFirst[fan + 1]; a++) {
+			uint32_t triangle = adjacency[a];
+			if (emitted[triangle]) continue;
+			emitted[triangle] = 1;
+
+			for (size_t k = 0; k < 3; k++) {
+				uint32_t v = indexes[triangle * 3 + k];
+				result.push_back(v);
+				deadEnd.push_back(v);
+				candidates.push_back(v);
+				liveCount[v]--;
+				if (time - stamps[v] > cacheSize) stamps[v] = time++;
+			}
+		}
+
+		// ̒ŚA̎Op`oI܂ŃLbVɎcĂȒ_̂AԌÂ
+		int64_t next = -1;
+		int64_t best = -1;
+		for (uint32_t v : candidates) {
+			if (liveCount[v] == 0) continue;
+			int64_t priority = 0;
+			if (time - stamps[v] + 2 * liveCount[v] <= cacheSize) priority = static_cast<int64_t>(time - stamps[v]);
+			if (priority > best) {
+				best = priority;
+				next = v;
+			}
+		}
+
+		// Ȃ΁Ao_V߂ĒTAΐ擪T
+		if (next < 0) {
+			while (!deadEnd.empty() && next < 0) {
+				uint32_t v = deadEnd.back();
+				deadEnd.pop_back();
+				if (liveCount[v] > 0) next = v;
+			}
+			if (next < 0) {
+				while (scan < vertexCount && liveCount[scan] == 0) scan++;
+				if (scan < vertexCount) next = static_cast<int64_t>(scan);
+			}
+			if (next >= 0) clusters->push_back(static_cast<uint32_t>(result.size() / 3));
+		}
+		fan = next;
+	}
+
+	std::copy(result.begin(), result.end(), indexes);
+}
+
+// --O򂩂ɕ`悷悤ɁȀԂבւ-- //
+// ̒Sf̒S@ɗĂقǁAق̖ʂB₷̂Őɕ`悷
+void MeshOptimizeOverdraw(uint32_t* indexes, size_t indexCount, const MeshVertex* vertexes, size_t vertexCount,
+	const std::vector<uint32_t>& clusters, size_t cacheSize, float threshold, size_t* clusterCount)
+{
+	const size_t triangleCount = indexCount / 3;
+	if (clusterCount) *clusterCount = triangleCount > 0 ? 1 : 0;
+	if (triangleCount == 0 || clusters.size() <= 1) return;
+
+	// --ACMR܂舫ȂȂʒuł-- //
+	// ʒu̓LbV̏ԂŎn܂Ƃ݂ȂāAłŜACMRthreshold{ȉȂ番
+	const float limit = threshold * static_cast<float>(CountMisses(indexes, triangleCount * 3, vertexCount, cacheSize)) / triangleCount;
+	std::vector<uint32_t> bounds;// -> ̐擪̎Op`̔ԍ
+	bounds.push_back(0);
+	{
+		FifoCache cache(vertexCount, cacheSize);
+		size_t misses = 0;
+		size_t next = 1;// -> ɒׂclusters̈ʒu
+		for (size_t t = 0; t < triangleCount; t++) {
+			if (next < clusters.size() && clusters[next] == t) {
+				next++;
+				size_t count = t - bounds.back();
+				if (static_cast<float>(misses) <= limit * count) {
+					bounds.push_back(static_cast<uint32_t>(t));
+					cache.Reset();
+					misses = 0;
+				}
+			}
+			for (size_t k = 0; k < 3; k++) misses += cache.Access(indexes[t * 3 + k]);
+		}
+	}
+	bounds.push_back(static_cast<uint32_t>(triangleCount));
+	const size_t count = bounds.size() - 1;
+	if (clusterCount) *clusterCount = count;
+	if (count <= 1) return;
+
+	// --fŜƉ򂲂Ƃ̒S(ʐςŏdݕt)ƁA̕ς̖@-- //
+	struct Cluster
+	{
+		Float3 center;
+		Float3 normal;
+		float area;
+		float sortKey;
+	};
+	std::vector<Cluster> infos(count, Cluster{ Float3(), Float3(), 0.0f, 0.0f });
+	Float3 meshCenter;
+	float meshArea = 0.0f;
+	for (size_t c = 0; c < count; c++) {
+		Cluster& info = infos[c];
+		for (size_t t = bounds[c]; t < bounds[c + 1]; t++) {
+			const Float3& p0 = vertexes[indexes[t * 3 + 0]].pos;
+			const Float3& p1 = vertexes[indexes[t * 3 + 1]].pos;
+			const Float3& p2 = vertexes[indexes[t * 3 + 2]].pos;
+			Float3 normal = Cross(Sub(p1, p0), Sub(p2, p0));
+			float area = std::sqrt(Dot(normal, normal));// -> Op`̖ʐς2{
+
+			info.center.x += (p0.x + p1.x + p2.x) * area;
+			info.center.y += (p0.y + p1.y + p2.y) * area;
+			info.center.z += (p0.z + p1.z + p2.z) * area;
+			info.normal.x += normal.x;
+			info.normal.y += normal.y;
+			info.normal.z += normal.z;
+			info.area += area;
+		}
+		meshCenter.x += info.center.x;
+		meshCenter.y += info.center.y;
+		meshCenter.z += info.center.z;
+		meshArea += info.area;
+	}
+	if (meshArea > 0.0f) {
+		float inv = 1.0f / (meshArea * 3.0f);
+		meshCenter = Float3(meshCenter.x * inv, meshCenter.y * inv, meshCenter.z * inv);
+	}
+
+	for (Cluster& info : infos) {
+		if (info.area > 0.0f) {
+			float inv = 1.0f / (info.area * 3.0f);
+			info.center = Float3(info.center.x * inv, info.center.y * inv, info.center.z * inv);
+		}
+		float length = std::sqrt(Dot(info.normal, info.normal));
+		info.sortKey = length > 0.0f ? Dot(Sub(info.center, meshCenter), info.normal) / length : 0.0f;
+	}
+
+	// --בւď߂(lȂ猳̏)-- //
+	std::vector<uint32_t> order(count);
+	for (size_t c = 0; c < count; c++) order[c] = static_cast<uint32_t>(c);
+	std::stable_sort(order.begin(), order.end(), [&infos](uint32_t a, uint32_t b) { return infos[a].sortKey > infos[b].sortKey; });
+
+	std::vector<uint32_t> result;
+	result.reserve(triangleCount * 3);
+	for (uint32_t c : order) result.insert(result.end(), indexes + bounds[c] * 3, indexes + bounds[c + 1] * 3);
+	std::copy(result.begin(), result.end(), indexes);
+}
+
+// --CfbNXōŏɎg鏇ɒ_בւ-- //
+void MeshOptimizeVertexFetch(MeshData* mesh)
+{
+	std::vector<uint32_t> remap(mesh->vertexes.size(), ObjIndex::None);
+	std::vector<MeshVertex> vertexes;
+	vertexes.reserve(mesh->vertexes.size());
+
+	for (uint32_t& index : mesh->indexes) {
+		if (remap[index] == ObjIndex::None) {
+			remap[index] = static_cast<uint32_t>(vertexes.size());
+			vertexes.push_back(mesh->vertexes[index]);
+		}
+		index = remap[index];
+	}
+	mesh->vertexes.swap(vertexes);
+}
+
+// --TuZbgƂɍœK-- //
+MeshOptimizeReport MeshOptimize(MeshData* mesh, size_t cacheSize, float overdrawThreshold)
+{
+	// TuZbgꍇ͑Ŝ1̃TuZbgƂĈ
+	std::vector<MeshSubset> subsets = mesh->subsets;
+	if (subsets.empty()) subsets.push_back({ 0, 0, static_cast<uint32_t>(mesh->indexes.size()), MeshBounds{} });
+
+	// v͌̃bV(LOD0)͈̔͂Ŏ
+	const size_t baseCount = mesh->subsets.empty() ? mesh->indexes.size() : MeshLodIndexEnd(*mesh, 0);
+
+	MeshOptimizeReport report = {};
+	report.before = MeshAnalyzeVertexCache(mesh->indexes.data(), baseCount, mesh->vertexes.size(), cacheSize);
+
+	std::vector<uint32_t> clusters;
+	std::vector<uint32_t> original;
+	for (const MeshSubset& subset : subsets) {
+		uint32_t* indexes = mesh->indexes.data() + subset.indexStart;
+		original.assign(indexes, indexes + subset.indexCount);
+
+		size_t clusterCount = 0;
+		MeshOptimizeVertexCache(indexes, subset.indexCount, mesh->vertexes.size(), cacheSize, &clusters);
+		MeshOptimizeOverdraw(indexes, subset.indexCount, mesh->vertexes.data(), mesh->vertexes.size(), clusters, cacheSize, overdrawThreshold, &clusterCount);
+
+		// ̕тɗǂAבւthreshold{舫Ȃꍇ͌ɖ߂
+		size_t misses = CountMisses(indexes, subset.indexCount, mesh->vertexes.size(), cacheSize);
+		size_t originalMisses = CountMisses(original.data(), original.size(), mesh->vertexes.size(), cacheSize);
+		if (static_cast<float>(misses) > overdrawThreshold * static_cast<float>(originalMisses)) {
+			std::copy(original.begin(), original.end(), indexes);
+			clusterCount = subset.indexCount > 0 ? 1 : 0;
+		}
+		report.clusterCount += clusterCount;
+	}
+
+	MeshOptimizeVertexFetch(mesh);
+	report.after = MeshAnalyzeVertexCache(mesh->indexes.data(), baseCount, mesh->vertexes.size(), cacheSize);
+	return report;
+}
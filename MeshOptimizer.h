@@ -0,0 +1,42 @@
+#pragma once
+#include "Mesh.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// --_LbV̑傫(œKƓvŎgFIFO̒_)-- //
+const size_t MeshCacheSize = 16;
+
+// --_LbV̓v-- //
+struct MeshCacheStats
+{
+	float acmr;// -> Op`1̒_VF[_[s(Average Cache Miss RatioAz0.5t߁Aň3)
+	float atvr;// -> _1̒_VF[_[s(Average Transformed Vertex RatioAz1)
+};
+
+// --œKO̓v-- //
+struct MeshOptimizeReport
+{
+	MeshCacheStats before;// --> œKO
+	MeshCacheStats after;// ---> œK
+	size_t clusterCount;// ----> `揇בւ̐
+};
+
+// --FIFO̒_LbV^ăCfbNX̕т]-- //
+MeshCacheStats MeshAnalyzeVertexCache(const uint32_t* indexes, size_t indexCount, size_t vertexCount, size_t cacheSize = MeshCacheSize);
+
+// --_LbVɓ₷悤ɎOp`בւ(Tipsify)-- //
+// --_𒆐SɎ̎Op`ɏoĂA̒S̓LbVɎcĂ钸_I-- //
+// --clustersɂ͋߂ɑĔ񂾈ʒu(Op`̔ԍ)(擪0܂)-- //
+void MeshOptimizeVertexCache(uint32_t* indexes, size_t indexCount, size_t vertexCount, size_t cacheSize, std::vector<uint32_t>* clusters);
+
+// --O򂩂ɕ`悷悤ɁȀԂבւ(̒̏Ԃ͕ςȂ)-- //
+// --clustersMeshOptimizeVertexCachěʂŁAACMRthreshold{ȏ㈫ȂȂʒuł-- //
+void MeshOptimizeOverdraw(uint32_t* indexes, size_t indexCount, const MeshVertex* vertexes, size_t vertexCount,
+	const std::vector<uint32_t>& clusters, size_t cacheSize, float threshold, size_t* clusterCount = nullptr);
+
+// --CfbNXōŏɎg鏇ɒ_בւ(gȂ_͏)-- //
+void MeshOptimizeVertexFetch(MeshData* mesh);
+
+// --3TuZbgƂɏɍs(LOD̃TuZbg܂ށAvLOD0͈̔)-- //
+MeshOptimizeReport MeshOptimize(MeshData* mesh, size_t cacheSize = MeshCacheSize, float overdrawThreshold = 1.05f);
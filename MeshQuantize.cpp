@@ -0,0 +1,207 @@
+#include "MeshQuantize.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace {
+	// --0`1̒l16bit̐Kɂ-- //
+	inline uint16_t ToUnorm16(float value) {
+		value = std::min(std::max(value, 0.0f), 1.0f);
+		return static_cast<uint16_t>(value * 65535.0f + 0.5f);
+	}
+
+	// --16bit̕tK߂(D3D̋KƓ-32768-1ɂ)-- //
+	inline float FromSnorm16(int16_t value) {
+		return std::max(static_cast<float>(value) / 32767.0f, -1.0f);
+	}
+
+	// --xNg̓-- //
+	inline float Dot(const Float3& a, const Float3& b) { return a.x * b.x + a.y * b.y + a.z * b.z; }
+}
+
+// --_WAABBʎq͈̔͂߂-- //
+MeshQuantization MeshComputeQuantization(const MeshVertex* vertexes, size_t count)
+{
+	MeshQuantization quantization;
+	if (count == 0) return quantization;
+
+	Float3 min = vertexes[0].pos, max = vertexes[0].pos;
+	for (size_t i = 1; i < count; i++) {
+		const Float3& p = vertexes[i].pos;
+		min = Float3(std::min(min.x, p.x), std::min(min.y, p.y), std::min(min.z, p.z));
+		max = Float3(std::max(max.x, p.x), std::max(max.y, p.y), std::max(max.z, p.z));
+	}
+	quantization.offset = min;
+	quantization.scale = Float3(max.x - min.x, max.y - min.y, max.z - min.z);
+	return quantization;
+}
+
+// --_ʎq-- //
+void MeshQuantizeVertexes(const MeshVertex* src, size_t count, const MeshQuantization& quantization, MeshQuantizedVertex* dst)
+{
+	// 傫0ׂ̎͂0ɂ
+	const Float3& scale = quantization.scale;
+	const Float3 inv(scale.x > 0.0f ? 1.0f / scale.x : 0.0f, scale.y > 0.0f ? 1.0f / scale.y : 0.0f, scale.z > 0.0f ? 1.0f / scale.z : 0.0f);
+
+	for (size_t i = 0; i < count; i++) {
+		const MeshVertex& vertex = src[i];
+		MeshQuantizedVertex& result = dst[i];
+
+		// --W-- //
+		result.pos[0] = ToUnorm16((vertex.pos.x - quantization.offset.x) * inv.x);
+		result.pos[1] = ToUnorm16((vertex.pos.y - quantization.offset.y) * inv.y);
+		result.pos[2] = ToUnorm16((vertex.pos.z - quantization.offset.z) * inv.z);
+		result.pos[3] = 0;
+
+		// --@(ľܓlƁAׂ̗̒l̂߂ƂɈԋ߂̂I)-- //
+		float length = std::sqrt(Dot(vertex.normal, vertex.normal));
+		if (length > 0.0f) {
+			Float3 normal(vertex.normal.x / length, vertex.normal.y / length, vertex.normal.z / length);
+			Float2 encoded = MeshOctEncode(normal);
+			float fx = std::floor(encoded.x * 32767.0f), fy = std::floor(encoded.y * 32767.0f);
+
+			float best = -2.0f;
+			for (int dy = 0; dy <= 1; dy++) {
+				for (int dx = 0; dx <= 1; dx++) {
+					int16_t x = static_cast<int16_t>(std::min(std::max(fx + dx, -32767.0f), 32767.0f));
+					int16_t y = static_cast<int16_t>(std::min(std::max(fy + dy, -32767.0f), 32767.0f));
+					float similarity = Dot(MeshOctDecode(Float2(FromSnorm16(x), FromSnorm16(y))), normal);
+					if (similarity > best) {
+						best = similarity;
+						result.normal[0] = x;
+						result.normal[1] = y;
+					}
+				}
+			}
+		}
+		else {
+			// 0̖@+ZɂĂ
+			result.normal[0] = 0;
+			result.normal[1] = 0;
+		}
+
+		// --UV-- //
+		result.uv[0] = MeshFloatToHalf(vertex.uv.x);
+		result.uv[1] = MeshFloatToHalf(vertex.uv.y);
+	}
+}
+
+// --ʎq_߂-- //
+MeshVertex MeshDequantizeVertex(const MeshQuantizedVertex& vertex, const MeshQuantization& quantization)
+{
+	MeshVertex result;
+	result.pos.x = quantization.offset.x + quantization.scale.x * (vertex.pos[0] / 65535.0f);
+	result.pos.y = quantization.offset.y + quantization.scale.y * (vertex.pos[1] / 65535.0f);
+	result.pos.z = quantization.offset.z + quantization.scale.z * (vertex.pos[2] / 65535.0f);
+	result.normal = MeshOctDecode(Float2(FromSnorm16(vertex.normal[0]), FromSnorm16(vertex.normal[1])));
+	result.uv = Float2(MeshHalfToFloat(vertex.uv[0]), MeshHalfToFloat(vertex.uv[1]));
+	return result;
+}
+
+// --_f[^WƂȊOɕ-- //
+void MeshSplitVertexes(const void* vertexes, size_t count, MeshVertexFormat format, void* positions, void* attributes)
+{
+	const size_t stride = MeshVertexStride(format);
+	const size_t positionStride = MeshPositionStride(format);
+	const size_t attributeStride = stride - positionStride;
+
+	const uint8_t* src = static_cast<const uint8_t*>(vertexes);
+	uint8_t* positionDst = static_cast<uint8_t*>(positions);
+	uint8_t* attributeDst = static_cast<uint8_t*>(attributes);
+	for (size_t i = 0; i < count; i++) {
+		std::memcpy(positionDst + i * positionStride, src + i * stride, positionStride);
+		std::memcpy(attributeDst + i * attributeStride, src + i * stride + positionStride, attributeStride);
+	}
+}
+
+// --_f[^Wo-- //
+void MeshExtractPositions(const void* vertexes, size_t count, MeshVertexFormat format, const MeshQuantization& quantization, Float3* dst)
+{
+	if (format == MeshVertexFormat::Quantized) {
+		const MeshQuantizedVertex* src = static_cast<const MeshQuantizedVertex*>(vertexes);
+		for (size_t i = 0; i < count; i++) {
+			dst[i].x = quantization.offset.x + quantization.scale.x * (src[i].pos[0] / 65535.0f);
+			dst[i].y = quantization.offset.y + quantization.scale.y * (src[i].pos[1] / 65535.0f);
+			dst[i].z = quantization.offset.z + quantization.scale.z * (src[i].pos[2] / 65535.0f);
+		}
+	}
+	else {
+		const MeshVertex* src = static_cast<const MeshVertex*>(vertexes);
+		for (size_t i = 0; i < count; i++) dst[i] = src[i].pos;
+	}
+}
+
+// --float𔼐xɂ-- //
+uint16_t MeshFloatToHalf(float value)
+{
+	uint32_t bits;
+	std::memcpy(&bits, &value, sizeof(bits));
+	const uint16_t sign = static_cast<uint16_t>((bits >> 16) & 0x8000);
+	const uint32_t absolute = bits & 0x7fffffff;
+
+	// infAnan
+	if (absolute >= 0x7f800000) return sign | (absolute > 0x7f800000 ? 0x7e00 : 0x7c00);
+
+	// xŕ\ől(65504)ۂ߂Ălinf
+	if (absolute >= 0x477ff000) return sign | 0x7c00;
+
+	// x̐K(2^-14ȏ)
+	if (absolute >= 0x38800000) {
+		uint32_t mantissa = absolute + 0xc8000fff + ((absolute >> 13) & 1);// -> w̕tւ(-112 << 23)ƍŋߐڋۂ
+		return sign | static_cast<uint16_t>(mantissa >> 13);
+	}
+
+	// 񐳋K(2^-24̔{Ɋۂ߂)
+	float magnitude;
+	std::memcpy(&magnitude, &absolute, sizeof(magnitude));
+	return sign | static_cast<uint16_t>(std::nearbyint(magnitude * 16777216.0f));
+}
+
+// --xfloatɂ-- //
+float MeshHalfToFloat(uint16_t value)
+{
+	const uint32_t sign = static_cast<uint32_t>(value & 0x8000) << 16;
+	const uint32_t exponent = (value >> 10) & 0x1f;
+	const uint32_t mantissa = value & 0x3ff;
+
+	uint32_t bits;
+	if (exponent == 0x1f) bits = sign | 0x7f800000 | (mantissa << 13);
+	else if (exponent != 0) bits = sign | ((exponent + 112) << 23) | (mantissa << 13);
+	else {
+		float magnitude = mantissa / 16777216.0f;
+		std::memcpy(&bits, &magnitude, sizeof(bits));
+		bits |= sign;
+	}
+
+	float result;
+	std::memcpy(&result, &bits, sizeof(result));
+	return result;
+}
+
+// --PʃxNg𔪖ʑ̂ɓe-- //
+Float2 MeshOctEncode(const Float3& normal)
+{
+	float sum = std::fabs(normal.x) + std::fabs(normal.y) + std::fabs(normal.z);
+	float x = normal.x / sum, y = normal.y / sum;
+
+	// ͑ΊpŐ܂Ԃ
+	if (normal.z < 0.0f) {
+		float foldX = (1.0f - std::fabs(y)) * (x >= 0.0f ? 1.0f : -1.0f);
+		float foldY = (1.0f - std::fabs(x)) * (y >= 0.0f ? 1.0f : -1.0f);
+		x = foldX;
+		y = foldY;
+	}
+	return Float2(x, y);
+}
+
+// --ʑ̂ɓe2PʃxNgɖ߂-- //
+Float3 MeshOctDecode(const Float2& encoded)
+{
+	Float3 normal(encoded.x, encoded.y, 1.0f - std::fabs(encoded.x) - std::fabs(encoded.y));
+	float t = std::max(-normal.z, 0.0f);
+	normal.x += normal.x >= 0.0f ? -t : t;
+	normal.y += normal.y >= 0.0f ? -t : t;
+
+	float length = std::sqrt(Dot(normal, normal));
+	return Float3(normal.x / length, normal.y / length, normal.z / length);
+}
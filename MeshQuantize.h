@@ -0,0 +1,68 @@
+#pragma once
+#include "Mesh.h"
+#include <cstddef>
+#include <cstdint>
+
+// --GPUɑ钸_f[^̌`-- //
+enum class MeshVertexFormat : uint32_t
+{
+	Float,// -----> MeshVertex(32oCgAׂfloat)
+	Quantized,// -> MeshQuantizedVertex(16oCg)
+};
+
+// --ʎq_f[^(16oCg)-- //
+// W : bVAABBɂ16bit̐K(R16G16B16A16_UNORMAw͎gȂ)
+// @ : ʑ̂ɓe216bittK(R16G16_SNORM)
+// UV   : 16bit̔x(R16G16_FLOAT)
+struct MeshQuantizedVertex
+{
+	uint16_t pos[4];// ---> W
+	int16_t normal[2];// -> @
+	uint16_t uv[2];// ----> UVW
+};
+
+// --W̗ʎq͈̔(W = offset + scale * Kl(0`1))-- //
+struct MeshQuantization
+{
+	Float3 offset;// -> AABB̍ŏ_
+	Float3 scale;// --> AABB̑傫
+
+	// ʎqȂꍇ̒l
+	MeshQuantization() : offset(0.0f, 0.0f, 0.0f), scale(1.0f, 1.0f, 1.0f) {}
+};
+
+// --`Ƃ̒_1̃oCg-- //
+constexpr size_t MeshVertexStride(MeshVertexFormat format) {
+	return format == MeshVertexFormat::Quantized ? sizeof(MeshQuantizedVertex) : sizeof(MeshVertex);
+}
+
+// --`Ƃ̍W1̃oCg(W͂ǂ̌`ł_̐擪ɂ)-- //
+constexpr size_t MeshPositionStride(MeshVertexFormat format) {
+	return format == MeshVertexFormat::Quantized ? sizeof(MeshQuantizedVertex::pos) : sizeof(MeshVertex::pos);
+}
+
+// --_f[^W̕тƁAȊO(@UV)̕тɕ-- //
+// --positionsMeshPositionStrideoCgAattributes͎c̃oCgl߂ď-- //
+void MeshSplitVertexes(const void* vertexes, size_t count, MeshVertexFormat format, void* positions, void* attributes);
+
+// --_f[^Wo(ʎq_̓VF[_[ƓvZŖ߂)-- //
+void MeshExtractPositions(const void* vertexes, size_t count, MeshVertexFormat format, const MeshQuantization& quantization, Float3* dst);
+
+// --_WAABBʎq͈̔͂߂-- //
+MeshQuantization MeshComputeQuantization(const MeshVertex* vertexes, size_t count);
+
+// --_ʎq-- //
+// --W̌덷͊escale / 131070ȉ(float̊ۂߌ덷)AUV̌덷͒l2^-11{ȉ(|UV| < 2^-14 Ȃ2^-25ȉ)-- //
+// --@͐؂̂ĂƐ؂グ4ʂ肩߂ƂɈԋ߂̂IԂ̂ŁApx̌덷͖0.01xȉ-- //
+void MeshQuantizeVertexes(const MeshVertex* src, size_t count, const MeshQuantization& quantization, MeshQuantizedVertex* dst);
+
+// --ʎq_߂(VF[_[ł̕ƓvZ)-- //
+MeshVertex MeshDequantizeVertex(const MeshQuantizedVertex& vertex, const MeshQuantization& quantization);
+
+// --xƂ̕ϊ(ŋߐڋۂ)-- //
+uint16_t MeshFloatToHalf(float value);
+float MeshHalfToFloat(uint16_t value);
+
+// --PʃxNgƔʑ̓e2(-1`1)̕ϊ-- //
+Float2 MeshOctEncode(const Float3& normal);
+Float3 MeshOctDecode(const Float2& encoded);
@@ -0,0 +1,329 @@
+#include "MeshSimplify.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+namespace {
+	// --񎟌덷(_A܂Ƃ߂ʂ܂ł̋̓ʐςŏdݕt)-- //
+	// Ώ̂4x4s10ƁAd݂̍v
+	struct Quadric
+	{
+		double a2 = 0.0, ab = 0.0, ac = 0.0, ad = 0.0;
+		double b2 = 0.0, bc = 0.0, bd = 0.0;
+		double c2 = 0.0, cd = 0.0;
+		double d2 = 0.0;
+		double weight = 0.0;
+
+		//  ax + by + cz + d = 0 (@͐Kς)𑫂
+		void AddPlane(double a, double b, double c, double d, double w) {
+			a2 += w * a * a; ab += w * a * b; ac += w * a * c; ad += w * a * d;
+			b2 += w * b * b; bc += w * b * c; bd += w * b * d;
+			c2 += w * c * c; cd += w * c * d;
+			d2 += w * d * d;
+			weight += w;
+		}
+
+		Quadric& operator+=(const Quadric& q) {
+			a2 += q.a2; ab += q.ab; ac += q.ac; ad += q.ad;
+			b2 += q.b2; bc += q.bc; bd += q.bd;
+			c2 += q.c2; cd += q.cd;
+			d2 += q.d2;
+			weight += q.weight;
+			return *this;
+		}
+
+		// _ł̌덷(̓̏dݕt)
+		double Evaluate(const Float3& p) const {
+			double x = p.x, y = p.y, z = p.z;
+			double value = a2 * x * x + b2 * y * y + c2 * z * z + 2.0 * (ab * x * y + ac * x * z + bc * y * z + ad * x + bd * y + cd * z) + d2;
+			return weight > 0.0 ? std::max(value, 0.0) / weight : 0.0;
+		}
+	};
+
+	// --ǩ(fromtoɊ񂹂)-- //
+	struct Collapse
+	{
+		uint32_t from;
+		uint32_t to;
+		double cost;
+	};
+
+	// --Op`̌vZ-- //
+	inline Float3 Sub(const Float3& a, const Float3& b) { return Float3(a.x - b.x, a.y - b.y, a.z - b.z); }
+	inline Float3 Cross(const Float3& a, const Float3& b) { return Float3(a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x); }
+	inline double Dot(const Float3& a, const Float3& b) { return double(a.x) * b.x + double(a.y) * b.y + double(a.z) * b.z; }
+
+	// --W̃rbg̔r(W̒_܂Ƃ߂邽)-- //
+	inline bool PositionLess(const Float3& a, const Float3& b) {
+		uint32_t pa[3], pb[3];
+		std::memcpy(pa, &a, sizeof(pa));
+		std::memcpy(pb, &b, sizeof(pb));
+		return std::lexicographical_compare(pa, pa + 3, pb, pb + 3);
+	}
+}
+
+// --Op`炷-- //
+// Garland, Heckbert "Surface Simplification Using Quadric Error Metrics" (1997)
+size_t MeshSimplify(uint32_t* dst, const uint32_t* indexes, size_t indexCount, const MeshVertex* vertexes, size_t vertexCount,
+	size_t targetIndexCount, float targetError, float* resultError, float errorExtent)
+{
+	indexCount -= indexCount % 3;
+	std::copy(indexes, indexes + indexCount, dst);
+	if (resultError) *resultError = 0.0f;
+	if (indexCount <= targetIndexCount || vertexCount == 0) return indexCount;
+
+	// --W̒_ɓԍ(ʒuԍ)t-- //
+	std::vector<uint32_t> order(vertexCount);
+	for (uint32_t i = 0; i < vertexCount; i++) order[i] = i;
+	std::sort(order.begin(), order.end(), [vertexes](uint32_t a, uint32_t b) { return PositionLess(vertexes[a].pos, vertexes[b].pos); });
+
+	std::vector<uint32_t> positionId(vertexCount);
+	std::vector<char> locked(vertexCount, 0);// -> Ȃʒuԍ
+	uint32_t positionCount = 0;
+	for (size_t i = 0; i < vertexCount;) {
+		size_t last = i + 1;
+		while (last < vertexCount && !PositionLess(vertexes[order[i]].pos, vertexes[order[last]].pos)) last++;
+
+		// Wɒ_2ȏ゠(@UV̌p)Ȃ瓮Ȃ
+		if (last - i > 1) locked[positionCount] = 1;
+		for (size_t k = i; k < last; k++) positionId[order[k]] = positionCount;
+		positionCount++;
+		i = last;
+	}
+
+	// --̕(Op`2ł͂Ȃ)̒_Ȃ-- //
+	{
+		std::vector<uint64_t> edges;
+		edges.reserve(indexCount);
+		for (size_t i = 0; i < indexCount; i += 3) {
+			for (size_t k = 0; k < 3; k++) {
+				uint32_t a = positionId[dst[i + k]], b = positionId[dst[i + (k + 1) % 3]];
+				if (a == b) continue;
+				edges.push_back(uint64_t(std::min(a, b)) << 32 | std::max(a, b));
+			}
+		}
+		std::sort(edges.begin(), edges.end());
+		for (size_t i = 0; i < edges.size();) {
+			size_t last = i + 1;
+			while (last < edges.size() && edges[last] == edges[i]) last++;
+			if (last - i != 2) {
+				locked[edges[i] >> 32] = 1;
+				locked[edges[i] & 0xffffffff] = 1;
+			}
+			i = last;
+		}
+	}
+
+	// --ʒuƂɁA̎Op`̕ʂ񎟌덷-- //
+	std::vector<Quadric> quadrics(positionCount);
+	Float3 min = vertexes[dst[0]].pos, max = min;
+	for (size_t i = 0; i < indexCount; i += 3) {
+		const Float3& p0 = vertexes[dst[i + 0]].pos;
+		const Float3& p1 = vertexes[dst[i + 1]].pos;
+		const Float3& p2 = vertexes[dst[i + 2]].pos;
+		Float3 normal = Cross(Sub(p1, p0), Sub(p2, p0));
+		double length = std::sqrt(Dot(normal, normal));
+		if (length > 0.0) {
+			double a = normal.x / length, b = normal.y / length, c = normal.z / length;
+			double d = -(a * p0.x + b * p0.y + c * p0.z);
+			for (size_t k = 0; k < 3; k++) quadrics[positionId[dst[i + k]]].AddPlane(a, b, c, d, length * 0.5);
+		}
+
+		for (size_t k = 0; k < 3; k++) {
+			const Float3& p = vertexes[dst[i + k]].pos;
+			min = Float3(std::min(min.x, p.x), std::min(min.y, p.y), std::min(min.z, p.z));
+			max = Float3(std::max(max.x, p.x), std::max(max.y, p.y), std::max(max.z, p.z));
+		}
+	}
+
+	// 덷errorExtent(w肪AABB̈Ԓ)ɑ΂銄ň
+	const double extent = errorExtent > 0.0f ? double(errorExtent) : std::max(std::max(max.x - min.x, max.y - min.y), max.z - min.z);
+	const double errorLimit = double(targetError) * extent;
+	const double costLimit = errorLimit * errorLimit;
+	double maxCost = 0.0;
+
+	// --kɕčs(1̒ł́Ak񂵂_̎ɂ͐GȂ)-- //
+	std::vector<uint32_t> adjacencyFirst(vertexCount + 1);
+	std::vector<uint32_t> adjacency;
+	std::vector<uint32_t> remap(vertexCount);
+	std::vector<char> touched(vertexCount);
+	std::vector<uint32_t> neighborStamp(positionCount, 0);
+	uint32_t stamp = 0;
+	std::vector<Collapse> collapses;
+
+	while (indexCount > targetIndexCount) {
+		const size_t triangleCount = indexCount / 3;
+
+		// --_ -> ̒_gOp` ̕\(CSR`)-- //
+		std::fill(adjacencyFirst.begin(), adjacencyFirst.end(), 0);
+		for (size_t i = 0; i < indexCount; i++) adjacencyFirst[dst[i] + 1]++;
+		for (size_t v = 0; v < vertexCount; v++) adjacencyFirst[v + 1] += adjacencyFirst[v];
+		adjacency.resize(indexCount);
+		{
+			std::vector<uint32_t> cursor(adjacencyFirst.begin(), adjacencyFirst.end() - 1);
+			for (size_t i = 0; i < indexCount; i++) adjacency[cursor[dst[i]]++] = static_cast<uint32_t>(i / 3);
+		}
+
+		// --钸_ƂɈԌ덷̏ӂIсA덷̏ɕׂ-- //
+		collapses.clear();
+		for (uint32_t from = 0; from < vertexCount; from++) {
+			if (locked[positionId[from]] || adjacencyFirst[from] == adjacencyFirst[from + 1]) continue;
+			Collapse best = { from, from, 0.0 };
+			for (uint32_t t = adjacencyFirst[from]; t < adjacencyFirst[from + 1]; t++) {
+				const uint32_t* triangle = dst + adjacency[t] * 3;
+				for (size_t k = 0; k < 3; k++) {
+					uint32_t to = triangle[k];
+					if (to == from) continue;
+					Quadric quadric = quadrics[positionId[from]];
+					quadric += quadrics[positionId[to]];
+					double cost = quadric.Evaluate(vertexes[to].pos);
+					if (best.to == from || cost < best.cost) best = { from, to, cost };
+				}
+			}
+			collapses.push_back(best);
+		}
+		std::sort(collapses.begin(), collapses.end(), [](const Collapse& a, const Collapse& b) { return a.cost < b.cost; });
+
+		// --덷̏ɏk񂷂-- //
+		for (uint32_t v = 0; v < vertexCount; v++) remap[v] = v;
+		std::fill(touched.begin(), touched.end(), 0);
+		size_t remaining = triangleCount;
+		size_t collapseCount = 0;
+		for (const Collapse& collapse : collapses) {
+			if (remaining * 3 <= targetIndexCount || collapse.cost > costLimit) break;
+			const uint32_t from = collapse.from, to = collapse.to;
+			if (touched[from] || touched[to]) continue;
+
+			// kŏOp`(g)ƁAcOp`ԂȂ𒲂ׂ
+			bool isValid = true;
+			size_t removed = 0;
+			stamp++;
+			for (uint32_t t = adjacencyFirst[from]; t < adjacencyFirst[from + 1] && isValid; t++) {
+				const uint32_t* triangle = dst + adjacency[t] * 3;
+				bool hasTo = false;
+				for (size_t k = 0; k < 3; k++) {
+					if (triangle[k] != from) neighborStamp[positionId[triangle[k]]] = stamp;
+					hasTo = hasTo || triangle[k] == to;
+				}
+				if (hasTo) {
+					removed++;
+					continue;
+				}
+
+				Float3 p[3], q[3];
+				for (size_t k = 0; k < 3; k++) {
+					p[k] = vertexes[triangle[k]].pos;
+					q[k] = triangle[k] == from ? vertexes[to].pos : p[k];
+				}
+				Float3 before = Cross(Sub(p[1], p[0]), Sub(p[2], p[0]));
+				Float3 after = Cross(Sub(q[1], q[0]), Sub(q[2], q[0]));
+				if (Dot(before, after) <= 0.0) isValid = false;
+			}
+
+			// ̒_ɋʂėאڂ钸_́AOp`̌̒_łȂ΂ȂȂ(dȂȂ)
+			if (isValid) {
+				size_t common = 0;
+				uint32_t counted = ++stamp;
+				for (uint32_t t = adjacencyFirst[to]; t < adjacencyFirst[to + 1]; t++) {
+					const uint32_t* triangle = dst + adjacency[t] * 3;
+					for (size_t k = 0; k < 3; k++) {
+						uint32_t position = positionId[triangle[k]];
+						if (triangle[k] == to || neighborStamp[position] != counted - 1) continue;
+						neighborStamp[position] = counted;
+						common++;
+					}
+				}
+				isValid = removed > 0 && common == removed;
+			}
+			if (!isValid) continue;
+
+			// --k񂷂-- //
+			remap[from] = to;
+			quadrics[positionId[to]] += quadrics[positionId[from]];
+			maxCost = std::max(maxCost, collapse.cost);
+			remaining -= removed;
+			collapseCount++;
+
+			// ̒_͂̎ł͂Ȃ
+			for (uint32_t t = adjacencyFirst[from]; t < adjacencyFirst[from + 1]; t++) {
+				const uint32_t* triangle = dst + adjacency[t] * 3;
+				for (size_t k = 0; k < 3; k++) touched[triangle[k]] = 1;
+			}
+		}
+		if (collapseCount == 0) break;
+
+		// --CfbNXtւāAԂꂽOp`菜-- //
+		size_t write = 0;
+		for (size_t i = 0; i < indexCount; i += 3) {
+			uint32_t a = remap[dst[i + 0]], b = remap[dst[i + 1]], c = remap[dst[i + 2]];
+			if (positionId[a] == positionId[b] || positionId[b] == positionId[c] || positionId[c] == positionId[a]) continue;
+			dst[write + 0] = a;
+			dst[write + 1] = b;
+			dst[write + 2] = c;
+			write += 3;
+		}
+		indexCount = write;
+	}
+
+	if (resultError && extent > 0.0) *resultError = static_cast<float>(std::sqrt(maxCost) / extent);
+	return indexCount;
+}
+
+// --LOD-- //
+void MeshGenerateLods(MeshData* mesh, const float* ratios, size_t ratioCount, float maxError)
+{
+	// TuZbgLODꍇ͑Ŝ1̃TuZbgƂĈ
+	if (mesh->subsets.empty()) {
+		mesh->subsets.push_back({ 0, 0, static_cast<uint32_t>(mesh->indexes.size()), MeshBounds{} });
+		mesh->lods.clear();
+	}
+	if (mesh->lods.empty()) mesh->lods.push_back({ 0.0f, 0, static_cast<uint32_t>(mesh->subsets.size()) });
+	if (mesh->vertexes.empty()) return;
+
+	// 덷f̍Wnł̋ɒ߂̑傫(AABB̈Ԓ)
+	const MeshLod base = mesh->lods[0];
+	Float3 min = mesh->vertexes[0].pos, max = min;
+	for (const MeshVertex& vertex : mesh->vertexes) {
+		min = Float3(std::min(min.x, vertex.pos.x), std::min(min.y, vertex.pos.y), std::min(min.z, vertex.pos.z));
+		max = Float3(std::max(max.x, vertex.pos.x), std::max(max.y, vertex.pos.y), std::max(max.z, vertex.pos.z));
+	}
+	const float extent = std::max(std::max(max.x - min.x, max.y - min.y), max.z - min.z);
+
+	size_t previousCount = 0;
+	for (uint32_t i = 0; i < base.subsetCount; i++) previousCount += mesh->subsets[base.subsetStart + i].indexCount;
+
+	std::vector<uint32_t> simplified;
+	for (size_t r = 0; r < ratioCount; r++) {
+		const size_t indexEnd = mesh->indexes.size();
+		MeshLod lod = { 0.0f, static_cast<uint32_t>(mesh->subsets.size()), base.subsetCount };
+		std::vector<MeshSubset> subsets;
+		size_t total = 0;
+
+		// --TuZbgƂɌ̃bV猸炷(}eA̋ڂ͉ɂȂ̂œȂ)-- //
+		// 덷̓fŜ̑傫ɑ΂銄ɂ낦(TuZbgƂ̑傫gƁATuZbǧ덷傫)
+		for (uint32_t i = 0; i < base.subsetCount; i++) {
+			const MeshSubset subset = mesh->subsets[base.subsetStart + i];
+			const size_t target = static_cast<size_t>(subset.indexCount / 3 * ratios[r]) * 3;
+			simplified.resize(subset.indexCount);
+
+			float error = 0.0f;
+			size_t count = MeshSimplify(simplified.data(), mesh->indexes.data() + subset.indexStart, subset.indexCount,
+				mesh->vertexes.data(), mesh->vertexes.size(), target, maxError, &error, extent);
+
+			subsets.push_back({ subset.material, static_cast<uint32_t>(mesh->indexes.size()), static_cast<uint32_t>(count), MeshBounds{} });
+			mesh->indexes.insert(mesh->indexes.end(), simplified.begin(), simplified.begin() + count);
+			lod.error = std::max(lod.error, error * extent);
+			total += count;
+		}
+
+		// OLOD1ȏ㌸点ȂAȏ͍Ȃ
+		if (total * 10 > previousCount * 9) {
+			mesh->indexes.resize(indexEnd);
+			break;
+		}
+		mesh->subsets.insert(mesh->subsets.end(), subsets.begin(), subsets.end());
+		mesh->lods.push_back(lod);
+		previousCount = total;
+	}
+}
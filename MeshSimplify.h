@@ -0,0 +1,19 @@
+#pragma once
+#include "Mesh.h"
+#include <cstddef>
+#include <cstdint>
+
+// --Op`炷(Quadric Error Metricsɂӂ̏k)-- //
+// --ӂ̕Е̒_Е̒_Ɋ񂹂邾Ȃ̂ŁA_f[^͂̂܂܎g(CfbNXς)-- //
+// --(БɂOp`)ƁA@UV̌p(Wɕ̒_)̒_͓Ȃ-- //
+// --CfbNXtargetIndexCountȉɂȂ邩Ȁǩ덷targetError𒴂~߂-- //
+// --덷errorExtentɑ΂銄ŁAresultErrorɂ͎ۂ̌덷-- //
+// --errorExtent0ȉȂA炷͈͂̎Op`AABB̈Ԓӂg(f̈ꕔ炷Ƃ̓fŜ̑傫n)-- //
+// --dstindexCountȏ̗̈ŁAʂ̃CfbNXԂ-- //
+size_t MeshSimplify(uint32_t* dst, const uint32_t* indexes, size_t indexCount, const MeshVertex* vertexes, size_t vertexCount,
+	size_t targetIndexCount, float targetError, float* resultError = nullptr, float errorExtent = 0.0f);
+
+// --̃bV(lods[0])Op`̐ratios{Ɍ炵LODAindexesAsubsetsAlodšɑ-- //
+// --ratios͑傫ɕׂ-- //
+// --덷maxError𒴂đOLOD1ȏ㌸点ȂȂAŎ~߂-- //
+void MeshGenerateLods(MeshData* mesh, const float* ratios, size_t ratioCount, float maxError);
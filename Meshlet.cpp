@@ -0,0 +1,144 @@
+#include "Meshlet.h"
+#include <algorithm>
+#include <vector>
+
+namespace {
+	// --Op`̌vZ-- //
+	inline Float3 Sub(const Float3& a, const Float3& b) { return Float3(a.x - b.x, a.y - b.y, a.z - b.z); }
+	inline Float3 Cross(const Float3& a, const Float3& b) { return Float3(a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x); }
+	inline float Dot(const Float3& a, const Float3& b) { return a.x * b.x + a.y * b.y + a.z * b.z; }
+	inline Float3 MinFloat3(const Float3& a, const Float3& b) { return Float3(std::min(a.x, b.x), std::min(a.y, b.y), std::min(a.z, b.z)); }
+	inline Float3 MaxFloat3(const Float3& a, const Float3& b) { return Float3(std::max(a.x, b.x), std::max(a.y, b.y), std::max(a.z, b.z)); }
+
+	// --גNX^؂-- //
+	// Op`StretchMinTrianglesȏ゠AAABB̑Ίp2悪Op`̖ʐς2{̍vStretchLimit{𒴂Ȃ؂
+	// (̕т͐ɐiނ̂ŁA؂ȂƑт̂悤ɐLтċE傫Ȃ)
+	const uint32_t StretchMinTriangles = 32;
+	const float StretchLimit = 8.0f;
+
+	// --͈͂̎Op`狫EƖ@̉~߂-- //
+	Meshlet MakeMeshlet(const MeshData& mesh, uint32_t indexStart, uint32_t indexCount)
+	{
+		Meshlet meshlet;
+		meshlet.indexStart = indexStart;
+		meshlet.indexCount = indexCount;
+		const uint32_t* indexes = mesh.indexes.data() + indexStart;
+
+		// --E(AABB̒Sԉ_܂ł̋)-- //
+		Float3 min = mesh.vertexes[indexes[0]].pos, max = min;
+		for (uint32_t i = 1; i < indexCount; i++) {
+			const Float3& p = mesh.vertexes[indexes[i]].pos;
+			min = Float3(std::min(min.x, p.x), std::min(min.y, p.y), std::min(min.z, p.z));
+			max = Float3(std::max(max.x, p.x), std::max(max.y, p.y), std::max(max.z, p.z));
+		}
+		const Float3 center((min.x + max.x) * 0.5f, (min.y + max.y) * 0.5f, (min.z + max.z) * 0.5f);
+		float radius = 0.0f;
+		for (uint32_t i = 0; i < indexCount; i++) {
+			Float3 d = Sub(mesh.vertexes[indexes[i]].pos, center);
+			radius = std::max(radius, Dot(d, d));
+		}
+		meshlet.bounds.center = center;
+		meshlet.bounds.radius = std::sqrt(radius);
+
+		// --@̉~(Op`̖@̕ςɂāAԗꂽ@܂ł̊pxLɂ)-- //
+		// \͎vȂ̂ŁAcross(p1 - p0, p2 - p0)̌\ɂȂ
+		std::vector<Float3> normals;
+		normals.reserve(indexCount / 3);
+		Float3 axis(0.0f, 0.0f, 0.0f);
+		for (uint32_t i = 0; i < indexCount; i += 3) {
+			const Float3& p0 = mesh.vertexes[indexes[i + 0]].pos;
+			Float3 normal = Cross(Sub(mesh.vertexes[indexes[i + 1]].pos, p0), Sub(mesh.vertexes[indexes[i + 2]].pos, p0));
+			float length = std::sqrt(Dot(normal, normal));
+			if (length <= 0.0f) continue;// -> ʐ0̎Op`͌Ȃ̂Ŗ
+			normal = Float3(normal.x / length, normal.y / length, normal.z / length);
+			normals.push_back(normal);
+			axis = Float3(axis.x + normal.x, axis.y + normal.y, axis.z + normal.z);
+		}
+
+		meshlet.coneAxis = Float3(0.0f, 0.0f, 1.0f);
+		meshlet.coneCutoff = 1.0f;
+		float axisLength = std::sqrt(Dot(axis, axis));
+		if (axisLength > 0.0f) {
+			axis = Float3(axis.x / axisLength, axis.y / axisLength, axis.z / axisLength);
+			float minDot = 1.0f;
+			for (const Float3& normal : normals) minDot = std::min(minDot, Dot(normal, axis));
+
+			// L肪90x̂Ƃ̔肪ł
+			meshlet.coneAxis = axis;
+			if (minDot > 0.0f) meshlet.coneCutoff = std::sqrt(std::max(1.0f - minDot * minDot, 0.0f));
+		}
+		return meshlet;
+	}
+}
+
+// --TuZbgNX^ɕ-- //
+MeshCacheStats MeshBuildMeshlets(MeshData* mesh, size_t cacheSize)
+{
+	mesh->meshlets.clear();
+
+	// TuZbgꍇ͑Ŝ1̃TuZbgƂĈ
+	std::vector<MeshSubset> subsets = mesh->subsets;
+	if (subsets.empty()) subsets.push_back({ 0, 0, static_cast<uint32_t>(mesh->indexes.size()), MeshBounds{} });
+	std::sort(subsets.begin(), subsets.end(), [](const MeshSubset& a, const MeshSubset& b) { return a.indexStart < b.indexStart; });
+
+	// _Ƃ́AŌɓNX^̔ԍ(NX^ɓĂ邩̔pAԍi߂̂Ŕz𖄂ߒȂĂ悢)
+	std::vector<uint32_t> vertexStamp(mesh->vertexes.size(), 0);
+	uint32_t stamp = 0;
+
+	for (const MeshSubset& subset : subsets) {
+		const uint32_t triangleCount = subset.indexCount / 3;
+		const uint32_t* indexes = mesh->indexes.data() + subset.indexStart;
+
+		// --̕т̂܂܁A𒴂邩גȂ鏊ŋ؂-- //
+		uint32_t start = 0;// -> ̃NX^̐擪̎Op`
+		size_t vertexCount = 0;
+		float area = 0.0f;// ---> Op`̖ʐς2{̍v
+		Float3 boundsMin, boundsMax;
+		for (uint32_t t = 0; t < triangleCount; t++) {
+			const uint32_t* triangle = indexes + t * 3;
+			const Float3& p0 = mesh->vertexes[triangle[0]].pos;
+			const Float3& p1 = mesh->vertexes[triangle[1]].pos;
+			const Float3& p2 = mesh->vertexes[triangle[2]].pos;
+			const Float3 triangleMin = MinFloat3(MinFloat3(p0, p1), p2), triangleMax = MaxFloat3(MaxFloat3(p0, p1), p2);
+			const Float3 normal = Cross(Sub(p1, p0), Sub(p2, p0));
+			const float triangleArea = std::sqrt(Dot(normal, normal));
+
+			if (t > start) {
+				size_t newVertexes = 0;
+				for (size_t k = 0; k < 3; k++) newVertexes += vertexStamp[triangle[k]] != stamp;
+				const Float3 extent = Sub(MaxFloat3(boundsMax, triangleMax), MinFloat3(boundsMin, triangleMin));
+				const bool isFull = vertexCount + newVertexes > MeshletMaxVertices || t - start >= MeshletMaxTriangles;
+				const bool isStretched = t - start >= StretchMinTriangles && Dot(extent, extent) > StretchLimit * (area + triangleArea);
+				if (isFull || isStretched) {
+					mesh->meshlets.push_back({ Sphere(), Float3(), 0.0f, subset.indexStart + start * 3, (t - start) * 3 });
+					start = t;
+				}
+			}
+			if (t == start) {
+				stamp++;
+				vertexCount = 0;
+				area = 0.0f;
+				boundsMin = triangleMin;
+				boundsMax = triangleMax;
+			}
+
+			for (size_t k = 0; k < 3; k++) {
+				if (vertexStamp[triangle[k]] != stamp) {
+					vertexStamp[triangle[k]] = stamp;
+					vertexCount++;
+				}
+			}
+			area += triangleArea;
+			boundsMin = MinFloat3(boundsMin, triangleMin);
+			boundsMax = MaxFloat3(boundsMax, triangleMax);
+		}
+		if (triangleCount > start) mesh->meshlets.push_back({ Sphere(), Float3(), 0.0f, subset.indexStart + start * 3, (triangleCount - start) * 3 });
+	}
+
+	// --_gɕגĂANX^̋EƖ@̉~߂-- //
+	MeshOptimizeVertexFetch(mesh);
+	for (Meshlet& meshlet : mesh->meshlets) meshlet = MakeMeshlet(*mesh, meshlet.indexStart, meshlet.indexCount);
+
+	const size_t baseCount = mesh->subsets.empty() ? mesh->indexes.size() : MeshLodIndexEnd(*mesh, 0);
+	return MeshAnalyzeVertexCache(mesh->indexes.data(), baseCount, mesh->vertexes.size(), cacheSize);
+}
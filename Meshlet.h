@@ -0,0 +1,18 @@
+#pragma once
+#include "Mesh.h"
+#include "MeshOptimizer.h"
+#include <cmath>
+
+// --TuZbg(SLOD)̎Op`A_MeshletMaxVerticesAOp`MeshletMaxTrianglesȉ̃NX^ɕ-- //
+// --Op`͕בւA̕(MeshOptimizě)𒴂鏊גȂ鏊ŋ؂̂ŁA_LbVƃI[o[h[̏Ԃ͂̂܂܎c-- //
+// --ʂmesh->meshletsɓA_gɕגBבւLOD0̒_LbV̓vԂ-- //
+MeshCacheStats MeshBuildMeshlets(MeshData* mesh, size_t cacheSize = MeshCacheSize);
+
+// --_猩ăNX^̎Op`ׂėǂ(_ƃNX^͓Wn)-- //
+// --\͎v(DirectX̊)ŁAEŔ肷̂ŏT߂ɂȂ-- //
+inline bool MeshletIsBackfacing(const Meshlet& meshlet, const Float3& eye) {
+	Float3 toCenter(meshlet.bounds.center.x - eye.x, meshlet.bounds.center.y - eye.y, meshlet.bounds.center.z - eye.z);
+	float distance = std::sqrt(toCenter.x * toCenter.x + toCenter.y * toCenter.y + toCenter.z * toCenter.z);
+	float along = toCenter.x * meshlet.coneAxis.x + toCenter.y * meshlet.coneAxis.y + toCenter.z * meshlet.coneAxis.z;
+	return along >= meshlet.coneCutoff * distance + meshlet.bounds.radius;
+}
@@ -1,24 +1,128 @@
 #include "Model.h"
 
 #include "Texture.h"
-
-// --fǂݍ݂̂-- //
+#include "ObjLoader.h"
+#include "Mesh.h"
+#include "MeshOptimizer.h"
+#include "MeshSimplify.h"
+#include "Meshlet.h"
+#include "MeshQuantize.h"
+#include "ModelCache.h"
+
+// --}eAǂݍ݂̂-- //
 #include <fstream>
 #include <sstream>
 using namespace std;
 
+// --TubV̕בւ̂-- //
+#include <algorithm>
+
+// --obt@ւ̃Rs[-- //
+#include <cstring>
+
+// --œKʂ̏o-- //
+#include <cstdio>
+
 // --DirextX12-- //
 #include "DX12Cmd.h"
 
 ID3D12GraphicsCommandList* Model::cmdList_ = nullptr;// -> R}hXg
 
-Model* Model::CreateModel(std::string fileName) {
+// _f[^MeshVertex̂܂GPUɑ
+static_assert(sizeof(Vertex3D) == sizeof(MeshVertex), "Vertex3D and MeshVertex must have the same layout");
+
+namespace {
+	// --LOD̍(̃bVɑ΂Op`̊ƁA덷̏(AABB̈Ԓӂɑ΂銄))-- //
+	const float LodRatios[] = { 0.5f, 0.25f, 0.125f };
+	const float LodMaxError = 0.02f;
+
+	// --LbV̒_ƃCfbNXk邩(t@C͏Ȃ邪AǂݍݎɓWJ)-- //
+	// kƃ}bvê܂܃obt@֓]łȂȂ̂ŁA茳ōLbV͈kȂ
+	// zzp̃rh(FUMI_PACKAGED_ASSETS`)łk
+#if defined(FUMI_PACKAGED_ASSETS)
+	const bool CompressCache = true;
+#else
+	const bool CompressCache = false;
+#endif
+
+	// --Œ蒷̔zɃRs[(肫Ȃ͐؂̂)-- //
+	template <size_t N>
+	void CopyString(char(&dst)[N], const std::string& src) {
+		size_t length = src.copy(dst, N - 1);
+		dst[length] = '\0';
+	}
+
+	// --LbṼt@C(ǂݍ݂̐ݒ育Ƃɕʂ̃t@CɂāAݒ̈Ⴄǂݍ݂ŏ㏑Ȃ悤ɂ)-- //
+	//  : cube.float.0.fmdlAcube.quantized.0.001.fmdlAcube.float.0.stream.fmdl(Xg[~Oǂݍ)
+	string CacheFileName(const string& modelName, float weldEpsilon, MeshVertexFormat vertexFormat, bool isStreamed) {
+		char settings[64];
+		snprintf(settings, sizeof(settings), ".%s.%.9g%s.fmdl",
+			vertexFormat == MeshVertexFormat::Quantized ? "quantized" : "float", weldEpsilon, isStreamed ? ".stream" : "");
+		return modelName + settings;
+	}
+
+	// --}eALbVɕۑ`ɂ-- //
+	ModelCacheMaterial ToCacheMaterial(const Material& material) {
+		ModelCacheMaterial result{};
+		CopyString(result.name, material.name);
+		result.ambient = { material.ambient.x, material.ambient.y, material.ambient.z };
+		result.diffuse = { material.diffuse.x, material.diffuse.y, material.diffuse.z };
+		result.specular = { material.specular.x, material.specular.y, material.specular.z };
+		result.alpha = material.alpha;
+		CopyString(result.textureFilename, material.textureFilename);
+		return result;
+	}
+
+	// --LbVǂݍ񂾃}eǍ`ɂ-- //
+	Material FromCacheMaterial(const ModelCacheMaterial& material) {
+		Material result;
+		result.name = string(material.name, find(begin(material.name), end(material.name), '\0'));
+		result.ambient = { material.ambient.x, material.ambient.y, material.ambient.z };
+		result.diffuse = { material.diffuse.x, material.diffuse.y, material.diffuse.z };
+		result.specular = { material.specular.x, material.specular.y, material.specular.z };
+		result.alpha = material.alpha;
+		result.textureFilename = string(material.textureFilename, find(begin(material.textureFilename), end(material.textureFilename), '\0'));
+		return result;
+	}
+
+	// --Xg[~Oǂݍ݂̒_ƃCfbNXAGPUɑ`ɂȂLbV֏-- //
+	class CacheStreamSink : public MeshStreamSink {
+	public:
+		CacheStreamSink(ModelCacheWriter* writer, MeshVertexFormat vertexFormat, const MeshQuantization& quantization, size_t indexStride) :
+			writer_(writer), vertexFormat_(vertexFormat), quantization_(quantization), indexStride_(indexStride) {}
+
+		// _ʎq(Quantized̏ꍇ)Aɒǉ
+		bool WriteVertexes(size_t, const MeshVertex* vertexes, size_t count) override {
+			if (vertexFormat_ != MeshVertexFormat::Quantized) return writer_->AppendVertexes(vertexes, count);
+			quantized_.resize(count);
+			MeshQuantizeVertexes(vertexes, count, quantization_, quantized_.data());
+			return writer_->AppendVertexes(quantized_.data(), count);
+		}
+
+		// CfbNXGPUɑTCYɋl߂ď
+		bool WriteIndexes(size_t first, const uint32_t* indexes, size_t count) override {
+			indexBytes_.resize(count * indexStride_);
+			MeshWriteIndexes(indexBytes_.data(), indexes, count, indexStride_);
+			return writer_->WriteIndexes(first, indexBytes_.data(), count);
+		}
+
+	private:
+		ModelCacheWriter* writer_;// ----------------------> ݐ
+		MeshVertexFormat vertexFormat_;// -----------------> _f[^̌`
+		MeshQuantization quantization_;// -----------------> W̗ʎq͈̔
+		size_t indexStride_;// ----------------------------> CfbNX1̃oCg
+		vector<MeshQuantizedVertex> quantized_;// ---------> ʎq_(`N1)
+		vector<uint8_t> indexBytes_;// --------------------> l߂CfbNX(`N1)
+	};
+}
+
+Model* Model::CreateModel(std::string fileName, float weldEpsilon, MeshVertexFormat vertexFormat, bool isSplitStreams, bool isStreamingImport) {
 	Model* model = new Model();
-	model->LoadModel(fileName);
+
+	// fǂݍ(_obt@ƃCfbNXobt@ō쐬)
+	model->LoadModel(fileName, weldEpsilon, vertexFormat, isSplitStreams, isStreamingImport);
 
 	// 萔obt@쐬
-	model->CreateVertexBuff();// ---> _obt@
-	model->CreateIndexBuff();// ----> CfbNXobt@
 	model->CreateMaterialBuff();// -> }eAobt@
 
 	return model;
@@ -28,142 +132,363 @@ void Model::Initialize(ID3D12GraphicsCommandList* cmdList) {
 	cmdList_ = cmdList;
 }
 
-void Model::Draw() {
-	// --SRVq[ṽnh擾-- //
-	D3D12_GPU_DESCRIPTOR_HANDLE srvGpuHandle = Texture::GetSRVHeap()->GetGPUDescriptorHandleForHeapStart();
+void Model::Draw(size_t lod) {
+	Draw(lods_[lod < lods_.size() ? lod : lods_.size() - 1].submeshes);
+}
+
+void Model::Draw(const std::vector<Submesh>& submeshes) {
+	// --SRVq[v̐擪̃nh擾-- //
+	const D3D12_GPU_DESCRIPTOR_HANDLE srvHeapStart = Texture::GetSRVHeap()->GetGPUDescriptorHandleForHeapStart();
+
+	// --_obt@r[̐ݒR}h(STubVŋʁAW𕪂ꍇ2)-- //
+	cmdList_->IASetVertexBuffers(0, isSplitStreams_ ? 2 : 1, vbViews_);
 
-	// --nhw肳ꂽ܂Ői߂-- //
-	srvGpuHandle.ptr += textureHandle_;
+	// --CfbNXobt@r[̐ݒR}h(STubVŋ)-- //
+	cmdList_->IASetIndexBuffer(&ibView_);
+
+	// --TubVƂɕ`(}eAeNX`OƓȂݒ肵ȂȂ)-- //
+	size_t currentMaterial = materials_.size();
+	int currentTexture = -1;
+	for (const Submesh& submesh : submeshes) {
+		const Material& material = materials_[submesh.materialIndex];
 
-	// --萔obt@r[iCBVj̐ݒR}h-- //
-	cmdList_->SetGraphicsRootConstantBufferView(1, materialBuff_->GetGPUVirtualAddress());
+		// --萔obt@r[iCBVj̐ݒR}h-- //
+		if (submesh.materialIndex != currentMaterial) {
+			cmdList_->SetGraphicsRootConstantBufferView(1, materialBuffs_[submesh.materialIndex]->GetGPUVirtualAddress());
+			currentMaterial = submesh.materialIndex;
+		}
 
-	// --w肳ꂽSRV[gp[^1Ԃɐݒ-- //
-	cmdList_->SetGraphicsRootDescriptorTable(2, srvGpuHandle);
+		// --w肳ꂽSRV[gp[^2Ԃɐݒ-- //
+		if (material.textureHandle != currentTexture) {
+			D3D12_GPU_DESCRIPTOR_HANDLE srvGpuHandle = srvHeapStart;
+			srvGpuHandle.ptr += material.textureHandle;
+			cmdList_->SetGraphicsRootDescriptorTable(2, srvGpuHandle);
+			currentTexture = material.textureHandle;
+		}
 
-	// --_obt@r[̐ݒR}h-- //
-	cmdList_->IASetVertexBuffers(0, 1, &vbView_);
+		// --`R}h-- //
+		cmdList_->DrawIndexedInstanced(submesh.indexCount, 1, submesh.indexStart, 0, 0);
+	}
+}
 
-	// --CfbNXobt@r[̐ݒR}h-- //
+void Model::DrawDepth(const std::vector<Submesh>& submeshes) {
+	// --W̒_obt@ݒ(ĂȂꍇ́AׂĂ̗vf̒_obt@Wǂ)-- //
+	cmdList_->IASetVertexBuffers(0, 1, &vbViews_[0]);
 	cmdList_->IASetIndexBuffer(&ibView_);
 
-	//// --`R}h-- //
-	cmdList_->DrawIndexedInstanced(static_cast<UINT>(indexes_.size()), 1, 0, 0, 0);
+	// --}eA؂ւȂ̂ŁACfbNXĂ͈͂͂܂Ƃ߂ĕ`悷-- //
+	UINT indexStart = 0, indexCount = 0;
+	for (const Submesh& submesh : submeshes) {
+		if (indexCount > 0 && submesh.indexStart == indexStart + indexCount) {
+			indexCount += submesh.indexCount;
+			continue;
+		}
+		if (indexCount > 0) cmdList_->DrawIndexedInstanced(indexCount, 1, indexStart, 0, 0);
+		indexStart = submesh.indexStart;
+		indexCount = submesh.indexCount;
+	}
+	if (indexCount > 0) cmdList_->DrawIndexedInstanced(indexCount, 1, indexStart, 0, 0);
 }
 
-void Model::LoadModel(std::string name)
+void Model::Cull(size_t lod, const Frustum& frustum, const Float3& eye, bool isBackfaceCulling, std::vector<Submesh>* visible)
 {
-	// t@CXg[
-	std::ifstream file;
+	visible->clear();
+	for (const Submesh& submesh : lods_[lod < lods_.size() ? lod : lods_.size() - 1].submeshes) {
+		// NX^͈͂͂̂܂ܕ`悷
+		if (submesh.meshletCount == 0) {
+			visible->push_back(submesh);
+			continue;
+		}
 
-	// .objt@CJ
+		// --ƃNX^̋E܂Ƃ߂Ĕ肷-- //
+		meshletVisible_.resize((submesh.meshletCount + 31) / 32);
+		CheckFrustum2Sphere(frustum, &meshletBounds_[submesh.meshletStart], submesh.meshletCount, meshletVisible_.data());
+
+		const size_t first = visible->size();
+		for (UINT i = 0; i < submesh.meshletCount; i++) {
+			const Meshlet& meshlet = meshlets_[submesh.meshletStart + i];
+			if (!((meshletVisible_[i / 32] >> (i % 32)) & 1)) continue;
+			if (isBackfaceCulling && MeshletIsBackfacing(meshlet, eye)) continue;
+
+			// O͈̔͂Ƃ̊Ԃ1NX^ȉȂAԂ`悵ĂȂ
+			if (visible->size() > first) {
+				Submesh& back = visible->back();
+				if (meshlet.indexStart - (back.indexStart + back.indexCount) <= MeshletMaxTriangles * 3) {
+					back.indexCount = meshlet.indexStart + meshlet.indexCount - back.indexStart;
+					back.meshletCount = submesh.meshletStart + i + 1 - back.meshletStart;
+					continue;
+				}
+			}
+			visible->push_back({ meshlet.indexStart, meshlet.indexCount, submesh.materialIndex, submesh.meshletStart + i, 1, submesh.bounds });
+		}
+	}
+}
+
+void Model::LoadModel(std::string name, float weldEpsilon, MeshVertexFormat vertexFormat, bool isSplitStreams, bool isStreamingImport)
+{
+	// .objt@C̃pX
 	const string modelName = name;
 	const string fileName = modelName + ".obj";
 	const string directoryPath = "Resources/" + modelName + "/";
-	file.open(directoryPath + fileName);
+	const string cachePath = directoryPath + CacheFileName(modelName, weldEpsilon, vertexFormat, false);
+
+	// --LbVgȂAOBJ͂Ƀ}bvê܂܃obt@֓]-- //
+	ModelCache cache;
+	vertexFormat_ = vertexFormat;
+	isSplitStreams_ = isSplitStreams;
+	if (cache.Open(cachePath, directoryPath, weldEpsilon, vertexFormat)) {
+		CreateFromCache(cache.GetData(), directoryPath);
+		return;
+	}
 
-	// t@CI[vs`FbN
-	assert(!file.fail());
+	// --w肳Ă΃Xg[~Oǂݍ݂̃LbVgAΏoĂJ-- //
+	// weldEpsilonł܂Ƃ߂ɂ͑ŜKvȂ̂ŁȀꍇ̓Xg[~OɂȂ
+	const bool isStreaming = isStreamingImport && weldEpsilon == 0.0f;
+	const string streamCachePath = directoryPath + CacheFileName(modelName, weldEpsilon, vertexFormat, true);
+	if (isStreaming && (cache.Open(streamCachePath, directoryPath, weldEpsilon, vertexFormat, true) ||
+		(ImportStreaming(directoryPath, fileName, streamCachePath, vertexFormat) &&
+			cache.Open(streamCachePath, directoryPath, weldEpsilon, vertexFormat, true)))) {
+		CreateFromCache(cache.GetData(), directoryPath);
+		return;
+	}
 
-	vector<XMFLOAT3> positions;// -> _W
-	vector<XMFLOAT3> normals;// ---> @xNg
-	vector<XMFLOAT2> texcoords;// -> eNX`UV
+	// t@CŜǂݍŉ͂(傫t@C͕Xbhŉ͂)
+	ObjData obj;
+	bool isLoaded = LoadObj(directoryPath + fileName, &obj);
 
-	size_t num = 0;
+	// t@CI[vA͂̎s`FbN
+	assert(isLoaded);
 
-	// 1sǂݍ
-	string line;
-	while (getline(file, line)) {
-		num++;
+	// _܂Ƃ߂āA_f[^ƃCfbNXf[^(Op`̓}eAƂɕ)
+	MeshData mesh = MeshFromObj(obj);
+	MeshWeld(&mesh, weldEpsilon);
 
-		// 1s̕Xg[ɕϊĉ͂₷
-		std::istringstream line_stream(line);
+	// Op`炵LODACfbNXf[^̌ɑ(_f[^͑SLODŋ)
+	MeshGenerateLods(&mesh, LodRatios, sizeof(LodRatios) / sizeof(LodRatios[0]), LodMaxError);
 
-		// pXy[X؂ōs̐擪擾
-		string key;
-		getline(line_stream, key, ' ');
+	// --_LbVƃI[o[h[炷悤ɎOp`בւA_gɕׂ-- //
+	MeshOptimizeReport report = MeshOptimize(&mesh);
 
-		// 擪[v]Ȃ璸_W
-		if (key == "v") {
-			// X, Y, ZWǂݍ
-			XMFLOAT3 position{};
-			line_stream >> position.x;
-			line_stream >> position.y;
-			line_stream >> position.z;
+	// --JOp̃NX^ɕ(NX^̒ŎOp`ג̂ŁAv͕ג̂̂ɂ)-- //
+	report.after = MeshBuildMeshlets(&mesh);
 
-			// Wf[^ɒǉ
-			positions.emplace_back(position);
-		}
+	// --ŜƃTuZbgƂ̋E߂(ȍ~͍WTuZbg͈̔͂ςȂ)-- //
+	MeshComputeBounds(&mesh);
+	char reportText[256];
+	snprintf(reportText, sizeof(reportText), "%s: ACMR %.3f -> %.3f, ATVR %.3f -> %.3f, clusters %zu, LOD %zu, meshlets %zu\n",
+		fileName.c_str(), report.before.acmr, report.after.acmr, report.before.atvr, report.after.atvr, report.clusterCount, mesh.lods.size(),
+		mesh.meshlets.size());
+	OutputDebugStringA(reportText);
 
-		// 擪[vt]ȂeNX`
-		if (key == "vt") {
-			// U, Vǂݍ
-			XMFLOAT2 texcoord{};
-			line_stream >> texcoord.x;
-			line_stream >> texcoord.y;
+	// CfbNXGPUɑTCY(_16bitɎ܂Ȃ16bitA܂ȂȂ32bit)ɋl߂
+	size_t indexStride = MeshIndexStride(mesh.vertexes.size());
+	vector<uint8_t> indexes(indexStride * mesh.indexes.size());
+	MeshWriteIndexes(indexes.data(), mesh.indexes.data(), mesh.indexes.size(), indexStride);
 
-			// V]
-			texcoord.y = 1.0 - texcoord.y;
+	// --}eAǂݍ(bṼ}eAԍ̏ɒǉ)-- //
+	vector<ModelCacheMaterial> cacheMaterials;
+	for (const Material& material : LoadMaterials(directoryPath, obj.mtllibs, mesh.materialNames)) {
+		AddMaterial(material, directoryPath);
+		cacheMaterials.push_back(ToCacheMaterial(material));
+	}
 
-			// eNX`Wf[^ǉ
-			texcoords.emplace_back(texcoord);
-		}
+	// --_f[^ʎqꍇ́AAABB16oCǧ`ɋl߂-- //
+	const void* vertexes = mesh.vertexes.data();
+	vector<MeshQuantizedVertex> quantizedVertexes;
+	if (vertexFormat == MeshVertexFormat::Quantized) {
+		quantization_ = MeshComputeQuantization(mesh.vertexes.data(), mesh.vertexes.size());
+		quantizedVertexes.resize(mesh.vertexes.size());
+		MeshQuantizeVertexes(mesh.vertexes.data(), mesh.vertexes.size(), quantization_, quantizedVertexes.data());
+		vertexes = quantizedVertexes.data();
+	}
 
-		// 擪[vn]Ȃ@xNg
-		if (key == "vn") {
-			// X, Y, Zǂݍ
-			XMFLOAT3 normal{};
-			line_stream >> normal.x;
-			line_stream >> normal.y;
-			line_stream >> normal.z;
+	// obt@쐬
+	CreateVertexBuff(vertexes, mesh.vertexes.size());
+	CreateIndexBuff(indexes.data(), mesh.indexes.size(), indexStride);
+	SetMeshlets(mesh.meshlets.data(), mesh.meshlets.size());
+	CreateLods(mesh.subsets.data(), mesh.lods.data(), mesh.lods.size());
+	bounds_ = mesh.bounds;
+
+	// --̓ǂݍݗpɃLbVo-- //
+	vector<string> sources = { fileName };
+	sources.insert(sources.end(), obj.mtllibs.begin(), obj.mtllibs.end());
+
+	ModelCacheData data;
+	data.vertexes = vertexes;
+	data.vertexCount = mesh.vertexes.size();
+	data.vertexFormat = vertexFormat;
+	data.quantization = quantization_;
+	data.indexes = indexes.data();
+	data.indexCount = mesh.indexes.size();
+	data.indexStride = indexStride;
+	data.materials = cacheMaterials.data();
+	data.materialCount = cacheMaterials.size();
+	data.subsets = mesh.subsets.data();
+	data.subsetCount = mesh.subsets.size();
+	data.lods = mesh.lods.data();
+	data.lodCount = mesh.lods.size();
+	data.meshlets = mesh.meshlets.data();
+	data.meshletCount = mesh.meshlets.size();
+	data.bounds = mesh.bounds;
+	ModelCache::Write(cachePath, directoryPath, sources, weldEpsilon, data, CompressCache);
+}
 
-			// @xNgf[^ɒǉ
-			normals.emplace_back(normal);
-		}
+void Model::CreateFromCache(const ModelCacheData& data, const std::string& directoryPath)
+{
+	// --}bvê܂܃obt@֓]-- //
+	quantization_ = data.quantization;
+	CreateVertexBuff(data.vertexes, data.vertexCount);
+	CreateIndexBuff(data.indexes, data.indexCount, data.indexStride);
+	for (size_t i = 0; i < data.materialCount; i++) AddMaterial(FromCacheMaterial(data.materials[i]), directoryPath);
+	SetMeshlets(data.meshlets, data.meshletCount);
+	CreateLods(data.subsets, data.lods, data.lodCount);
+	bounds_ = data.bounds;
+}
+
+bool Model::ImportStreaming(const std::string& directoryPath, const std::string& fileName, const std::string& cachePath,
+	MeshVertexFormat vertexFormat)
+{
+	// --1 : ƒ_W͈̔͂W߂(t@C̓}bvĐ擪珇ɓǂ)-- //
+	MappedFile file;
+	if (!file.Open(directoryPath + fileName)) return false;
+	const char* begin = reinterpret_cast<const char*>(file.GetData());
+	const char* end = begin + file.GetSize();
+
+	ObjScan scan;
+	if (!ScanObj(begin, end, &scan) || scan.triangleCount == 0) return false;
+
+	// W̗ʎq͈̔͂1ڂŋ߂AABBɂ(ʂŎgĂȂW܂ނ̂ŁALȂ邱Ƃ)
+	MeshQuantization quantization;
+	if (vertexFormat == MeshVertexFormat::Quantized) {
+		quantization.offset = scan.boxMin;
+		quantization.scale = Float3(scan.boxMax.x - scan.boxMin.x, scan.boxMax.y - scan.boxMin.y, scan.boxMax.z - scan.boxMin.z);
+	}
+
+	// --}eAǂݍ(eNX`̓LbVJƂɓǂݍ)-- //
+	vector<ModelCacheMaterial> cacheMaterials;
+	for (const Material& material : LoadMaterials(directoryPath, scan.mtllibs, scan.materialNames)) {
+		cacheMaterials.push_back(ToCacheMaterial(material));
+	}
+
+	// --_͍Ō܂ŕȂ̂ŁACfbNX̃TCY͒_̏Ō߂-- //
+	const MeshLod lod = { 0.0f, 0, static_cast<uint32_t>(scan.materialNames.size()) };
+	ModelCacheData data;
+	data.vertexFormat = vertexFormat;
+	data.quantization = quantization;
+	data.indexCount = scan.triangleCount * 3;
+	data.indexStride = MeshIndexStride(MeshStreamMaxVertexCount(scan));
+	data.materials = cacheMaterials.data();
+	data.materialCount = cacheMaterials.size();
+	data.subsetCount = scan.materialNames.size();
+	data.lods = &lod;
+	data.lodCount = 1;
+
+	vector<string> sources = { fileName };
+	sources.insert(sources.end(), scan.mtllibs.begin(), scan.mtllibs.end());
+
+	ModelCacheWriter writer;
+	if (!writer.Begin(cachePath, directoryPath, sources, data)) return false;
+
+	// --2 : _ƃCfbNX`NƂɃLbV֏-- //
+	CacheStreamSink sink(&writer, vertexFormat, quantization, data.indexStride);
+	MeshData layout;
+	size_t vertexCount = 0;
+	if (!MeshFromObjStream(begin, end, scan, &sink, &layout, &vertexCount)) return false;
+	if (!writer.End(layout.subsets.data(), layout.bounds)) return false;
+
+	char reportText[256];
+	snprintf(reportText, sizeof(reportText), "%s: streaming import, vertices %zu, triangles %zu, estimated memory %.1f MB\n",
+		fileName.c_str(), vertexCount, scan.triangleCount, MeshStreamMemorySize(scan) / (1024.0 * 1024.0));
+	OutputDebugStringA(reportText);
+	return true;
+}
 
-		// 擪[f]Ȃ|S(Op`)
-		if (key == "f") {
-			// pXy[X؂ōs̑ǂݍ
-			string index_string;
-			while (getline(line_stream, index_string, ' ')) {
-				// _CfbNX1̕Xg[ɕϊĉ͂₷
-				std::istringstream index_stream(index_string);
-				unsigned short indexPosition, indexNormal, indexTexcoord;
-				index_stream >> indexPosition;
-				index_stream.seekg(1, ios_base::cur);// -> XbV΂
-				index_stream >> indexTexcoord;
-				index_stream.seekg(1, ios_base::cur);// -> XbV΂
-				index_stream >> indexNormal;
-
-				// _f[^̒ǉ
-				Vertex3D vertex{};
-				vertex.pos = positions[indexPosition - 1];
-				vertex.normal = normals[indexNormal - 1];
-				vertex.uv = texcoords[indexTexcoord - 1];
-				vertexes_.emplace_back(vertex);
-
-				// _CfbNXɒǉ
-				indexes_.emplace_back((unsigned short)indexes_.size());
+vector<Material> Model::LoadMaterials(const std::string& directoryPath, const std::vector<std::string>& mtllibs,
+	const std::vector<std::string>& materialNames)
+{
+	vector<Material> loadedMaterials;
+	for (const string& mtllib : mtllibs) {
+		LoadMaterial(directoryPath, mtllib, &loadedMaterials);
+	}
+
+	// --usemtlŎgĂ}eAAmaterialNames̏ɕׂ-- //
+	// usemtl̑O̖ʂ́A܂łƓ悤ɍŌɓǂݍ񂾃}eAg
+	// Ȃ}eA̓ftHg̃}eAɂ
+	vector<Material> materials;
+	for (const string& materialName : materialNames) {
+		Material material;
+		material.name = materialName;
+		if (materialName.empty() && !loadedMaterials.empty()) material = loadedMaterials.back();
+		for (const Material& loaded : loadedMaterials) {
+			if (loaded.name == materialName) {
+				material = loaded;
+				break;
 			}
 		}
+		materials.push_back(material);
+	}
+	return materials;
+}
+
+void Model::AddMaterial(const Material& material, const std::string& directoryPath)
+{
+	materials_.push_back(material);
 
-		// 擪[mtllib]Ȃ}eA
-		if (key == "mtllib") {
-			string fileName;
-			line_stream >> fileName;
+	// eNX`ǂݍ(t@C͓nhɂȂ)
+	if (!material.textureFilename.empty()) {
+		materials_.back().textureHandle = LoadTexture(directoryPath + material.textureFilename);
+	}
+}
 
-			// }eAǂݍ
-			LoadMaterial(directoryPath, fileName);
+void Model::CreateLods(const MeshSubset* subsets, const MeshLod* lods, size_t lodCount)
+{
+	lods_.resize(lodCount);
+	for (size_t lod = 0; lod < lodCount; lod++) {
+		lods_[lod].error = lods[lod].error;
+		std::vector<Submesh>& submeshes = lods_[lod].submeshes;
+		submeshes.clear();
+		for (size_t i = lods[lod].subsetStart; i < lods[lod].subsetStart + lods[lod].subsetCount; i++) {
+			if (subsets[i].indexCount == 0) continue;
+
+			// ͈͂ɓĂNX^T(NX^̓CfbNẌʒȕɕł)
+			const uint32_t indexEnd = subsets[i].indexStart + subsets[i].indexCount;
+			auto first = lower_bound(meshlets_.begin(), meshlets_.end(), subsets[i].indexStart,
+				[](const Meshlet& meshlet, uint32_t index) { return meshlet.indexStart < index; });
+			auto last = lower_bound(first, meshlets_.end(), indexEnd,
+				[](const Meshlet& meshlet, uint32_t index) { return meshlet.indexStart < index; });
+
+			submeshes.push_back({ subsets[i].indexStart, subsets[i].indexCount, subsets[i].material,
+				static_cast<UINT>(first - meshlets_.begin()), static_cast<UINT>(last - first), subsets[i].bounds });
 		}
+
+		// eNX`TubVA̒Ń}eATubV悤ɕׂ
+		sort(submeshes.begin(), submeshes.end(), [this](const Submesh& a, const Submesh& b) {
+			int textureA = materials_[a.materialIndex].textureHandle;
+			int textureB = materials_[b.materialIndex].textureHandle;
+			if (textureA != textureB) return textureA < textureB;
+			if (a.materialIndex != b.materialIndex) return a.materialIndex < b.materialIndex;
+			return a.indexStart < b.indexStart;
+		});
 	}
+}
 
-	num = num;
+size_t Model::GetMemorySize() const
+{
+	size_t size = vbViews_[0].SizeInBytes + (isSplitStreams_ ? vbViews_[1].SizeInBytes : 0) + ibView_.SizeInBytes;
+	size += positions_.size() * sizeof(Float3);
+	size += materialBuffs_.size() * ((sizeof(MaterialBuff) + 0xff) & ~0xff);
+	size += meshlets_.size() * (sizeof(Meshlet) + sizeof(Sphere));
+	return size;
+}
 
-	// t@C
-	file.close();
+void Model::SetMeshlets(const Meshlet* meshlets, size_t meshletCount)
+{
+	meshlets_.assign(meshlets, meshlets + meshletCount);
+	meshletBounds_.resize(meshletCount);
+	for (size_t i = 0; i < meshletCount; i++) meshletBounds_[i] = meshlets[i].bounds;
 }
 
-void Model::LoadMaterial(const std::string& directoryPath, const std::string& fileName) {
+void Model::LoadMaterial(const std::string& directoryPath, const std::string& fileName, std::vector<Material>* materials) {
 	// t@CXg[
 	ifstream file;
 
@@ -188,40 +513,43 @@ void Model::LoadMaterial(const std::string& directoryPath, const std::string& fi
 			key.erase(key.begin());
 		}
 
-		// 擪[newmtl]Ȃ}eA
+		// 擪[newmtl]ȂV}eA
 		if (key == "newmtl") {
 			// }eAǂݍ
-			line_stream >> material_.name;
+			materials->emplace_back();
+			line_stream >> materials->back().name;
+			continue;
 		}
 
+		// newmtlO̍s͖
+		if (materials->empty()) continue;
+		Material& material = materials->back();
+
 		// 擪[Ka]ȂArGgF
 		if (key == "Ka") {
-			line_stream >> material_.ambient.x;
-			line_stream >> material_.ambient.y;
-			line_stream >> material_.ambient.z;
+			line_stream >> material.ambient.x;
+			line_stream >> material.ambient.y;
+			line_stream >> material.ambient.z;
 		}
 
 		// 擪[Kd]ȂfBtF[YE
 		if (key == "Kd") {
-			line_stream >> material_.diffuse.x;
-			line_stream >> material_.diffuse.y;
-			line_stream >> material_.diffuse.z;
+			line_stream >> material.diffuse.x;
+			line_stream >> material.diffuse.y;
+			line_stream >> material.diffuse.z;
 		}
 
 		// 擪[Ks]ȂXyL[F
 		if (key == "Ks") {
-			line_stream >> material_.specular.x;
-			line_stream >> material_.specular.y;
-			line_stream >> material_.specular.z;
+			line_stream >> material.specular.x;
+			line_stream >> material.specular.y;
+			line_stream >> material.specular.z;
 		}
 
 		// 擪[map_Kd]ȂeNX`t@C
 		if (key == "map_Kd") {
-			// eNX`̃t@Cǂݍ
-			line_stream >> material_.textureFilename;
-
-			// eNX`ǂݍ
-			textureHandle_ = LoadTexture(directoryPath + material_.textureFilename);
+			// eNX`̃t@Cǂݍ(eNX`͎g}eAAddMaterialœǂݍ)
+			line_stream >> material.textureFilename;
 		}
 	}
 
@@ -229,13 +557,19 @@ void Model::LoadMaterial(const std::string& directoryPath, const std::string& fi
 	file.close();
 }
 
-void Model::CreateVertexBuff()
+void Model::CreateVertexBuff(const void* vertexes, size_t vertexCount)
 {
 	// ֐s̐ۂ𔻕ʗp̕ϐ
 	HRESULT result;
 
 	// _f[^Ŝ̃TCY = _f[^̃TCY * _f[^̗vf
-	UINT sizeVB = static_cast<UINT>(sizeof(vertexes_[0]) * vertexes_.size());
+	const size_t vertexStride = MeshVertexStride(vertexFormat_);
+	UINT sizeVB = static_cast<UINT>(vertexStride * vertexCount);
+
+	// W𕪂ꍇ́AW̌(256oCgE)ɖ@UVu
+	const size_t positionStride = MeshPositionStride(vertexFormat_);
+	const UINT attributeOffset = static_cast<UINT>((positionStride * vertexCount + 0xff) & ~size_t(0xff));
+	if (isSplitStreams_) sizeVB = attributeOffset + static_cast<UINT>((vertexStride - positionStride) * vertexCount);
 
 	// --_obt@̐ݒ-- //
 	D3D12_HEAP_PROPERTIES heapProp{}; // q[vݒ
@@ -262,32 +596,49 @@ void Model::CreateVertexBuff()
 	assert(SUCCEEDED(result));
 
 	// --_obt@r[̍쐬-- //
-	vbView_.BufferLocation = vertexBuff_->GetGPUVirtualAddress();// -> GPUzAhX
-	vbView_.SizeInBytes = sizeVB;// -> _obt@̃TCY
-	vbView_.StrideInBytes = sizeof(vertexes_[0]);// -> _1̃f[^TCY
+	if (isSplitStreams_) {
+		vbViews_[0].BufferLocation = vertexBuff_->GetGPUVirtualAddress();// -> WGPUzAhX
+		vbViews_[0].SizeInBytes = static_cast<UINT>(positionStride * vertexCount);// -> W̃TCY
+		vbViews_[0].StrideInBytes = static_cast<UINT>(positionStride);// -> W1̃f[^TCY
+		vbViews_[1].BufferLocation = vertexBuff_->GetGPUVirtualAddress() + attributeOffset;// -> @UVGPUzAhX
+		vbViews_[1].SizeInBytes = sizeVB - attributeOffset;// -> @UṼTCY
+		vbViews_[1].StrideInBytes = static_cast<UINT>(vertexStride - positionStride);// -> @UV1̃f[^TCY
+	}
+	else {
+		vbViews_[0].BufferLocation = vertexBuff_->GetGPUVirtualAddress();// -> GPUzAhX
+		vbViews_[0].SizeInBytes = sizeVB;// -> _obt@̃TCY
+		vbViews_[0].StrideInBytes = static_cast<UINT>(vertexStride);// -> _1̃f[^TCY
+	}
 
 	// --MapŃCGPŨRÂ-- //
-	Vertex3D* vertMap = nullptr;
-	result = vertexBuff_->Map(0, nullptr, (void**)&vertMap);
+	uint8_t* vertMap = nullptr;
+	result = vertexBuff_->Map(0, nullptr, reinterpret_cast<void**>(&vertMap));
 	assert(SUCCEEDED(result));
 
-	// --S_ɑ΂-- //
-	for (int i = 0; i < vertexes_.size(); i++)
-	{
-		vertMap[i] = vertexes_[i]; // WRs[
-	}
+	// --S_܂Ƃ߂ăRs[(W𕪂ꍇ́AWƂȊOɕȂRs[)-- //
+	if (isSplitStreams_) MeshSplitVertexes(vertexes, vertexCount, vertexFormat_, vertMap, vertMap + attributeOffset);
+	else memcpy(vertMap, vertexes, sizeVB);
 
 	// --q-- //
 	vertexBuff_->Unmap(0, nullptr);
+
+	// --CPUŎgWc(ʎq_̓VF[_[ƓvZŖ߂)-- //
+	if (isSplitStreams_) {
+		positions_.resize(vertexCount);
+		MeshExtractPositions(vertexes, vertexCount, vertexFormat_, quantization_, positions_.data());
+	}
 }
 
-void Model::CreateIndexBuff()
+void Model::CreateIndexBuff(const void* indexes, size_t indexCount, size_t indexStride)
 {
 	// ֐s̐ۂ𔻕ʗp̕ϐ
 	HRESULT result;
 
+	// --CfbNX-- //
+	indexCount_ = static_cast<UINT>(indexCount);
+
 	// --CfbNXf[^Ŝ̃TCY-- //
-	UINT sizeIB = static_cast<UINT>(sizeof(uint16_t) * indexes_.size());
+	UINT sizeIB = static_cast<UINT>(indexStride * indexCount);
 
 	// --_obt@̐ݒ-- //
 	D3D12_HEAP_PROPERTIES heapProp{}; // q[vݒ
@@ -315,19 +666,16 @@ void Model::CreateIndexBuff()
 
 	// --CfbNXobt@r[쐬-- //
 	ibView_.BufferLocation = indexBuff_->GetGPUVirtualAddress();
-	ibView_.Format = DXGI_FORMAT_R16_UINT;
+	ibView_.Format = indexStride == sizeof(uint16_t) ? DXGI_FORMAT_R16_UINT : DXGI_FORMAT_R32_UINT;
 	ibView_.SizeInBytes = sizeIB;
 
 	// --CfbNXobt@}bsO-- //
-	uint16_t* indexMap = nullptr;
-	result = indexBuff_->Map(0, nullptr, (void**)&indexMap);
+	void* indexMap = nullptr;
+	result = indexBuff_->Map(0, nullptr, &indexMap);
 	assert(SUCCEEDED(result));
 
-	// --SCfbNXɑ΂-- //
-	for (size_t i = 0; i < indexes_.size(); i++)
-	{
-		indexMap[i] = indexes_[i];
-	}
+	// --SCfbNX܂Ƃ߂ăRs[-- //
+	memcpy(indexMap, indexes, sizeIB);
 
 	// --}bsO-- //
 	indexBuff_->Unmap(0, nullptr);
@@ -338,6 +686,9 @@ void Model::CreateMaterialBuff()
 	// ֐s̐ۂ𔻕ʗp̕ϐ
 	HRESULT result;
 
+	// }eAƂ1
+	materialBuffs_.resize(materials_.size());
+
 	// 萔obt@̃q[vݒ
 	D3D12_HEAP_PROPERTIES heapProp{};
 	heapProp.Type = D3D12_HEAP_TYPE_UPLOAD;
@@ -352,23 +703,25 @@ void Model::CreateMaterialBuff()
 	resdesc.SampleDesc.Count = 1;
 	resdesc.Layout = D3D12_TEXTURE_LAYOUT_ROW_MAJOR;
 
-	// 萔obt@̐
-	result = DX12Cmd::GetDevice()->CreateCommittedResource(
-		&heapProp,
-		D3D12_HEAP_FLAG_NONE,
-		&resdesc,
-		D3D12_RESOURCE_STATE_GENERIC_READ,
-		nullptr,
-		IID_PPV_ARGS(&materialBuff_));
-	assert(SUCCEEDED(result));
-
-	// }eA萔obt@̃}bsO
-	MaterialBuff* materialMap;
-	result = materialBuff_->Map(0, nullptr, (void**)&materialMap);
-	assert(SUCCEEDED(result));
-	materialMap->ambient = material_.ambient;
-	materialMap->diffuse = material_.diffuse;
-	materialMap->specular = material_.specular;
-	materialMap->alpha = material_.alpha;
-	materialBuff_->Unmap(0, nullptr);
+	for (size_t i = 0; i < materials_.size(); i++) {
+		// 萔obt@̐
+		result = DX12Cmd::GetDevice()->CreateCommittedResource(
+			&heapProp,
+			D3D12_HEAP_FLAG_NONE,
+			&resdesc,
+			D3D12_RESOURCE_STATE_GENERIC_READ,
+			nullptr,
+			IID_PPV_ARGS(&materialBuffs_[i]));
+		assert(SUCCEEDED(result));
+
+		// }eA萔obt@̃}bsO
+		MaterialBuff* materialMap;
+		result = materialBuffs_[i]->Map(0, nullptr, (void**)&materialMap);
+		assert(SUCCEEDED(result));
+		materialMap->ambient = materials_[i].ambient;
+		materialMap->diffuse = materials_[i].diffuse;
+		materialMap->specular = materials_[i].specular;
+		materialMap->alpha = materials_[i].alpha;
+		materialBuffs_[i]->Unmap(0, nullptr);
+	}
 }
\ No newline at end of file
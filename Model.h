@@ -17,6 +17,12 @@ using namespace Microsoft::WRL;
 // NX
 #include <string>
 
+// fLbV
+#include "ModelCache.h"
+
+// NX^̃JO
+#include "Collision.h"
+
 // _f[^
 struct Vertex3D {
 	XMFLOAT3 pos;// ----> W
@@ -42,6 +48,7 @@ struct Material {
 	XMFLOAT3 specular;// -> XyL[ex
 	float alpha;// -> At@
 	std::string textureFilename;// -> eNX`t@C
+	int textureHandle;// -> eNX`nh
 
 	// RXgN^
 	Material() {
@@ -49,50 +56,147 @@ struct Material {
 		diffuse = { 0.0f, 0.0f, 0.0f };
 		specular = { 0.0f, 0.0f, 0.0f };
 		alpha = 1.0f;
+		textureHandle = 0;
 	}
 };
 
+// TubV(}eAŕ`悷CfbNX͈̔)
+struct Submesh {
+	UINT indexStart;// ------> ŏ̃CfbNẌʒu
+	UINT indexCount;// ------> CfbNX
+	size_t materialIndex;// -> }eA̔ԍ
+	UINT meshletStart;// ----> ͈͂ɓĂŏ̃NX^̔ԍ
+	UINT meshletCount;// ----> ͈͂ɓĂNX^
+	MeshBounds bounds;// ----> ͈͂̎Op`͂ދE(f̍WnACullŕ͈͂ł͌̃TubV̋E)
+};
+
+// LOD(ڍדx)Ƃ̕`͈
+struct ModelLod {
+	float error;// -------------------> ̃bV̌덷(f̍Wnł̋ALOD00)
+	std::vector<Submesh> submeshes;// -> TubV(eNX`A}eȀɕׂāA`掞̐؂ւ炷)
+};
+
 class Model {
 public:// oϐ
-	std::vector<Vertex3D> vertexes_;// ----> _f[^
-	D3D12_VERTEX_BUFFER_VIEW vbView_;// ---> _obt@[r[
-	ComPtr<ID3D12Resource> vertexBuff_;// -> _obt@
+	D3D12_VERTEX_BUFFER_VIEW vbViews_[2];// -> _obt@[r[(W𕪂ꍇ[0]WA[1]@UVAȂꍇ[0])
+	ComPtr<ID3D12Resource> vertexBuff_;// ---> _obt@(W𕪂ꍇ͍W̌ɖ@UVu)
+	bool isSplitStreams_;// -----------------> W̒_obt@𕪂
+
+	std::vector<Float3> positions_;// -> CPUŎgW(W𕪂ꍇA_obt@Ɠ)
 
-	std::vector<uint16_t> indexes_;// ----> CfbNXf[^
+	MeshVertexFormat vertexFormat_;// ---> _f[^̌`
+	MeshQuantization quantization_;// ---> W̗ʎq͈̔(Quantized̏ꍇAVF[_[ōW߂̂Ɏg)
+
+	UINT indexCount_;// ------------------> CfbNX
 	D3D12_INDEX_BUFFER_VIEW ibView_;// ---> CfbNXobt@r[
 	ComPtr<ID3D12Resource> indexBuff_;// -> CfbNXobt@
 
-	Material material_;// -------------------> }eAf[^
-	ComPtr<ID3D12Resource> materialBuff_;// -> }eAobt@
+	std::vector<Material> materials_;// -------------------> }eAf[^
+	std::vector<ComPtr<ID3D12Resource>> materialBuffs_;// -> }eAobt@(materials_Ɠ)
+
+	// LODƂ̃TubV(擪̃bVŁAقǎOp`ȂBCfbNXobt@͑SLODŋ)
+	std::vector<ModelLod> lods_;
 
-	// eNX`nh
-	int textureHandle_;
+	MeshBounds bounds_;// --> ׂĂ̒_͂ދE(f̍Wn)
+
+	std::vector<Meshlet> meshlets_;// --------> TubV𕪂NX^(CfbNẌʒȕ)
+	std::vector<Sphere> meshletBounds_;// ----> NX^̋E(Ƃ܂Ƃ߂Ĕ肷邽߂meshlets_甲o)
+	std::vector<uint32_t> meshletVisible_;// -> ̔茋(Ɨp)
 
 	static ID3D12GraphicsCommandList* cmdList_;// -> R}hXg
 
 public:// o֐
 	// [Model]CX^X쐬
-	static Model* CreateModel(std::string fileName);
+	// weldEpsilon0傫ꍇ́Al̍ȉ̒_1ɂ܂Ƃ߂
+	// vertexFormatQuantizedȂ璸_f[^ʎq16oCgɂ(Object3D͗ʎqp̃pCvCŕ`悷)
+	// isSplitStreamstrueȂWl߂_obt@Ɩ@UV̒_obt@ɕACPUŎgWc
+	// ([x`悷pXWǂ߂悤ɂȂ)
+	// isStreamingImporttrueȂOBJŜɓǂݍ܂2񑖍ăLbV(Ɏ܂ɂ傫OBJp)
+	// mۂ郁͌MeshStreamMemorySizeŌςʂɂȂ邪A_WȂǂ̐ɔႷ̂ňł͂Ȃ
+	// LODAœKANX^͂AweldEpsilon0傫ꍇ͒ʏ̓ǂݍ݂ɂȂ
+	static Model* CreateModel(std::string fileName, float weldEpsilon = 0.0f, MeshVertexFormat vertexFormat = MeshVertexFormat::Float,
+		bool isSplitStreams = false, bool isStreamingImport = false);
 
 	// 
 	static void Initialize(ID3D12GraphicsCommandList* cmdList);
 
-	// `揈
-	void Draw();
+	// `揈(lodLOD̐ȏȂԑeLODŕ`悷)
+	void Draw(size_t lod = 0);
+
+	// `揈(CullőI񂾔͈͂`悷)
+	void Draw(const std::vector<Submesh>& submeshes);
+
+	// [x̕`揈(W̒_obt@ݒ肵A}eA͎gȂ)
+	void DrawDepth(const std::vector<Submesh>& submeshes);
+
+	// ̊OƗ̃NX^āA`悷͈͂visibleɓ(frustumeye̓f̍Wn)
+	// ׂ荇͈͂͂ȂāA`R}hȂȂ悤ɂ
+	void Cull(size_t lod, const Frustum& frustum, const Float3& eye, bool isBackfaceCulling, std::vector<Submesh>* visible);
+
+#pragma region Qb^[
+	// _f[^̌`̎擾
+	inline MeshVertexFormat GetVertexFormat() const { return vertexFormat_; }
+
+	// W̗ʎq͈̔͂̎擾
+	inline const MeshQuantization& GetQuantization() const { return quantization_; }
+
+	// ׂĂ̒_͂ދE̎擾(f̍Wn)
+	inline const MeshBounds& GetBounds() const { return bounds_; }
+
+	// W̒_obt@𕪂̎擾
+	inline bool IsSplitStreams() const { return isSplitStreams_; }
+
+	// CPUŎgW̎擾(f̍WnAW𕪂ĂȂꍇ͋)
+	// _obt@Ɠɋl߂ĕł̂ŁACfbNXł̂܂܈
+	inline const Float3* GetPositions() const { return positions_.data(); }
+
+	// CPUŎgW̐̎擾
+	inline size_t GetPositionCount() const { return positions_.size(); }
+
+	// LOD̐̎擾
+	inline size_t GetLodCount() const { return lods_.size(); }
+
+	// LOĎ덷̎擾(f̍Wnł̋)
+	inline float GetLodError(size_t lod) const { return lods_[lod].error; }
+
+	// fgĂ郁ʂ̎擾[oCg](GPŨobt@ƃNX^AeNX`͋LȂ̂Ŋ܂߂Ȃ)
+	size_t GetMemorySize() const;
+#pragma endregion
 
 private:// o֐
-	// fǂݍ
-	void LoadModel(std::string name);
+	// fǂݍ(LbV΂AOBJ͂ăLbV)
+	void LoadModel(std::string name, float weldEpsilon, MeshVertexFormat vertexFormat, bool isSplitStreams, bool isStreamingImport);
+
+	// LbV̒gobt@Ȃǂ쐬
+	void CreateFromCache(const ModelCacheData& data, const std::string& directoryPath);
+
+	// OBJŜɓǂݍ܂2񑖍āALbVo(LODƍœKANX^͂Ȃ)
+	// oɎsfalseԂ
+	static bool ImportStreaming(const std::string& directoryPath, const std::string& fileName, const std::string& cachePath,
+		MeshVertexFormat vertexFormat);
+
+	// }eAǂݍ(newmtlƂmaterialšɒǉ)
+	static void LoadMaterial(const std::string& directoryPath, const std::string& fileName, std::vector<Material>* materials);
+
+	// mtllib̃}eAǂݍŁAmaterialNames̏ɕׂ(eNX`͓ǂݍ܂Ȃ)
+	static std::vector<Material> LoadMaterials(const std::string& directoryPath, const std::vector<std::string>& mtllibs,
+		const std::vector<std::string>& materialNames);
+
+	// }eAǉ(eNX`œǂݍ)
+	void AddMaterial(const Material& material, const std::string& directoryPath);
+
+	// LODƂ̃TubV쐬(`掞̐؂ւȂȂ悤ɕׂANX^͐ɐݒ肵Ă)
+	void CreateLods(const MeshSubset* subsets, const MeshLod* lods, size_t lodCount);
 
-	// }eAǂݍ
-	void LoadMaterial(const std::string& directoryPath, const std::string& fileName);
+	// NX^ݒ
+	void SetMeshlets(const Meshlet* meshlets, size_t meshletCount);
 
-	// _obt@쐬
-	void CreateVertexBuff();
+	// _obt@쐬(vertexesvertexFormat_̌`̕сAisSplitStreams_ȂW𕪂āACPUŎgWc)
+	void CreateVertexBuff(const void* vertexes, size_t vertexCount);
 
-	// CfbNXobt@쐬
-	void CreateIndexBuff();
+	// CfbNXobt@쐬(indexStride24)
+	void CreateIndexBuff(const void* indexes, size_t indexCount, size_t indexStride);
 
-	// }eAobt@쐬
+	// }eAobt@쐬(}eAƂ1)
 	void CreateMaterialBuff();
 };
\ No newline at end of file
@@ -0,0 +1,386 @@
+#include "ModelCache.h"
+#include "MeshCodec.h"
+#include <cstring>
+#include <fstream>
+
+namespace {
+	const char Magic[4] = { 'F', 'M', 'D', 'L' };// -> t@C̎ʎq
+	const uint32_t Version = 11;// --------------------> `⒆g̍ςグ
+	const uint32_t FlagCompressed = 1;// --------------> _f[^ƃCfbNXf[^kĂ
+	const uint32_t FlagStreamed = 2;// ----------------> Xg[~Oǂݍ݂ō(LODAœKANX^ĂȂ)
+
+	// kf[^߂TCY̏̔{(LZ̃g[N1Ŗ߂͖̂255{Al߂O[v͕̕2bit16oCg64{)
+	// ꂽwb_[ő傫ȗ̈mۂȂ悤Ɏg
+	const uint64_t MaxExpansion = 256 * 64;
+
+	// --t@C̐擪ɒu-- //
+	struct ModelCacheHeader
+	{
+		char magic[4];// -----------> ʎq
+		uint32_t version;// --------> `̃o[W
+		float weldEpsilon;// -------> _܂Ƃ߂Ƃ̋e덷
+		uint32_t vertexStride;// ---> _1̃oCg
+		uint32_t indexStride;// ----> CfbNX1̃oCg
+		uint32_t sourceCount;// ----> t@C̐
+		uint32_t materialCount;// --> }eA
+		uint32_t subsetCount;// ----> }eAƂ͈̔͂̐
+		uint32_t vertexFormat;// ---> _f[^̌`(MeshVertexFormat)
+		Float3 positionOffset;// ---> W̗ʎq͈̔(ŏ_)
+		Float3 positionScale;// ----> W̗ʎq͈̔(傫)
+		uint32_t lodCount;// -------> LOD̐
+		uint32_t meshletCount;// ---> NX^
+		uint32_t flags;// ----------> FlagCompressedȂ
+		MeshBounds bounds;// -------> ׂĂ̒_͂ދE
+		uint64_t vertexCount;// ----> _
+		uint64_t indexCount;// -----> CfbNX
+		uint64_t vertexOffset;// ---> _f[^̈ʒu
+		uint64_t indexOffset;// ----> CfbNXf[^̈ʒu
+		uint64_t vertexDataSize;// -> i[_f[^̃oCg
+		uint64_t indexDataSize;// --> i[CfbNXf[^̃oCg
+		uint64_t fileSize;// -------> t@CŜ̃TCY
+	};
+	// l̏őSoCg܂悤ɁA(pfBO)тɂĂ
+	static_assert(sizeof(ModelCacheHeader) == 168, "ModelCacheHeader must not have padding");
+
+	// --16oCgEɐ؂グ-- //
+	inline uint64_t Align16(uint64_t value) { return (value + 15) & ~uint64_t(15); }
+
+	// --ẽnbVl߂(8oCg)-- //
+	uint64_t HashBytes(const uint8_t* data, size_t size) {
+		const uint64_t k = 0x9e3779b97f4a7c15ull;
+		uint64_t h = size * k;
+		size_t i = 0;
+		for (; i + 8 <= size; i += 8) {
+			uint64_t v;
+			std::memcpy(&v, data + i, sizeof(v));
+			h = (h ^ (v * k)) * 0xff51afd7ed558ccdull;
+			h ^= h >> 29;
+		}
+		uint64_t tail = 0;
+		std::memcpy(&tail, data + i, size - i);
+		h = (h ^ (tail * k)) * 0xc4ceb9fe1a85ec53ull;
+		h ^= h >> 32;
+		return h;
+	}
+
+	// --t@C̓ẽnbVl߂(̃t@C0)-- //
+	bool HashFile(const std::string& path, uint64_t* hash) {
+		uint64_t size, time;
+		if (!GetFileStamp(path, &size, &time)) return false;
+		if (size == 0) {
+			*hash = 0;
+			return true;
+		}
+
+		MappedFile file;
+		if (!file.Open(path)) return false;
+		*hash = HashBytes(file.GetData(), file.GetSize());
+		return true;
+	}
+
+	// --t@C̏W߂-- //
+	bool CollectSources(const std::string& sourceDirectory, const std::vector<std::string>& sources, std::vector<ModelCacheSource>* infos) {
+		infos->resize(sources.size());
+		for (size_t i = 0; i < sources.size(); i++) {
+			ModelCacheSource& info = (*infos)[i];
+			std::memset(&info, 0, sizeof(info));
+			if (sources[i].size() >= sizeof(info.name)) return false;
+			sources[i].copy(info.name, sources[i].size());
+
+			const std::string sourcePath = sourceDirectory + sources[i];
+			if (!GetFileStamp(sourcePath, &info.size, &info.time)) return false;
+			if (!HashFile(sourcePath, &info.hash)) return false;
+		}
+		return true;
+	}
+
+	// --wb_[̍쐬(f[^̈ʒuƃTCYAflags͌ĂяoŐݒ肷)-- //
+	ModelCacheHeader MakeHeader(float weldEpsilon, const ModelCacheData& data, size_t sourceCount) {
+		ModelCacheHeader header{};
+		std::memcpy(header.magic, Magic, sizeof(Magic));
+		header.version = Version;
+		header.weldEpsilon = weldEpsilon;
+		header.vertexStride = static_cast<uint32_t>(MeshVertexStride(data.vertexFormat));
+		header.indexStride = static_cast<uint32_t>(data.indexStride);
+		header.sourceCount = static_cast<uint32_t>(sourceCount);
+		header.materialCount = static_cast<uint32_t>(data.materialCount);
+		header.subsetCount = static_cast<uint32_t>(data.subsetCount);
+		header.vertexFormat = static_cast<uint32_t>(data.vertexFormat);
+		header.positionOffset = data.quantization.offset;
+		header.positionScale = data.quantization.scale;
+		header.lodCount = static_cast<uint32_t>(data.lodCount);
+		header.meshletCount = static_cast<uint32_t>(data.meshletCount);
+		header.bounds = data.bounds;
+		header.vertexCount = data.vertexCount;
+		header.indexCount = data.indexCount;
+		return header;
+	}
+
+	// --wb_[̌ɕׂ(t@CA}eAATuZbgALODANX^)̃oCg-- //
+	uint64_t TableSize(uint64_t sourceCount, uint64_t materialCount, uint64_t subsetCount, uint64_t lodCount, uint64_t meshletCount) {
+		return sourceCount * sizeof(ModelCacheSource) + materialCount * sizeof(ModelCacheMaterial) + subsetCount * sizeof(MeshSubset) +
+			lodCount * sizeof(MeshLod) + meshletCount * sizeof(Meshlet);
+	}
+}
+
+// --LbVJ-- //
+bool ModelCache::Open(const std::string& path, const std::string& sourceDirectory, float weldEpsilon, MeshVertexFormat vertexFormat,
+	bool isStreamedAllowed)
+{
+	data_ = ModelCacheData();
+	if (!file_.Open(path)) return false;
+
+	// --wb_[̊mF-- //
+	const uint8_t* base = file_.GetData();
+	const size_t size = file_.GetSize();
+	ModelCacheHeader header;
+	if (size < sizeof(header)) {
+		file_.Close();
+		return false;
+	}
+	std::memcpy(&header, base, sizeof(header));
+
+	const bool isCompressed = (header.flags & FlagCompressed) != 0;
+	const uint64_t vertexBytes = header.vertexCount * header.vertexStride;
+	const uint64_t indexBytes = header.indexCount * header.indexStride;
+	bool isValid = std::memcmp(header.magic, Magic, sizeof(Magic)) == 0 &&
+		header.version == Version &&
+		header.weldEpsilon == weldEpsilon &&
+		(isStreamedAllowed || (header.flags & FlagStreamed) == 0) &&
+		header.vertexFormat == static_cast<uint32_t>(vertexFormat) &&
+		header.vertexStride == MeshVertexStride(vertexFormat) &&
+		(header.indexStride == sizeof(uint16_t) || header.indexStride == sizeof(uint32_t)) &&
+		header.fileSize == size &&
+		header.lodCount >= 1 &&
+		header.vertexOffset % 16 == 0 && header.indexOffset % 16 == 0 &&
+		sizeof(header) + TableSize(header.sourceCount, header.materialCount, header.subsetCount, header.lodCount, header.meshletCount) <=
+			(header.vertexOffset < header.indexOffset ? header.vertexOffset : header.indexOffset) &&
+		(isCompressed ? vertexBytes <= header.vertexDataSize * MaxExpansion && indexBytes <= header.indexDataSize * MaxExpansion :
+			header.vertexDataSize == vertexBytes && header.indexDataSize == indexBytes) &&
+		(header.vertexOffset + header.vertexDataSize <= header.indexOffset || header.indexOffset + header.indexDataSize <= header.vertexOffset) &&
+		header.vertexOffset + header.vertexDataSize <= size &&
+		header.indexOffset + header.indexDataSize <= size;
+	if (!isValid) {
+		file_.Close();
+		return false;
+	}
+
+	// --͈͂}eAƃCfbNX̒Ɏ܂Ă邩̊mF-- //
+	const uint8_t* subsetBase = base + sizeof(header) + header.sourceCount * sizeof(ModelCacheSource) + header.materialCount * sizeof(ModelCacheMaterial);
+	for (uint32_t i = 0; i < header.subsetCount; i++) {
+		MeshSubset subset;
+		std::memcpy(&subset, subsetBase + i * sizeof(MeshSubset), sizeof(subset));
+		if (subset.material >= header.materialCount || uint64_t(subset.indexStart) + subset.indexCount > header.indexCount) {
+			file_.Close();
+			return false;
+		}
+	}
+
+	// --LOD͈̔͂TuZbg̒Ɏ܂Ă邩̊mF-- //
+	const uint8_t* lodBase = subsetBase + header.subsetCount * sizeof(MeshSubset);
+	for (uint32_t i = 0; i < header.lodCount; i++) {
+		MeshLod lod;
+		std::memcpy(&lod, lodBase + i * sizeof(MeshLod), sizeof(lod));
+		if (uint64_t(lod.subsetStart) + lod.subsetCount > header.subsetCount) {
+			file_.Close();
+			return false;
+		}
+	}
+
+	// --NX^͈̔͂CfbNX̒Ɏ܂Ă邩̊mF-- //
+	const uint8_t* meshletBase = lodBase + header.lodCount * sizeof(MeshLod);
+	for (uint32_t i = 0; i < header.meshletCount; i++) {
+		Meshlet meshlet;
+		std::memcpy(&meshlet, meshletBase + i * sizeof(Meshlet), sizeof(meshlet));
+		if (uint64_t(meshlet.indexStart) + meshlet.indexCount > header.indexCount) {
+			file_.Close();
+			return false;
+		}
+	}
+
+	// --t@CςĂȂ̊mF-- //
+	const ModelCacheSource* sources = reinterpret_cast<const ModelCacheSource*>(base + sizeof(header));
+	for (uint32_t i = 0; i < header.sourceCount; i++) {
+		ModelCacheSource source;
+		std::memcpy(&source, &sources[i], sizeof(source));
+		source.name[sizeof(source.name) - 1] = '\0';
+		const std::string sourcePath = sourceDirectory + source.name;
+
+		uint64_t sourceSize, sourceTime;
+		if (!GetFileStamp(sourcePath, &sourceSize, &sourceTime) || sourceSize != source.size) {
+			file_.Close();
+			return false;
+		}
+
+		// XVႤꍇ͒gׂ
+		uint64_t hash;
+		if (sourceTime != source.time && (!HashFile(sourcePath, &hash) || hash != source.hash)) {
+			file_.Close();
+			return false;
+		}
+	}
+
+	// --kĂΓWJ(_f[^̌16oCgEɃCfbNXf[^u)-- //
+	const uint8_t* vertexes = base + header.vertexOffset;
+	const uint8_t* indexes = base + header.indexOffset;
+	if (isCompressed) {
+		const size_t indexStart = static_cast<size_t>(Align16(vertexBytes));
+		decoded_.resize(indexStart + static_cast<size_t>(indexBytes));
+		if (!MeshDecodeVertexes(decoded_.data(), static_cast<size_t>(header.vertexCount), header.vertexStride, vertexes, static_cast<size_t>(header.vertexDataSize)) ||
+			!MeshDecodeIndexes(decoded_.data() + indexStart, static_cast<size_t>(header.indexCount), header.indexStride, indexes, static_cast<size_t>(header.indexDataSize))) {
+			decoded_.clear();
+			file_.Close();
+			return false;
+		}
+		vertexes = decoded_.data();
+		indexes = decoded_.data() + indexStart;
+	}
+
+	// --g̈ʒuݒ-- //
+	data_.materials = reinterpret_cast<const ModelCacheMaterial*>(base + sizeof(header) + header.sourceCount * sizeof(ModelCacheSource));
+	data_.materialCount = header.materialCount;
+	data_.subsets = reinterpret_cast<const MeshSubset*>(subsetBase);
+	data_.subsetCount = header.subsetCount;
+	data_.lods = reinterpret_cast<const MeshLod*>(lodBase);
+	data_.lodCount = header.lodCount;
+	data_.meshlets = reinterpret_cast<const Meshlet*>(meshletBase);
+	data_.meshletCount = header.meshletCount;
+	data_.bounds = header.bounds;
+	data_.vertexes = vertexes;
+	data_.vertexCount = static_cast<size_t>(header.vertexCount);
+	data_.vertexFormat = vertexFormat;
+	data_.quantization.offset = header.positionOffset;
+	data_.quantization.scale = header.positionScale;
+	data_.indexes = indexes;
+	data_.indexCount = static_cast<size_t>(header.indexCount);
+	data_.indexStride = header.indexStride;
+	return true;
+}
+
+// --LbVo-- //
+bool ModelCache::Write(const std::string& path, const std::string& sourceDirectory, const std::vector<std::string>& sources,
+	float weldEpsilon, const ModelCacheData& data, bool compress)
+{
+	// --t@C̏W߂-- //
+	std::vector<ModelCacheSource> sourceInfos;
+	if (!CollectSources(sourceDirectory, sources, &sourceInfos)) return false;
+
+	// --_f[^ƃCfbNXf[^̈k-- //
+	const size_t vertexStride = MeshVertexStride(data.vertexFormat);
+	std::vector<uint8_t> vertexStream, indexStream;
+	if (compress) {
+		MeshEncodeVertexes(data.vertexes, data.vertexCount, vertexStride, &vertexStream);
+		MeshEncodeIndexes(data.indexes, data.indexCount, data.indexStride, &indexStream);
+	}
+	const void* vertexData = compress ? vertexStream.data() : data.vertexes;
+	const void* indexData = compress ? indexStream.data() : data.indexes;
+
+	// --wb_[̍쐬-- //
+	ModelCacheHeader header = MakeHeader(weldEpsilon, data, sourceInfos.size());
+	header.flags = compress ? FlagCompressed : 0;
+	header.vertexOffset = Align16(sizeof(header) + TableSize(sourceInfos.size(), data.materialCount, data.subsetCount, data.lodCount, data.meshletCount));
+	header.vertexDataSize = compress ? vertexStream.size() : data.vertexCount * vertexStride;
+	header.indexDataSize = compress ? indexStream.size() : data.indexCount * data.indexStride;
+	header.indexOffset = Align16(header.vertexOffset + header.vertexDataSize);
+	header.fileSize = header.indexOffset + header.indexDataSize;
+
+	// --o-- //
+	std::ofstream file(path, std::ios::binary | std::ios::trunc);
+	if (file.fail()) return false;
+
+	const char zero[16] = {};
+	auto pad = [&](uint64_t offset) {
+		uint64_t current = static_cast<uint64_t>(file.tellp());
+		file.write(zero, static_cast<std::streamsize>(offset - current));
+	};
+
+	file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+	if (!sourceInfos.empty()) file.write(reinterpret_cast<const char*>(sourceInfos.data()), sourceInfos.size() * sizeof(ModelCacheSource));
+	if (data.materialCount > 0) file.write(reinterpret_cast<const char*>(data.materials), data.materialCount * sizeof(ModelCacheMaterial));
+	if (data.subsetCount > 0) file.write(reinterpret_cast<const char*>(data.subsets), data.subsetCount * sizeof(MeshSubset));
+	if (data.lodCount > 0) file.write(reinterpret_cast<const char*>(data.lods), data.lodCount * sizeof(MeshLod));
+	if (data.meshletCount > 0) file.write(reinterpret_cast<const char*>(data.meshlets), data.meshletCount * sizeof(Meshlet));
+	pad(header.vertexOffset);
+	if (header.vertexDataSize > 0) file.write(static_cast<const char*>(vertexData), static_cast<std::streamsize>(header.vertexDataSize));
+	pad(header.indexOffset);
+	if (header.indexDataSize > 0) file.write(static_cast<const char*>(indexData), static_cast<std::streamsize>(header.indexDataSize));
+
+	return file.good();
+}
+
+// --LbV̏on߂-- //
+bool ModelCacheWriter::Begin(const std::string& path, const std::string& sourceDirectory, const std::vector<std::string>& sources,
+	const ModelCacheData& data)
+{
+	std::vector<ModelCacheSource> sourceInfos;
+	if (!CollectSources(sourceDirectory, sources, &sourceInfos)) return false;
+
+	data_ = data;
+	data_.vertexCount = 0;
+	sourceCount_ = sourceInfos.size();
+
+	// --CfbNXf[^ɒuA_f[^͂̌(16oCgE)ǉ-- //
+	subsetOffset_ = sizeof(ModelCacheHeader) + sourceInfos.size() * sizeof(ModelCacheSource) + data.materialCount * sizeof(ModelCacheMaterial);
+	indexOffset_ = Align16(sizeof(ModelCacheHeader) + TableSize(sourceInfos.size(), data.materialCount, data.subsetCount, data.lodCount, data.meshletCount));
+	const uint64_t indexEnd = indexOffset_ + uint64_t(data.indexCount) * data.indexStride;
+	vertexOffset_ = Align16(indexEnd);
+
+	file_.open(path, std::ios::binary | std::ios::trunc);
+	if (file_.fail()) return false;
+
+	// --wb_[ƃTuZbgEndŏނ̂ŁAł0Ŗ߂Ă-- //
+	const char zero[sizeof(ModelCacheHeader)] = {};
+	file_.write(zero, sizeof(ModelCacheHeader));
+	if (!sourceInfos.empty()) file_.write(reinterpret_cast<const char*>(sourceInfos.data()), sourceInfos.size() * sizeof(ModelCacheSource));
+	if (data.materialCount > 0) file_.write(reinterpret_cast<const char*>(data.materials), data.materialCount * sizeof(ModelCacheMaterial));
+	for (size_t i = 0; i < data.subsetCount; i++) file_.write(zero, sizeof(MeshSubset));
+	if (data.lodCount > 0) file_.write(reinterpret_cast<const char*>(data.lods), data.lodCount * sizeof(MeshLod));
+	if (data.meshletCount > 0) file_.write(reinterpret_cast<const char*>(data.meshlets), data.meshletCount * sizeof(Meshlet));
+	file_.write(zero, static_cast<std::streamsize>(indexOffset_ - static_cast<uint64_t>(file_.tellp())));
+
+	// CfbNXf[^̌̌Ԃ𖄂߂āACfbNXf[^̕܂Ńt@CL
+	file_.seekp(static_cast<std::streamoff>(indexEnd));
+	file_.write(zero, static_cast<std::streamsize>(vertexOffset_ - indexEnd));
+	return file_.good();
+}
+
+// --CfbNXf[^-- //
+bool ModelCacheWriter::WriteIndexes(size_t first, const void* indexes, size_t count)
+{
+	if (first + count > data_.indexCount) return false;
+	file_.seekp(static_cast<std::streamoff>(indexOffset_ + uint64_t(first) * data_.indexStride));
+	file_.write(static_cast<const char*>(indexes), static_cast<std::streamsize>(count * data_.indexStride));
+	return file_.good();
+}
+
+// --_f[^ɒǉ-- //
+bool ModelCacheWriter::AppendVertexes(const void* vertexes, size_t count)
+{
+	const size_t vertexStride = MeshVertexStride(data_.vertexFormat);
+	file_.seekp(static_cast<std::streamoff>(vertexOffset_ + uint64_t(data_.vertexCount) * vertexStride));
+	file_.write(static_cast<const char*>(vertexes), static_cast<std::streamsize>(count * vertexStride));
+	data_.vertexCount += count;
+	return file_.good();
+}
+
+// --TuZbgƋEAwb_[ŕ-- //
+bool ModelCacheWriter::End(const MeshSubset* subsets, const MeshBounds& bounds)
+{
+	data_.bounds = bounds;
+	ModelCacheHeader header = MakeHeader(0.0f, data_, sourceCount_);
+	header.flags = FlagStreamed;
+	header.indexOffset = indexOffset_;
+	header.indexDataSize = uint64_t(data_.indexCount) * data_.indexStride;
+	header.vertexOffset = vertexOffset_;
+	header.vertexDataSize = uint64_t(data_.vertexCount) * header.vertexStride;
+	header.fileSize = vertexOffset_ + header.vertexDataSize;
+
+	if (data_.subsetCount > 0) {
+		file_.seekp(static_cast<std::streamoff>(subsetOffset_));
+		file_.write(reinterpret_cast<const char*>(subsets), data_.subsetCount * sizeof(MeshSubset));
+	}
+	file_.seekp(0);
+	file_.write(reinterpret_cast<const char*>(&header), sizeof(header));
+	file_.close();
+	return !file_.fail();
+}
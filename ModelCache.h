@@ -0,0 +1,104 @@
+#pragma once
+#include "Mesh.h"
+#include "MeshQuantize.h"
+#include "MappedFile.h"
+#include <fstream>
+#include <string>
+#include <vector>
+
+// --fLbṼt@C\-- //
+// [ModelCacheHeader][ModelCacheSource * sourceCount][ModelCacheMaterial * materialCount][MeshSubset * subsetCount][MeshLod * lodCount][Meshlet * meshletCount]
+// [_f[^(16oCgE)][CfbNXf[^(16oCgEAGPUɑTCŶ܂)]
+// kďoꍇA_f[^ƃCfbNXf[^MeshCodecňk(JƂɓWJ)
+// ModelCacheWriterŏoꍇ́ACfbNXf[^_f[^Oɂ(ʒu̓wb_[ɓĂ)
+
+// --LbVɕۑ}eA-- //
+struct ModelCacheMaterial
+{
+	char name[128];// -------------> }eA
+	Float3 ambient;// -------------> ArGgex
+	Float3 diffuse;// -------------> fBt[Yex
+	Float3 specular;// ------------> XyL[ex
+	float alpha;// ----------------> At@
+	char textureFilename[260];// --> eNX`t@C
+};
+
+// --LbV̌ɂȂt@C(OBJAMTL)̏-- //
+struct ModelCacheSource
+{
+	char name[260];// -> t@C(f̃fBNg̑΃pX)
+	uint64_t size;// --> t@CTCY
+	uint64_t time;// --> ŏIXV
+	uint64_t hash;// --> ẽnbVl
+};
+
+// --LbV̒g-- //
+struct ModelCacheData
+{
+	const void* vertexes = nullptr;// --------------------> _f[^(vertexFormať`)
+	size_t vertexCount = 0;// ----------------------------> _
+	MeshVertexFormat vertexFormat = MeshVertexFormat::Float;// -> _f[^̌`
+	MeshQuantization quantization;// ---------------------> W̗ʎq͈̔(Quantized̏ꍇ)
+	const void* indexes = nullptr;// ---------------------> CfbNXf[^
+	size_t indexCount = 0;// -----------------------------> CfbNX
+	size_t indexStride = 0;// ----------------------------> CfbNX1̃oCg(24)
+	const ModelCacheMaterial* materials = nullptr;// -----> }eA
+	size_t materialCount = 0;// --------------------------> }eA
+	const MeshSubset* subsets = nullptr;// ---------------> }eAƂ̃CfbNX͈̔(materialmaterials̔ԍ)
+	size_t subsetCount = 0;// ----------------------------> ͈͂̐
+	const MeshLod* lods = nullptr;// ---------------------> LODƂsubsets͈̔(擪̃bV)
+	size_t lodCount = 0;// -------------------------------> LOD̐(1ȏ)
+	const Meshlet* meshlets = nullptr;// -----------------> TuZbg𕪂NX^(CfbNẌʒȕ)
+	size_t meshletCount = 0;// ---------------------------> NX^
+	MeshBounds bounds = {};// ----------------------------> ׂĂ̒_͂ދE(TuZbgƂ̋EsubsetsɓĂ)
+};
+
+class ModelCache {
+public:// o֐
+	// LbVJ
+	// AĂA쐬weldEpsilonⒸ_f[^̌`ႤAt@CςĂꍇfalseԂ
+	// t@C̓TCYƍXVȂ炻̂܂܎gAႤꍇ̓nbVlŒgׂ
+	// ModelCacheWriterŏo(LODAœKANX^ĂȂ)́AisStreamedAllowedtruêƂJ
+	bool Open(const std::string& path, const std::string& sourceDirectory, float weldEpsilon, MeshVertexFormat vertexFormat,
+		bool isStreamedAllowed = false);
+
+	// LbV̒g̎擾(OpenĂԂL)
+	inline const ModelCacheData& GetData() const { return data_; }
+
+	// LbVo(sourcessourceDirectory̑΃pXAcompresstrueȂ璸_ƃCfbNXk)
+	static bool Write(const std::string& path, const std::string& sourceDirectory, const std::vector<std::string>& sources,
+		float weldEpsilon, const ModelCacheData& data, bool compress);
+
+private:// oϐ
+	MappedFile file_;// ---------------> }bvLbVt@C
+	ModelCacheData data_;// ------------> LbV̒g
+	std::vector<uint8_t> decoded_;// ---> WJ_f[^ƃCfbNXf[^(kĂꍇ)
+};
+
+// --LbVo(Xg[~Oǂݍݗp)-- //
+// _͍Ō܂ŕȂ̂ŁACfbNXf[^̏ꏊɊmۂA_f[^͂̌ɒǉĂ(k͂Ȃ)
+// weldEpsilonł̂܂Ƃ߂͂Ȃ̂ŁAwb_[weldEpsilon0ɂȂ(0傫weldEpsilonOpenł͊JȂ)
+// End܂Ńwb_[0̂܂܂Ȃ̂ŁArŎst@COpenŊJȂ
+class ModelCacheWriter {
+public:// o֐
+	// on߂(datâ_f[^ACfbNXf[^ATuZbg̒gAE͎g킸Ag)
+	bool Begin(const std::string& path, const std::string& sourceDirectory, const std::vector<std::string>& sources,
+		const ModelCacheData& data);
+
+	// CfbNXf[^firstԖڂ̈ʒu珑(indexesindexStrideoCg񂾂)
+	bool WriteIndexes(size_t first, const void* indexes, size_t count);
+
+	// _f[^ɒǉ(vertexesvertexFormať`̕)
+	bool AppendVertexes(const void* vertexes, size_t count);
+
+	// TuZbgƋEAwb_[ŕ
+	bool End(const MeshSubset* subsets, const MeshBounds& bounds);
+
+private:// oϐ
+	std::ofstream file_;// -----------> õt@C
+	ModelCacheData data_;// ----------> oe̐ƌ`(|C^Begin̒łg)
+	size_t sourceCount_ = 0;// -------> t@C̐
+	uint64_t subsetOffset_ = 0;// ----> TuZbg̈ʒu
+	uint64_t indexOffset_ = 0;// -----> CfbNXf[^̈ʒu
+	uint64_t vertexOffset_ = 0;// ----> _f[^̈ʒu
+};
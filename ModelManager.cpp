@@ -0,0 +1,98 @@
+#include "ModelManager.h"
+
+#include <cstdio>
+
+namespace {
+	// --gȂȂfcĂʂ̏̏l[oCg]-- //
+	const size_t DefaultMemoryBudget = 64 * 1024 * 1024;
+}
+
+// CX^X擾
+ModelManager* ModelManager::GetInstance()
+{
+	// ֐staticϐƂĐ錾
+	static ModelManager instance;
+	return &instance;
+}
+
+// RXgN^
+ModelManager::ModelManager() :
+#pragma region Xg
+	entries_{},// ----------------------------> ǂݍ񂾃f
+	released_{},// ---------------------------> gȂȂf̃L[
+	releasedMemorySize_(0),// ----------------> gȂȂf̃ʂ̍v
+	memoryBudget_(DefaultMemoryBudget)// -----> gȂȂfcĂʂ̏
+#pragma endregion
+{
+}
+
+ModelHandle ModelManager::Load(const std::string& fileName, float weldEpsilon, MeshVertexFormat vertexFormat, bool isSplitStreams,
+	bool isStreamingImport)
+{
+	// --L[(ǂݍ݂̐ݒ肪ႦΕʂ̃fɂȂ)-- //
+	char settings[64];
+	snprintf(settings, sizeof(settings), "|%.9g|%u|%d|%d", weldEpsilon, static_cast<unsigned>(vertexFormat), isSplitStreams ? 1 : 0,
+		isStreamingImport ? 1 : 0);
+	const std::string key = fileName + settings;
+
+	Entry& entry = entries_[key];
+
+	// --gĂ΂̃nhL-- //
+	ModelHandle handle = entry.handle.lock();
+	if (handle) return handle;
+
+	if (entry.model) {
+		// gȂȂfcĂ΁A҂OĎg
+		releasedMemorySize_ -= entry.memorySize;
+		released_.erase(entry.released);
+	}
+	else {
+		// Γǂݍ
+		entry.model.reset(Model::CreateModel(fileName, weldEpsilon, vertexFormat, isSplitStreams, isStreamingImport));
+		entry.memorySize = entry.model->GetMemorySize();
+	}
+	entry.released = released_.end();
+
+	// --Ō̃nhȂ폜ɕԂĂ炤-- //
+	handle = ModelHandle(entry.model.get(), [this, key](Model*) { Release(key); });
+	entry.handle = handle;
+	return handle;
+}
+
+void ModelManager::SetMemoryBudget(size_t memoryBudget)
+{
+	memoryBudget_ = memoryBudget;
+	Evict();
+}
+
+void ModelManager::Clear()
+{
+	// 0ɂđS
+	const size_t memoryBudget = memoryBudget_;
+	SetMemoryBudget(0);
+	memoryBudget_ = memoryBudget;
+}
+
+void ModelManager::Release(const std::string& key)
+{
+	auto it = entries_.find(key);
+	if (it == entries_.end()) return;
+
+	// ҂̐擪(ԍŋߎgȂȂʒu)ɓ
+	Entry& entry = it->second;
+	entry.released = released_.insert(released_.begin(), key);
+	releasedMemorySize_ += entry.memorySize;
+
+	Evict();
+}
+
+void ModelManager::Evict()
+{
+	// nhȂ̂̓V[̐؂ւȂǕ`̊OŁAÕt[DX12Cmd::PostDrawGPU҂IĂ̂ŁAɉĂ悢
+	while (releasedMemorySize_ > memoryBudget_ && !released_.empty()) {
+		auto it = entries_.find(released_.back());
+		releasedMemorySize_ -= it->second.memorySize;
+		released_.pop_back();
+		entries_.erase(it);
+	}
+}
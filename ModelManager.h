@@ -0,0 +1,75 @@
+#pragma once
+#include "Model.h"
+
+#include <list>
+#include <map>
+#include <memory>
+#include <string>
+
+// --L郂f̃nh(Ō̃nhȂModelManagerɕԂAModelManagerɔj)-- //
+using ModelHandle = std::shared_ptr<Model>;
+
+class ModelManager {
+	// --oϐ-- //
+private:
+	// ǂݍ񂾃f
+	struct Entry {
+		std::unique_ptr<Model> model;// --------------> f{
+		std::weak_ptr<Model> handle;// ---------------> gĂԂ̃nh
+		size_t memorySize;// -------------------------> fgĂ郁[oCg]
+		std::list<std::string>::iterator released;// -> released_̒̈ʒu(gĂԂreleased_.end())
+	};
+
+	std::map<std::string, Entry> entries_;// -> ǂݍ񂾃f(t@CƓǂݍ݂̐ݒ肪L[)
+	std::list<std::string> released_;// -----> gȂȂf̃L[(擪قǍŋߎgȂȂ)
+	size_t releasedMemorySize_;// ------------> gȂȂf̃ʂ̍v[oCg]
+	size_t memoryBudget_;// ------------------> gȂȂfcĂʂ̏[oCg]
+
+	// --o֐-- //
+public:
+	// CX^X擾
+	static ModelManager* GetInstance();
+
+	// f擾(t@CAݒœǂݍ񂾃fcĂ΂LAΓǂݍ)
+	// Model::CreateModelƓ
+	ModelHandle Load(const std::string& fileName, float weldEpsilon = 0.0f, MeshVertexFormat vertexFormat = MeshVertexFormat::Float,
+		bool isSplitStreams = false, bool isStreamingImport = false);
+
+	// gȂȂfcĂʂ̏ݒ(͌Â̂)
+	void SetMemoryBudget(size_t memoryBudget);
+
+	// gȂȂfׂĉ
+	void Clear();
+
+#pragma region Qb^[
+	// gȂȂfcĂʂ̏̎擾[oCg]
+	inline size_t GetMemoryBudget() const { return memoryBudget_; }
+
+	// gȂȂf̃ʂ̍v̎擾[oCg]
+	inline size_t GetReleasedMemorySize() const { return releasedMemorySize_; }
+
+	// cĂ郂f̐̎擾(gȂȂ̂܂)
+	inline size_t GetModelCount() const { return entries_.size(); }
+#pragma endregion
+
+private:
+	// RXgN^
+	ModelManager();
+
+	// fXgN^
+	~ModelManager() {}
+
+	// Ō̃nhȂƂ̏
+	void Release(const std::string& key);
+
+	// gȂȂfAʂȉɂȂ܂ŌÂ̂
+	void Evict();
+
+	// --֎~-- //
+public:
+	// Rs[RXgN^
+	ModelManager(const ModelManager& instance) = delete;
+
+	// Zq
+	ModelManager& operator=(const ModelManager& instance) = delete;
+};
@@ -0,0 +1,759 @@
+#include "ObjLoader.h"
+#include <algorithm>
+#include <cmath>
+#include <condition_variable>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+
+namespace {
+	// 1XbhɍŒ蓖ĂoCg
+	const size_t MinChunkSize = 1 << 20;
+
+	// --(sȊO)΂-- //
+	inline const char* SkipSpace(const char* p, const char* end) {
+		while (p < end && (*p == ' ' || *p == '\t' || *p == '\r')) p++;
+		return p;
+	}
+
+	// --̍s̐擪Ԃ-- //
+	inline const char* NextLine(const char* p, const char* end) {
+		const char* lf = static_cast<const char*>(std::memchr(p, '\n', end - p));
+		return lf ? lf + 1 : end;
+	}
+
+	// --s̐擪̃L[[hƈv邩-- //
+	inline bool IsKey(const char* p, const char* end, const char* key, size_t length) {
+		return static_cast<size_t>(end - p) > length && std::memcmp(p, key, length) == 0 && (p[length] == ' ' || p[length] == '\t');
+	}
+
+	// --ǂݍŁAǂݏIʒuԂ(snullptr)-- //
+	// 2^53Aw}22ȓȂdouble1̏揜ZŐۂ߂lɂȂ
+	// floatɂƂ̓dۂ߂́Adouble̒lfloat̂傤ǒԂɂȂꍇʂς̂
+	// ̏ꍇƁAȊO(̑linfAnanȂ)strtofɔC
+	const char* ParseFloat(const char* p, const char* end, float* out) {
+		static const double pow10[] = {
+			1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+			1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22,
+		};
+
+		p = SkipSpace(p, end);
+		if (p >= end) return nullptr;
+		const char* start = p;
+
+		bool negative = false;
+		if (p < end && (*p == '-' || *p == '+')) negative = (*p++ == '-');
+
+		uint64_t mantissa = 0;
+		int digits = 0;// -> 擪0L
+		int exponent = 0;
+		bool any = false;
+
+		for (; p < end && *p >= '0' && *p <= '9'; p++) {
+			any = true;
+			if (mantissa == 0 && *p == '0') continue;
+			if (++digits <= 19) mantissa = mantissa * 10 + (*p - '0');
+			else exponent++;
+		}
+		if (p < end && *p == '.') {
+			for (p++; p < end && *p >= '0' && *p <= '9'; p++) {
+				any = true;
+				if (mantissa == 0 && *p == '0') { exponent--; continue; }
+				if (++digits <= 19) { mantissa = mantissa * 10 + (*p - '0'); exponent--; }
+			}
+		}
+		if (any && p < end && (*p == 'e' || *p == 'E')) {
+			const char* q = p + 1;
+			bool expNegative = false;
+			if (q < end && (*q == '-' || *q == '+')) expNegative = (*q++ == '-');
+			if (q < end && *q >= '0' && *q <= '9') {
+				int e = 0;
+				for (; q < end && *q >= '0' && *q <= '9'; q++) {
+					if (e < 100000) e = e * 10 + (*q - '0');
+				}
+				exponent += expNegative ? -e : e;
+				p = q;
+			}
+		}
+
+		if (any && digits <= 19 && mantissa < (uint64_t(1) << 53) && exponent >= -22 && exponent <= 22) {
+			double value = static_cast<double>(mantissa);
+			value = exponent < 0 ? value / pow10[-exponent] : value * pow10[exponent];
+
+			// floatɓȂ29bit傤ǒԂ̒lłȂ΂̂܂܊ۂ߂Ă悢
+			uint64_t bits;
+			std::memcpy(&bits, &value, sizeof(bits));
+			if ((bits & 0x1fffffff) != 0x10000000) {
+				float result = static_cast<float>(value);
+				*out = negative ? -result : result;
+				return p;
+			}
+		}
+
+		// xoH
+		char* stop = nullptr;
+		float value = std::strtof(start, &stop);
+		if (stop == start || stop > end) return nullptr;
+		*out = value;
+		return stop;
+	}
+
+	// --ǂݍŁAǂݏIʒuԂ(snullptr)-- //
+	const char* ParseInt(const char* p, const char* end, int64_t* out) {
+		bool negative = false;
+		if (p < end && (*p == '-' || *p == '+')) negative = (*p++ == '-');
+		if (p >= end || *p < '0' || *p > '9') return nullptr;
+
+		int64_t value = 0;
+		for (; p < end && *p >= '0' && *p <= '9'; p++) {
+			if (value < (int64_t(1) << 40)) value = value * 10 + (*p - '0');
+		}
+		*out = negative ? -value : value;
+		return p;
+	}
+
+	// --OBJ̃CfbNX(1n܂AȂ疖̑)0n܂ɒ-- //
+	inline bool ResolveIndex(int64_t index, size_t count, uint32_t* out) {
+		int64_t i = index > 0 ? index - 1 : static_cast<int64_t>(count) + index;
+		if (index == 0 || i < 0 || i >= static_cast<int64_t>(count)) return false;
+		*out = static_cast<uint32_t>(i);
+		return true;
+	}
+
+	// --Op`̂߂̌vZ-- //
+	inline Float3 Sub(const Float3& a, const Float3& b) { return Float3(a.x - b.x, a.y - b.y, a.z - b.z); }
+	inline Float3 Cross(const Float3& a, const Float3& b) { return Float3(a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x); }
+	inline float Dot(const Float3& a, const Float3& b) { return a.x * b.x + a.y * b.y + a.z * b.z; }
+
+	// --2̊O(a->b->c vȂ琳)-- //
+	inline float Cross2D(const Float2& a, const Float2& b, const Float2& c) {
+		return (b.x - a.x) * (c.y - a.y) - (b.y - a.y) * (c.x - a.x);
+	}
+
+	// --_pOp`abc(v)̓Eɂ邩-- //
+	inline bool InTriangle(const Float2& p, const Float2& a, const Float2& b, const Float2& c) {
+		return Cross2D(a, b, p) >= 0.0f && Cross2D(b, c, p) >= 0.0f && Cross2D(c, a, p) >= 0.0f;
+	}
+
+	// --p`Op`ɕāAn - 2̎Op`̃CfbNXdstɏ-- //
+	// ʑp`Ȃ0Ԗڂ̒_̐`ɕAp`Ȃ玨؂Ă(Ear Clipping)
+	// _̕(\̌)͌̑p`ƓɂȂ
+	void Triangulate(const ObjIndex* corners, size_t n, const Float3* positions, ObjIndex* dst) {
+		// ʂ̖@(Newell̕@Ap`ł܂)
+		Float3 normal;
+		for (size_t i = 0; i < n; i++) {
+			const Float3& a = positions[corners[i].position];
+			const Float3& b = positions[corners[(i + 1) % n].position];
+			normal.x += (a.y - b.y) * (a.z + b.z);
+			normal.y += (a.z - b.z) * (a.x + b.x);
+			normal.z += (a.x - b.x) * (a.y + b.y);
+		}
+
+		// ׂĂ̊p@ɑ΂ēɋȂĂΓ
+		bool convex = true;
+		for (size_t i = 0; i < n && convex; i++) {
+			const Float3& prev = positions[corners[(i + n - 1) % n].position];
+			const Float3& curr = positions[corners[i].position];
+			const Float3& next = positions[corners[(i + 1) % n].position];
+			convex = Dot(Cross(Sub(curr, prev), Sub(next, curr)), normal) >= 0.0f;
+		}
+
+		if (convex) {
+			for (size_t i = 1; i + 1 < n; i++) {
+				*dst++ = corners[0];
+				*dst++ = corners[i];
+				*dst++ = corners[i + 1];
+			}
+			return;
+		}
+
+		// @̈ԑ傫̎ʂɓe(vɂȂ悤Ɍ낦)
+		float ax = std::fabs(normal.x), ay = std::fabs(normal.y), az = std::fabs(normal.z);
+		std::vector<Float2> points(n);
+		for (size_t i = 0; i < n; i++) {
+			const Float3& p = positions[corners[i].position];
+			if (ax >= ay && ax >= az) points[i] = normal.x > 0.0f ? Float2(p.y, p.z) : Float2(p.z, p.y);
+			else if (ay >= az) points[i] = normal.y > 0.0f ? Float2(p.z, p.x) : Float2(p.x, p.z);
+			else points[i] = normal.z > 0.0f ? Float2(p.x, p.y) : Float2(p.y, p.x);
+		}
+
+		// cĂ钸_̔ԍ
+		std::vector<size_t> remain(n);
+		for (size_t i = 0; i < n; i++) remain[i] = i;
+
+		size_t i = 0;
+		size_t miss = 0;// -> 炸ɐi񂾉
+		while (remain.size() > 3) {
+			size_t count = remain.size();
+			size_t prev = remain[(i + count - 1) % count];
+			size_t curr = remain[i];
+			size_t next = remain[(i + 1) % count];
+
+			// ʂȊpŁAق̒_Op`̒ɓĂȂΎ
+			bool ear = Cross2D(points[prev], points[curr], points[next]) > 0.0f;
+			for (size_t j = 0; j < count && ear; j++) {
+				size_t k = remain[j];
+				if (k == prev || k == curr || k == next) continue;
+				ear = !InTriangle(points[k], points[prev], points[curr], points[next]);
+			}
+
+			// ĂȂ(ȌȂǂŉĂ)ꍇ͐`ŕ
+			if (ear || miss >= count) {
+				*dst++ = corners[prev];
+				*dst++ = corners[curr];
+				*dst++ = corners[next];
+				remain.erase(remain.begin() + i);
+				i = i == 0 ? count - 2 : i - 1;// -> 1O̒_璲ג
+				miss = 0;
+			}
+			else {
+				i = (i + 1) % count;
+				miss++;
+			}
+		}
+		*dst++ = corners[remain[0]];
+		*dst++ = corners[remain[1]];
+		*dst++ = corners[remain[2]];
+	}
+
+	// --`N̉͒ɎOp`łȂp`-- //
+	// Õ`Nɂ钸_Wgp`́AׂẴ`Nׂŕ
+	struct PendingPolygon
+	{
+		size_t indexOffset;// -> Op`indices̈ʒu
+		size_t cornerFirst;// -> corners̐擪ʒu
+		size_t cornerCount;// -> _
+	};
+
+	struct PendingPolygons
+	{
+		std::vector<ObjIndex> corners;// ----------> p`̒_
+		std::vector<PendingPolygon> polygons;// ---> p`
+	};
+
+	// --s̎-- //
+	enum class LineType { Position, Texcoord, Normal, Face, Mtllib, Usemtl, Other };
+
+	// --s̐擪(󔒂΂ʒu)s̎ނ𔻒肷-- //
+	inline LineType Classify(const char* line, const char* lineEnd) {
+		if (IsKey(line, lineEnd, "v", 1)) return LineType::Position;
+		if (IsKey(line, lineEnd, "vt", 2)) return LineType::Texcoord;
+		if (IsKey(line, lineEnd, "vn", 2)) return LineType::Normal;
+		if (IsKey(line, lineEnd, "f", 1)) return LineType::Face;
+		if (IsKey(line, lineEnd, "mtllib", 6)) return LineType::Mtllib;
+		if (IsKey(line, lineEnd, "usemtl", 6)) return LineType::Usemtl;
+		return LineType::Other;
+	}
+
+	// --s̎cŐ󔒂OƂēǂ(mtllibAusemtl)-- //
+	inline std::string ReadName(const char* p, const char* lineEnd) {
+		const char* name = SkipSpace(p, lineEnd);
+		const char* nameEnd = lineEnd;
+		while (nameEnd > name && (nameEnd[-1] == ' ' || nameEnd[-1] == '\t' || nameEnd[-1] == '\r')) nameEnd--;
+		return std::string(name, nameEnd);
+	}
+
+	// --͈͓̍s̎ނƂ̐-- //
+	struct LineCount
+	{
+		size_t positions = 0;
+		size_t texcoords = 0;
+		size_t normals = 0;
+		size_t faces = 0;
+	};
+
+	// --s̎ނ𐔂-- //
+	LineCount CountLines(const char* p, const char* end) {
+		LineCount count;
+		while (p < end) {
+			const char* line = SkipSpace(p, end);
+			const char* lineEnd = static_cast<const char*>(std::memchr(line, '\n', end - line));
+			if (lineEnd == nullptr) lineEnd = end;
+			p = lineEnd < end ? lineEnd + 1 : end;
+
+			switch (Classify(line, lineEnd)) {
+			case LineType::Position: count.positions++; break;
+			case LineType::Texcoord: count.texcoords++; break;
+			case LineType::Normal: count.normals++; break;
+			case LineType::Face: count.faces++; break;
+			default: break;
+			}
+		}
+		return count;
+	}
+
+	// --͈͓̍s͂ouťɒǉ-- //
+	// --base ͈͂̔͂Oɂ钸_WAeNX`UVA@xNg̐(ʂ̃CfbNX̉Ɏg)-- //
+	// --outɂȂ_Wgp`pendingɓāAOp`̏ꏊmۂĂ-- //
+	bool ParseLines(const char* p, const char* end, const LineCount& base, ObjData* out, PendingPolygons* pending) {
+		std::vector<ObjIndex> corners;// -> 1̖ʂ̒_
+
+		const size_t positionBase = base.positions - out->positions.size();
+		const size_t texcoordBase = base.texcoords - out->texcoords.size();
+		const size_t normalBase = base.normals - out->normals.size();
+
+		while (p < end) {
+			const char* line = SkipSpace(p, end);
+			const char* lineEnd = static_cast<const char*>(std::memchr(line, '\n', end - line));
+			if (lineEnd == nullptr) lineEnd = end;
+			p = lineEnd < end ? lineEnd + 1 : end;
+
+			switch (Classify(line, lineEnd)) {
+			// 擪[v]Ȃ璸_W
+			case LineType::Position: {
+				Float3 position;
+				const char* q = line + 2;
+				if (!(q = ParseFloat(q, lineEnd, &position.x))) return false;
+				if (!(q = ParseFloat(q, lineEnd, &position.y))) return false;
+				if (!(q = ParseFloat(q, lineEnd, &position.z))) return false;
+				out->positions.emplace_back(position);
+				break;
+			}
+
+			// 擪[vt]ȂeNX`
+			case LineType::Texcoord: {
+				Float2 texcoord;
+				const char* q = line + 3;
+				if (!(q = ParseFloat(q, lineEnd, &texcoord.x))) return false;
+				if (!(q = ParseFloat(q, lineEnd, &texcoord.y))) return false;
+				out->texcoords.emplace_back(texcoord);
+				break;
+			}
+
+			// 擪[vn]Ȃ@xNg
+			case LineType::Normal: {
+				Float3 normal;
+				const char* q = line + 3;
+				if (!(q = ParseFloat(q, lineEnd, &normal.x))) return false;
+				if (!(q = ParseFloat(q, lineEnd, &normal.y))) return false;
+				if (!(q = ParseFloat(q, lineEnd, &normal.z))) return false;
+				out->normals.emplace_back(normal);
+				break;
+			}
+
+			// 擪[f]Ȃ|S(Op`ɕĒǉ)
+			case LineType::Face: {
+				corners.clear();
+				bool local = true;// -> ׂĂ̒_Woutɂ邩
+				const char* q = SkipSpace(line + 2, lineEnd);
+				while (q < lineEnd) {
+					// v, v/vt, v//vn, v/vt/vn ̂ǂꂩ
+					ObjIndex index = { ObjIndex::None, ObjIndex::None, ObjIndex::None };
+					int64_t value;
+					if (!(q = ParseInt(q, lineEnd, &value))) return false;
+					if (!ResolveIndex(value, positionBase + out->positions.size(), &index.position)) return false;
+
+					if (q < lineEnd && *q == '/') {
+						q++;
+						if (q < lineEnd && *q != '/') {
+							if (!(q = ParseInt(q, lineEnd, &value))) return false;
+							if (!ResolveIndex(value, texcoordBase + out->texcoords.size(), &index.texcoord)) return false;
+						}
+						if (q < lineEnd && *q == '/') {
+							q++;
+							if (!(q = ParseInt(q, lineEnd, &value))) return false;
+							if (!ResolveIndex(value, normalBase + out->normals.size(), &index.normal)) return false;
+						}
+					}
+
+					local = local && index.position >= positionBase;
+					corners.emplace_back(index);
+					q = SkipSpace(q, lineEnd);
+				}
+
+				// 3_̖ʂ͎Op`ɂȂȂ̂Ŗ
+				if (corners.size() < 3) break;
+
+				if (corners.size() == 3) {
+					out->indices.insert(out->indices.end(), corners.begin(), corners.end());
+					break;
+				}
+
+				size_t offset = out->indices.size();
+				out->indices.resize(offset + (corners.size() - 2) * 3);
+				if (local) {
+					// out̒̒_Wg悤ɔԍ炷
+					for (ObjIndex& corner : corners) corner.position -= static_cast<uint32_t>(positionBase);
+					Triangulate(corners.data(), corners.size(), out->positions.data(), &out->indices[offset]);
+					for (size_t i = offset; i < out->indices.size(); i++) out->indices[i].position += static_cast<uint32_t>(positionBase);
+				}
+				else {
+					pending->polygons.push_back({ offset, pending->corners.size(), corners.size() });
+					pending->corners.insert(pending->corners.end(), corners.begin(), corners.end());
+				}
+				break;
+			}
+
+			// 擪[mtllib]Ȃ}eAt@C
+			case LineType::Mtllib:
+				out->mtllibs.emplace_back(ReadName(line + 7, lineEnd));
+				break;
+
+			// 擪[usemtl]Ȃȍ~̖ʂ̃}eA
+			case LineType::Usemtl:
+				out->usemtls.push_back({ ReadName(line + 7, lineEnd), out->indices.size() });
+				break;
+
+			default:
+				break;
+			}
+		}
+		return true;
+	}
+
+	// --Xg[~Oǂݍ݂1ڂŁAs܂Ŏz-- //
+	struct ScanState
+	{
+		std::string materialName;// ---------------------------> Ousemtl̃}eA
+		uint32_t material = ObjIndex::None;// ------------------> materialName̔ԍ(܂Op`None)
+		std::unordered_map<std::string, uint32_t> materialIndex;// -> }eA -> ObjScan::materialNames̔ԍ
+	};
+
+	// --͈͓̍s̐ƒ_W͈̔͂W߂-- //
+	bool ScanLines(const char* p, const char* end, ScanState* state, ObjScan* out) {
+		while (p < end) {
+			const char* line = SkipSpace(p, end);
+			const char* lineEnd = static_cast<const char*>(std::memchr(line, '\n', end - line));
+			if (lineEnd == nullptr) lineEnd = end;
+			p = lineEnd < end ? lineEnd + 1 : end;
+
+			switch (Classify(line, lineEnd)) {
+			case LineType::Position: {
+				Float3 position;
+				const char* q = line + 2;
+				if (!(q = ParseFloat(q, lineEnd, &position.x))) return false;
+				if (!(q = ParseFloat(q, lineEnd, &position.y))) return false;
+				if (!(q = ParseFloat(q, lineEnd, &position.z))) return false;
+				if (out->positionCount++ == 0) {
+					out->boxMin = position;
+					out->boxMax = position;
+					break;
+				}
+				out->boxMin = Float3(std::min(out->boxMin.x, position.x), std::min(out->boxMin.y, position.y), std::min(out->boxMin.z, position.z));
+				out->boxMax = Float3(std::max(out->boxMax.x, position.x), std::max(out->boxMax.y, position.y), std::max(out->boxMax.z, position.z));
+				break;
+			}
+
+			case LineType::Texcoord:
+				out->texcoordCount++;
+				break;
+
+			case LineType::Normal:
+				out->normalCount++;
+				break;
+
+			// ʂ͋󔒂ŋ؂ꂽ_̐𐔂(CfbNX̊mF2ڂ̉͂ōs)
+			case LineType::Face: {
+				size_t corners = 0;
+				for (const char* q = SkipSpace(line + 2, lineEnd); q < lineEnd; q = SkipSpace(q, lineEnd)) {
+					corners++;
+					while (q < lineEnd && *q != ' ' && *q != '\t' && *q != '\r') q++;
+				}
+				if (corners < 3) break;
+
+				// Op`oĂƂɁA}eAŏɏoĂɓo^(O͓ԍ)
+				if (state->material == ObjIndex::None) {
+					auto inserted = state->materialIndex.emplace(state->materialName, static_cast<uint32_t>(out->materialNames.size()));
+					if (inserted.second) {
+						out->materialNames.push_back(state->materialName);
+						out->materialTriangles.push_back(0);
+					}
+					state->material = inserted.first->second;
+				}
+				out->materialTriangles[state->material] += corners - 2;
+				out->triangleCount += corners - 2;
+				break;
+			}
+
+			case LineType::Mtllib:
+				out->mtllibs.emplace_back(ReadName(line + 7, lineEnd));
+				break;
+
+			case LineType::Usemtl:
+				state->materialName = ReadName(line + 7, lineEnd);
+				state->material = ObjIndex::None;
+				break;
+
+			default:
+				break;
+			}
+		}
+		return true;
+	}
+
+	// --[begin, end)s̋ڂObjStreamBlockSizeoCgقǂ̃ubNɕāAfuncɓn-- //
+	// sŏIĂȂŌ̍śAl̓ǂݍ݂͈͂̊OɏoȂ悤'\0'tn
+	template <typename Func>
+	bool ForEachBlock(const char* begin, const char* end, Func func) {
+		const char* tail = end;// -> Ō̉s̎̈ʒu
+		while (tail > begin && tail[-1] != '\n') tail--;
+
+		for (const char* p = begin; p < tail;) {
+			const char* blockEnd = static_cast<size_t>(tail - p) > ObjStreamBlockSize ? NextLine(p + ObjStreamBlockSize, tail) : tail;
+			if (!func(p, blockEnd)) return false;
+			p = blockEnd;
+		}
+		if (tail == end) return true;
+
+		const std::string last(tail, end);
+		return func(last.c_str(), last.c_str() + last.size());
+	}
+
+	// --z܂Ƃ߂Ċmۂ-- //
+	void Reserve(const LineCount& count, ObjData* out) {
+		out->positions.reserve(out->positions.size() + count.positions);
+		out->texcoords.reserve(out->texcoords.size() + count.texcoords);
+		out->normals.reserve(out->normals.size() + count.normals);
+		out->indices.reserve(out->indices.size() + count.faces * 3);// -> Op`Ɖ
+	}
+
+	// --ParseObj̊Ԃg[J[Xbh(͂̒iKƂɃXbh蒼Ȃ)-- //
+	// Runɓn0Ԗڂ͌ĂяõXbhŁA1`workerCountԖڂ̓[J[Ŏs
+	class WorkerPool
+	{
+	public:
+		explicit WorkerPool(size_t workerCount) {
+			workers_.reserve(workerCount);
+			try {
+				for (size_t i = 0; i < workerCount; i++) workers_.emplace_back(&WorkerPool::Work, this, i + 1);
+			}
+			catch (...) {
+				Stop();// -> ꂽXbhI点Ă瓊
+				throw;
+			}
+		}
+		~WorkerPool() { Stop(); }
+
+		// --0`workerCount ̏sāAׂďI܂ő҂-- //
+		void Run(const std::function<void(size_t)>& task) {
+			{
+				std::lock_guard<std::mutex> lock(mutex_);
+				task_ = &task;
+				remaining_ = workers_.size();
+				generation_++;
+			}
+			wake_.notify_all();
+
+			// Ăяo̕sĂA[J[taskgI܂ő҂
+			try {
+				task(0);
+			}
+			catch (...) {
+				Wait();
+				throw;
+			}
+			Wait();
+		}
+
+	private:
+		void Wait() {
+			std::unique_lock<std::mutex> lock(mutex_);
+			done_.wait(lock, [this] { return remaining_ == 0; });
+		}
+
+		void Stop() {
+			{
+				std::lock_guard<std::mutex> lock(mutex_);
+				isStopping_ = true;
+			}
+			wake_.notify_all();
+			for (std::thread& worker : workers_) worker.join();
+			workers_.clear();
+		}
+
+		void Work(size_t index) {
+			uint64_t seen = 0;
+			for (;;) {
+				const std::function<void(size_t)>* task;
+				{
+					std::unique_lock<std::mutex> lock(mutex_);
+					wake_.wait(lock, [&] { return isStopping_ || generation_ != seen; });
+					if (isStopping_) return;
+					seen = generation_;
+					task = task_;
+				}
+				(*task)(index);
+				{
+					std::lock_guard<std::mutex> lock(mutex_);
+					if (--remaining_ == 0) done_.notify_one();
+				}
+			}
+		}
+
+		std::vector<std::thread> workers_;
+		std::mutex mutex_;
+		std::condition_variable wake_;// -> VI[J[ɒm点
+		std::condition_variable done_;// -> [J[ׂďIƂĂяoɒm点
+		const std::function<void(size_t)>* task_ = nullptr;
+		uint64_t generation_ = 0;// -----> RunĂ񂾉([J[V)
+		size_t remaining_ = 0;// --------> IĂȂ[J[̐
+		bool isStopping_ = false;
+	};
+
+	// --z[first, first + src.size())srcRs[-- //
+	template <typename T>
+	void CopyTo(std::vector<T>& dst, size_t first, const std::vector<T>& src) {
+		std::copy(src.begin(), src.end(), dst.begin() + first);
+	}
+}
+
+// --OBJt@C̓e͂-- //
+bool ParseObj(const char* begin, const char* end, ObjData* out, unsigned threadCount)
+{
+	// ɓĂf[^̐(CfbNX͂̑Ƃĉ)
+	LineCount base;
+	base.positions = out->positions.size();
+	base.texcoords = out->texcoords.size();
+	base.normals = out->normals.size();
+
+	// Xbȟ(t@C͕ĂȂȂ̂1Xbhɂ)
+	size_t chunkCount = threadCount != 0 ? threadCount : std::thread::hardware_concurrency();
+	chunkCount = std::min(chunkCount, static_cast<size_t>(end - begin) / MinChunkSize + 1);
+	if (chunkCount <= 1) {
+		// ׂĂ̒_Woutɂ̂ŁAp`͉͒ɕ
+		PendingPolygons pending;
+		Reserve(CountLines(begin, end), out);
+		return ParseLines(begin, end, base, out, &pending);
+	}
+
+	// --s̋ڂŃ`Nɕ-- //
+	std::vector<const char*> bounds(chunkCount + 1);
+	bounds[0] = begin;
+	bounds[chunkCount] = end;
+	for (size_t i = 1; i < chunkCount; i++) {
+		const char* p = begin + (end - begin) * i / chunkCount;
+		if (p < bounds[i - 1]) p = bounds[i - 1];
+		bounds[i] = p > begin && p[-1] != '\n' ? NextLine(p, end) : p;
+	}
+
+	// --`NƂɍs̎ނ𐔂āAOɂf[^̐(ݐϘa)߂-- //
+	WorkerPool pool(chunkCount - 1);
+	std::vector<LineCount> counts(chunkCount);
+	pool.Run([&](size_t i) { counts[i] = CountLines(bounds[i], bounds[i + 1]); });
+
+	std::vector<LineCount> offsets(chunkCount + 1);
+	offsets[0] = base;
+	for (size_t i = 0; i < chunkCount; i++) {
+		offsets[i + 1].positions = offsets[i].positions + counts[i].positions;
+		offsets[i + 1].texcoords = offsets[i].texcoords + counts[i].texcoords;
+		offsets[i + 1].normals = offsets[i].normals + counts[i].normals;
+	}
+
+	// --`NƂɉ(CfbNX͗ݐϘagăt@CŜł̔ԍɒ)-- //
+	std::vector<ObjData> chunks(chunkCount);
+	std::vector<PendingPolygons> pendings(chunkCount);
+	std::vector<char> succeeded(chunkCount);
+	pool.Run([&](size_t i) {
+		Reserve(counts[i], &chunks[i]);
+		succeeded[i] = ParseLines(bounds[i], bounds[i + 1], offsets[i], &chunks[i], &pendings[i]);
+	});
+	for (char s : succeeded) {
+		if (!s) return false;
+	}
+
+	// --CfbNX̗ݐϘa߂āAe`Ňʂׂ-- //
+	std::vector<size_t> indexOffsets(chunkCount + 1);
+	indexOffsets[0] = out->indices.size();
+	for (size_t i = 0; i < chunkCount; i++) indexOffsets[i + 1] = indexOffsets[i] + chunks[i].indices.size();
+
+	for (size_t i = 0; i < chunkCount; i++) {
+		out->mtllibs.insert(out->mtllibs.end(), chunks[i].mtllibs.begin(), chunks[i].mtllibs.end());
+		for (const ObjMaterialRange& range : chunks[i].usemtls) {
+			out->usemtls.push_back({ range.material, indexOffsets[i] + range.indexFirst });
+		}
+	}
+
+	out->positions.resize(offsets[chunkCount].positions);
+	out->texcoords.resize(offsets[chunkCount].texcoords);
+	out->normals.resize(offsets[chunkCount].normals);
+	out->indices.resize(indexOffsets[chunkCount]);
+	pool.Run([&](size_t i) {
+		CopyTo(out->positions, offsets[i].positions, chunks[i].positions);
+		CopyTo(out->texcoords, offsets[i].texcoords, chunks[i].texcoords);
+		CopyTo(out->normals, offsets[i].normals, chunks[i].normals);
+		CopyTo(out->indices, indexOffsets[i], chunks[i].indices);
+		chunks[i] = ObjData();
+	});
+
+	// --Õ`N̒_WgĂp`𕪊-- //
+	pool.Run([&](size_t i) {
+		for (const PendingPolygon& polygon : pendings[i].polygons) {
+			Triangulate(&pendings[i].corners[polygon.cornerFirst], polygon.cornerCount, out->positions.data(),
+				&out->indices[indexOffsets[i] + polygon.indexOffset]);
+		}
+	});
+
+	return true;
+}
+
+// --OBJt@CۂƓǂݍŉ͂-- //
+bool LoadObj(const std::string& path, ObjData* out, unsigned threadCount)
+{
+	std::ifstream file(path, std::ios::binary | std::ios::ate);
+	if (file.fail()) return false;
+
+	// t@CŜ1̃obt@ɓǂݍ('\0'tĂ)
+	std::streamoff size = file.tellg();
+	std::vector<char> buffer(static_cast<size_t>(size) + 1, '\0');
+	file.seekg(0, std::ios::beg);
+	if (!file.read(buffer.data(), size)) return false;
+
+	return ParseObj(buffer.data(), buffer.data() + size, out, threadCount);
+}
+
+// --OBJt@C𑖍āAƒ_W͈̔͂W߂-- //
+bool ScanObj(const char* begin, const char* end, ObjScan* out)
+{
+	*out = ObjScan();
+	ScanState state;
+	return ForEachBlock(begin, end, [&](const char* p, const char* blockEnd) { return ScanLines(p, blockEnd, &state, out); });
+}
+
+// --OBJt@C擪班͂āAOp`sinkɓn-- //
+bool StreamObj(const char* begin, const char* end, const ObjScan& scan, ObjStreamSink* sink)
+{
+	// }eA -> ObjScan::materialNames̔ԍ
+	std::unordered_map<std::string, uint32_t> materialIndex;
+	for (size_t i = 0; i < scan.materialNames.size(); i++) materialIndex.emplace(scan.materialNames[i], static_cast<uint32_t>(i));
+
+	// ʂ͂O̒_WȂǂĝŁA_WAeNX`UVA@xNg͍Ō܂Ŏc
+	ObjData obj;
+	obj.positions.reserve(scan.positionCount);
+	obj.texcoords.reserve(scan.texcoordCount);
+	obj.normals.reserve(scan.normalCount);
+
+	// ׂĂ̒_Wobjɂ̂ŁAp`͉͒ɕ(pending͎gȂ)
+	PendingPolygons pending;
+	std::string material;// -> Ousemtl̃}eA(ÕubN玝z)
+
+	return ForEachBlock(begin, end, [&](const char* p, const char* blockEnd) {
+		LineCount base;
+		base.positions = obj.positions.size();
+		base.texcoords = obj.texcoords.size();
+		base.normals = obj.normals.size();
+		if (!ParseLines(p, blockEnd, base, &obj, &pending)) return false;
+
+		// --usemtl̈ʒuŋ؂āA}eAƂɓn-- //
+		size_t first = 0;
+		for (size_t r = 0; r <= obj.usemtls.size(); r++) {
+			size_t last = r < obj.usemtls.size() ? obj.usemtls[r].indexFirst : obj.indices.size();
+			if (last > first) {
+				auto found = materialIndex.find(material);
+				if (found == materialIndex.end()) return false;
+				if (!sink->OnTriangles(obj, found->second, &obj.indices[first], (last - first) / 3)) return false;
+				first = last;
+			}
+			if (r < obj.usemtls.size()) material = obj.usemtls[r].material;
+		}
+
+		// ubN̖ʂ͓nÎŎ̂Ă(mۂ͎̈̃ubNŎg)
+		obj.indices.clear();
+		obj.usemtls.clear();
+		obj.mtllibs.clear();
+		return true;
+	});
+}
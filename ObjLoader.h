@@ -0,0 +1,83 @@
+#pragma once
+#include "Float2.h"
+#include "Float3.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// --OBJt@C̖ʂ\钸_1̃CfbNX(0n܂)-- //
+struct ObjIndex
+{
+	static constexpr uint32_t None = 0xffffffff;// -> wȂ
+
+	uint32_t position;// -> _W̃CfbNX
+	uint32_t texcoord;// -> eNX`UṼCfbNX
+	uint32_t normal;// ---> @xNg̃CfbNX
+};
+
+// --usemtlŐ؂ւ}eA͈̔-- //
+struct ObjMaterialRange
+{
+	std::string material;// --> }eA
+	size_t indexFirst;// -----> ̃}eAgŏ̃CfbNẌʒu(͈̔͂̐擪܂ő)
+};
+
+// --OBJt@Cǂݍ񂾃f[^-- //
+// eNX`UV̓t@C̒l̂܂(V̔]͂Ȃ)
+// 4_ȏ̖ʂ͉͒ɎOp`ɕ(ʂȂ`AȂEar Clipping)
+struct ObjData
+{
+	std::vector<Float3> positions;// -----> _W
+	std::vector<Float2> texcoords;// -----> eNX`UV
+	std::vector<Float3> normals;// -------> @xNg
+	std::vector<ObjIndex> indices;// -----> Op`\钸_̃CfbNX(3Aʂ̏ɕׂ)
+	std::vector<std::string> mtllibs;// --> }eAt@C
+	std::vector<ObjMaterialRange> usemtls;// -> usemtl̈ʒu(ŏusemtlO̖ʂ̓}eA"")
+};
+
+// --OBJt@C̓e͂-- //
+// --[begin, end)̒͐lƂēǂ߂Ȃ('\0'Ȃ)ŏIĂKv-- //
+// --CfbNX͈͊OȂǂ̕sȃf[^ꍇfalseԂ-- //
+// --threadCount0ȂCPŨXbhŁAs̋ڂŕĕɉ͂(ʂ1Xbh̏ꍇƓ)-- //
+bool ParseObj(const char* begin, const char* end, ObjData* out, unsigned threadCount = 0);
+
+// --OBJt@CۂƓǂݍŉ͂(JȂꍇȂǂfalseԂ)-- //
+bool LoadObj(const std::string& path, ObjData* out, unsigned threadCount = 0);
+
+// --Xg[~Oǂݍ݂ňxɉ͂oCg(̑傫Ƃɍs̋ڂŋ؂)-- //
+const size_t ObjStreamBlockSize = 1 << 20;
+
+// --OBJt@C1񑖍ďW߂Ɣ͈(Xg[~Oǂݍ݂1)-- //
+struct ObjScan
+{
+	size_t positionCount = 0;// ---------------> _W̐
+	size_t texcoordCount = 0;// ---------------> eNX`UV̐
+	size_t normalCount = 0;// -----------------> @xNg̐
+	size_t triangleCount = 0;// ---------------> Op`ɕ̎Op`
+	std::vector<std::string> mtllibs;// -------> }eAt@C
+	std::vector<std::string> materialNames;// -> Op`}eA(ŏɏoĂAŏusemtlO̖ʂ"")
+	std::vector<size_t> materialTriangles;// --> }eAƂ̎Op`
+	Float3 boxMin;// --------------------------> ׂĂ̒_W͂AABB̍ŏ_(ʂŎgĂȂW܂)
+	Float3 boxMax;// --------------------------> ׂĂ̒_W͂AABB̍ő_
+};
+
+// --Xg[~Oǂݍ݂ŎOp`󂯎-- //
+class ObjStreamSink {
+public:
+	virtual ~ObjStreamSink() = default;
+
+	// }eA̎Op`܂Ƃ߂Ď󂯎(falseԂƓǂݍ݂𒆒f)
+	// materialObjScan::materialNames̔ԍAcorners3񂾎Op`̒_
+	// objɂ͂܂łɓǂݍ񂾒_WAeNX`UVA@xNgĂ
+	virtual bool OnTriangles(const ObjData& obj, uint32_t material, const ObjIndex* corners, size_t triangleCount) = 0;
+};
+
+// --OBJt@C𑖍āAƒ_W͈̔͂W߂(_ʂ͕ێȂ)-- //
+// --[begin, end)͉sŏIĂȂĂ悢(}bvt@Ĉ܂ܓn)-- //
+bool ScanObj(const char* begin, const char* end, ObjScan* out);
+
+// --OBJt@C擪ObjStreamBlockSizeoCg͂āAOp`sinkɓn-- //
+// --ێ̂͒_WAeNX`UVA@xNg(scan̐ł傤ǂ̑傫mۂ)ŁAʂ͓nɎ̂Ă-- //
+// --Op`̓t@C̏ɓn(}eAƂɕƁAParseObǰʂ}eAƂɕ̂ƓɂȂ)-- //
+// --scanɃt@CςĂꍇȂǂfalseԂ-- //
+bool StreamObj(const char* begin, const char* end, const ObjScan& scan, ObjStreamSink* sink);
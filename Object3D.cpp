@@ -2,6 +2,8 @@
 #include "DX12Cmd.h"
 #include "Texture.h"
 #include "Util.h"
+#include "WinAPI.h"
+#include <cmath>
 
 // ÓIoϐ̎
 ID3D12Device* Object3D::device_ = nullptr;// ---------------> foCX
@@ -10,6 +12,10 @@ D3D12_HEAP_PROPERTIES Object3D::heapProp_ = {};// ----------> 
 D3D12_RESOURCE_DESC Object3D::resdesc_ = {};// -------------> \[Xݒ
 Camera* Object3D::camera_ = nullptr;// ---------------------> J
 LightGroup* Object3D::lightGroup_ = nullptr;// -------------> Cg
+MeshVertexFormat Object3D::vertexFormat_ = MeshVertexFormat::Float;// -> ݒ肵ĂpCvC̒_f[^̌`
+Object3DVertexInput Object3D::vertexInput_ = Object3DVertexInput::Interleaved;// -> ݒ肵ĂpCvC̒_obt@̎g
+float Object3D::lodPixelError_ = 1.0f;// ---------------------> LOĎ덷̉ʏł̋e[sNZ]
+float Object3D::lodHysteresis_ = 0.7f;// ---------------------> eLODɐ؂ւƂ̋eʂ̔{
 
 Object3D::Object3D() :
 #pragma region Xg
@@ -20,6 +26,11 @@ Object3D::Object3D() :
 	matWorld_{},// --------------------> [hW
 	constBuff_(nullptr),// ------------> 萔obt@
 	model_(nullptr),// ----------------> f
+	lod_(0),// ------------------------> `悵ĂLOD
+	visibleSubmeshes_{},// ------------> JǑ
+	isBackfaceCulling_(true),// -------> ̃NX^`悵Ȃ
+	worldBox_{},// --------------------> f͂AABB([hW)
+	worldSphere_{},// -----------------> f͂ދ([hW)
 	dirty(true)// ---------------------> _[eBtO
 #pragma endregion
 {
@@ -42,27 +53,36 @@ void Object3D::GenerateConstBuffer() {
 	assert(SUCCEEDED(result));
 }
 
-void Object3D::TransferConstBuffer() {
+void Object3D::UpdateWorld() {
 	// _[eB[tO[ON]Ȃ
 	if (dirty) {
-		// [hWvZ
-		Matrix4 matScale, matRot, matTrans;
-		matScale = Matrix4Scale(scale_);
-		matRot = Matrix4Identity();
-		matRot *= Matrix4RotateZ(Util::Degree2Radian(rotation_.z));
-		matRot *= Matrix4RotateX(Util::Degree2Radian(rotation_.x));
-		matRot *= Matrix4RotateY(Util::Degree2Radian(rotation_.y));
-		matTrans = Matrix4Translate(position_);
-
-		// [hs̍
-		matWorld_ = Matrix4Identity();// -> ό`̃Zbg
-		matWorld_ *= matScale;// ---------> [hsɃXP[O𔽉f
-		matWorld_ *= matRot;// -----------> [hsɉ]𔽉f
-		matWorld_ *= matTrans;// ---------> [hsɕsړ𔽉f
+		// ]p(x@)NH[^jI߂(]ZXY)
+		Quaternion rot = QuaternionFromEuler({
+			Util::Degree2Radian(rotation_.x),
+			Util::Degree2Radian(rotation_.y),
+			Util::Degree2Radian(rotation_.z) });
+
+		// [hs̍(XP[O]sړ1ŌvZ)
+		matWorld_ = Matrix4ComposeTRS(scale_, rot, position_);
+
+		// f̋E[hWɂ(f΍W1_)
+		if (model_) {
+			worldBox_ = AABBTransform(model_->GetBounds().box, matWorld_);
+			worldSphere_ = SphereTransform(model_->GetBounds().sphere, matWorld_);
+		}
+		else {
+			worldBox_ = { position_, position_ };
+			worldSphere_ = { position_, 0.0f };
+		}
 
 		// _[eB[tO[OFF]ɂ
 		dirty = false;
 	}
+}
+
+void Object3D::TransferConstBuffer() {
+	// [hs̍XV
+	UpdateWorld();
 
 	// ֐s̐ۂ𔻕ʗp̕ϐ
 	HRESULT result;
@@ -77,11 +97,35 @@ void Object3D::TransferConstBuffer() {
 	constMap->world = matWorld_;
 	constMap->cameraPos = camera_->eye_;
 	constMap->color = color_;
+	constMap->positionOffset = model_->GetQuantization().offset;
+	constMap->positionScale = model_->GetQuantization().scale;
 
 	// }bsOI
 	constBuff_->Unmap(0, nullptr);
 }
 
+void Object3D::SelectLod()
+{
+	const size_t lodCount = model_->GetLodCount();
+	if (lodCount <= 1) {
+		lod_ = 0;
+		return;
+	}
+
+	// --f̍Wnł̒1ʏŉsNZɂȂ邩-- //
+	// es_22(1 / tan(㉺p / 2))Ɖʂ̏c̔|AJ̋(E̒S܂)Ŋ
+	Float3 toCamera = worldSphere_.center - camera_->eye_;
+	float distance = std::sqrt(toCamera.x * toCamera.x + toCamera.y * toCamera.y + toCamera.z * toCamera.z);
+	float scale = std::fmax(std::fabs(scale_.x), std::fmax(std::fabs(scale_.y), std::fabs(scale_.z)));
+	float pixelsPerUnit = camera_->GetMatProjection().m[1][1] * WinAPI::GetHeight() * 0.5f * scale / std::fmax(distance, 0.0001f);
+
+	// --LOĎ덷ʏŋeʂɎ܂AԑeLODI-- //
+	// ׂLODւ͋eʂ𒴂炷ɖ߂AeLODւ͋eʂlodHysteresis_{܂Ő؂ւȂ
+	if (lod_ >= lodCount) lod_ = lodCount - 1;
+	while (lod_ > 0 && model_->GetLodError(lod_) * pixelsPerUnit > lodPixelError_) lod_--;
+	while (lod_ + 1 < lodCount && model_->GetLodError(lod_ + 1) * pixelsPerUnit <= lodPixelError_ * lodHysteresis_) lod_++;
+}
+
 Object3D* Object3D::CreateObject3D(Model* model)
 {
 	// CX^X
@@ -117,6 +161,8 @@ void Object3D::StaticInitialize(ID3D12Device* device, ID3D12GraphicsCommandList*
 void Object3D::PreDraw() {
 	// pCvCXe[g̐ݒ
 	cmdList_->SetPipelineState(DX12Cmd::GetObject3DPipeline().pipelineState.Get());
+	vertexFormat_ = MeshVertexFormat::Float;
+	vertexInput_ = Object3DVertexInput::Interleaved;
 	
 	// [gVOl`̐ݒ
 	cmdList_->SetGraphicsRootSignature(DX12Cmd::GetObject3DPipeline().rootSignature.Get());
@@ -129,11 +175,63 @@ void Object3D::PreDraw() {
 	cmdList_->SetDescriptorHeaps(1, ppHeaps);
 }
 
-void Object3D::Draw()
+void Object3D::PreDrawDepth() {
+	// pCvCXe[gƃ[gVOl`̐ݒ([x`悷)
+	PipelineSet pipeline = DX12Cmd::GetObject3DPipeline(MeshVertexFormat::Float, Object3DVertexInput::DepthOnly);
+	cmdList_->SetPipelineState(pipeline.pipelineState.Get());
+	cmdList_->SetGraphicsRootSignature(pipeline.rootSignature.Get());
+	vertexFormat_ = MeshVertexFormat::Float;
+	vertexInput_ = Object3DVertexInput::DepthOnly;
+
+	// v~eBu`ݒ
+	cmdList_->IASetPrimitiveTopology(D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+}
+
+bool Object3D::PrepareDraw()
 {
+	// --fŜ͂ދ̊OȂANX^𒲂ׂɕ`悵Ȃ-- //
+	// Camera::Updateŋ߂([hW)g
+	UpdateWorld();
+	if (!CheckFrustum2Sphere(camera_->GetFrustum(), worldSphere_)) return false;
+
 	// IuWFNg̍XV
 	TransferConstBuffer();
 
+	// `悷LODI
+	SelectLod();
+
+	// --̊OƗ̃NX^(f̍WnŔ肷)-- //
+	// ̔́A[hs񂪔]ĂȂ(s񎮂)ꍇs
+	float det = 0.0f;
+	Matrix4 matInverse = Matrix4AffineInverse(matWorld_, &det);
+	Frustum frustum = FrustumFromMatrix(matWorld_ * camera_->GetMatView() * camera_->GetMatProjection());
+	model_->Cull(lod_, frustum, Matrix4Transform(camera_->eye_, matInverse), isBackfaceCulling_ && det > 0.0f, &visibleSubmeshes_);
+
+	// ׂČȂΕ`悵Ȃ
+	return !visibleSubmeshes_.empty();
+}
+
+void Object3D::SetPipeline(Object3DVertexInput input)
+{
+	// OƓȂݒ肵ȂȂ
+	if (model_->GetVertexFormat() == vertexFormat_ && input == vertexInput_) return;
+
+	vertexFormat_ = model_->GetVertexFormat();
+	vertexInput_ = input;
+	PipelineSet pipeline = DX12Cmd::GetObject3DPipeline(vertexFormat_, vertexInput_);
+	cmdList_->SetPipelineState(pipeline.pipelineState.Get());
+	cmdList_->SetGraphicsRootSignature(pipeline.rootSignature.Get());
+}
+
+void Object3D::Draw()
+{
+	// ̊OANX^Ε`悵Ȃ
+	if (!PrepareDraw()) return;
+
+	// f̒_f[^̌`ƒ_obt@̕ɍ킹ăpCvC؂ւ
+	// ([gVOl`ݒ肵Ȃ̂ŁA[gp[^ݒ肷Oɍs)
+	SetPipeline(model_->IsSplitStreams() ? Object3DVertexInput::Split : Object3DVertexInput::Interleaved);
+
 	// --萔obt@r[iCBVj̐ݒR}h-- //
 	cmdList_->SetGraphicsRootConstantBufferView(0, constBuff_->GetGPUVirtualAddress());
 
@@ -141,7 +239,22 @@ void Object3D::Draw()
 	lightGroup_->Draw();
 
 	// f̏ɕ`
-	model_->Draw();
+	model_->Draw(visibleSubmeshes_);
+}
+
+void Object3D::DrawDepth()
+{
+	// ̊OANX^Ε`悵Ȃ
+	if (!PrepareDraw()) return;
+
+	// f̒_f[^̌`ɍ킹āA[x`悷pCvC؂ւ
+	SetPipeline(Object3DVertexInput::DepthOnly);
+
+	// --萔obt@r[iCBVj̐ݒR}h-- //
+	cmdList_->SetGraphicsRootConstantBufferView(0, constBuff_->GetGPUVirtualAddress());
+
+	// Wŕ`
+	model_->DrawDepth(visibleSubmeshes_);
 }
 
 void Object3D::SetPos(const Float3& position)
@@ -18,6 +18,10 @@ public:// -----
 		Float3 cameraPos;// -> JW([hW)
 		float pad1;// -------> pfBO
 		Float4 color;// -----> F(RGBA)
+		Float3 positionOffset;// -> ʎqW߂Ƃ̍ŏ_
+		float pad2;// ------------> pfBO
+		Float3 positionScale;// --> ʎqW߂Ƃ̑傫
+		float pad3;// ------------> pfBO
 	};
 
 private:// -----oϐ----- //
@@ -28,6 +32,11 @@ private:// -----
 	Matrix4 matWorld_;// -----------------> [hW
 	ComPtr<ID3D12Resource> constBuff_;// -> 萔obt@
 	Model* model_;// ---------------------> f
+	size_t lod_;// -----------------------> `悵ĂLOD
+	std::vector<Submesh> visibleSubmeshes_;// -> JǑ(`悷͈)
+	bool isBackfaceCulling_;// -----------> ̃NX^`悵Ȃ
+	AABB worldBox_;// --------------------> f͂AABB([hWAdirtŷƂɍXV)
+	Sphere worldSphere_;// ---------------> f͂ދ([hWAdirtŷƂɍXV)
 	bool dirty;// ------------------------> _[eBtO
 
 private:// -----ÓIoϐ----- //
@@ -37,6 +46,10 @@ private:// -----
 	static D3D12_RESOURCE_DESC resdesc_;// --------> \[Xݒ
 	static Camera* camera_;// ---------------------> J
 	static LightGroup* lightGroup_;// -------------> Cg
+	static MeshVertexFormat vertexFormat_;// ------> ݒ肵ĂpCvC̒_f[^̌`
+	static Object3DVertexInput vertexInput_;// ----> ݒ肵ĂpCvC̒_obt@̎g
+	static float lodPixelError_;// ----------------> LOĎ덷̉ʏł̋e[sNZ]
+	static float lodHysteresis_;// ----------------> eLODɐ؂ւƂ̋eʂ̔{(1A؂ւ̂h)
 
 private:// -----o֐----- //
 	/// <summary>
@@ -49,11 +62,31 @@ private:// -----
 	/// </summary>
 	void GenerateConstBuffer();
 
+	/// <summary>
+	/// [hsƃ[hW̋EXV(_[eB[tO[ON]̂Ƃ)
+	/// </summary>
+	void UpdateWorld();
+
 	/// <summary>
 	/// 萔obt@XV
 	/// </summary>
 	void TransferConstBuffer();
 
+	/// <summary>
+	/// J̋LODI
+	/// </summary>
+	void SelectLod();
+
+	/// <summary>
+	/// `̏(萔obt@XVALOD̑IAJO)A`悷͈͂false
+	/// </summary>
+	bool PrepareDraw();
+
+	/// <summary>
+	/// f̒_f[^̌`ƒ_obt@̎gɍ킹ăpCvC؂ւ(OƓȂ牽Ȃ)
+	/// </summary>
+	void SetPipeline(Object3DVertexInput input);
+
 public:// -----ÓIo֐----- //
 	/// <summary>
 	/// [Object3D]CX^X쐬
@@ -70,6 +103,11 @@ public:// -----
 	/// </summary>
 	static void PreDraw();
 
+	/// <summary>
+	/// [x`悷O([x̃vpXepǍDrawDepthŕ`悷)
+	/// </summary>
+	static void PreDrawDepth();
+
 	/// <summary>
 	/// Jݒ
 	/// </summary>
@@ -80,12 +118,22 @@ public:// -----
 	/// </summary>
 	static void SetLightGroup(LightGroup* lightGroup) { lightGroup_ = lightGroup; }
 
+	/// <summary>
+	/// LOĎ덷̉ʏł̋e[sNZ]ݒ
+	/// </summary>
+	static void SetLodPixelError(float pixels) { lodPixelError_ = pixels; }
+
 public:// -----o֐----- //
 	/// <summary>
 	/// `揈
 	/// </summary>
 	void Draw();
 
+	/// <summary>
+	/// [x`(PreDrawDeptȟɌĂԁAW̒_obt@ǂ)
+	/// </summary>
+	void DrawDepth();
+
 	/// <summary>
 	/// Wݒ
 	/// </summary>
@@ -106,10 +154,15 @@ public:// -----
 	/// </summary>
 	void SetColor(const Float4& color);
 
+	/// <summary>
+	/// ̃NX^`悵Ȃݒ(ʂ郂ffalseɂ)
+	/// </summary>
+	void SetBackfaceCulling(bool isBackfaceCulling) { isBackfaceCulling_ = isBackfaceCulling; }
+
 	/// <summary>
 	/// fݒ
 	/// </summary>
-	void SetModel(Model* model) { model_ = model; };
+	void SetModel(Model* model) { model_ = model; lod_ = 0; dirty = true; };
 
 	/// <summary>
 	/// W擾
@@ -125,4 +178,19 @@ public:// -----
 	/// gk擾
 	/// </summary>
 	inline const Float3& GetScale() { return scale_; }
+
+	/// <summary>
+	/// f͂AABB擾([hW)
+	/// </summary>
+	inline const AABB& GetWorldAABB() { UpdateWorld(); return worldBox_; }
+
+	/// <summary>
+	/// f͂ދ擾([hW)
+	/// </summary>
+	inline const Sphere& GetWorldSphere() { UpdateWorld(); return worldSphere_; }
+
+	/// <summary>
+	/// Ōɕ`悵LOD擾
+	/// </summary>
+	inline size_t GetLod() { return lod_; }
 };
\ No newline at end of file
@@ -239,7 +239,7 @@ PipelineSet CreateSpritePipeline() {
 	// --ݒ肵pCvCԂ-- //
 	return pipelineSet;
 }
-PipelineSet CreateObject3DPipeline()
+PipelineSet CreateObject3DPipeline(MeshVertexFormat vertexFormat, Object3DVertexInput input)
 {
 	// --֐ǂ𔻕ʂpϐ-- //
 	// DirectX̊֐́AHRESULT^ŐǂԂ̂̂ł̕ϐ쐬 //
@@ -255,9 +255,12 @@ PipelineSet CreateObject3DPipeline()
 	ComPtr<ID3DBlob> psBlob = nullptr; // sNZVF[_IuWFNg
 	ComPtr<ID3DBlob> errorBlob = nullptr; // G[IuWFNg
 
-	// --_VF[_̓ǂݍ݂ƃRpC-- //
+	// --_VF[_̓ǂݍ݂ƃRpC([x`悷ꍇ́Aǂ̌`łW߂VF[_[)-- //
+	const wchar_t* vsFileName = L"Resources/Shaders/Object3DVS.hlsl";
+	if (input == Object3DVertexInput::DepthOnly) vsFileName = L"Resources/Shaders/Object3DDepthVS.hlsl";
+	else if (vertexFormat == MeshVertexFormat::Quantized) vsFileName = L"Resources/Shaders/Object3DQuantizedVS.hlsl";
 	result = D3DCompileFromFile(
-		L"Resources/Shaders/Object3DVS.hlsl", // VF[_t@C
+		vsFileName, // VF[_t@C
 		nullptr,
 		D3D_COMPILE_STANDARD_FILE_INCLUDE, // CN[h\ɂ
 		"main", "vs_5_0", // Gg[|CgAVF[_[fw
@@ -280,29 +283,31 @@ PipelineSet CreateObject3DPipeline()
 		assert(0);
 	}
 
-	// --sNZVF[_̓ǂݍ݂ƃRpC-- //
-	result = D3DCompileFromFile(
-		L"Resources/Shaders/Object3DPS.hlsl", // VF[_t@C
-		nullptr,
-		D3D_COMPILE_STANDARD_FILE_INCLUDE, // CN[h\ɂ
-		"main", "ps_5_0", // Gg[|CgAVF[_[fw
-		D3DCOMPILE_DEBUG | D3DCOMPILE_SKIP_OPTIMIZATION, // fobOpݒ
-		0,
-		psBlob.GetAddressOf(), errorBlob.GetAddressOf());
-
-	// --G[Ȃ-- //
-	if (FAILED(result))
-	{
-		// errorBlobG[estring^ɃRs[
-		std::string error;
-		error.resize(errorBlob->GetBufferSize());
-		std::copy_n((char*)errorBlob->GetBufferPointer(),
-			errorBlob->GetBufferSize(),
-			error.begin());
-		error += "\n";
-		// G[eo̓EBhEɕ\
-		OutputDebugStringA(error.c_str());
-		assert(0);
+	// --sNZVF[_̓ǂݍ݂ƃRpC([x`悷ꍇ͎gȂ)-- //
+	if (input != Object3DVertexInput::DepthOnly) {
+		result = D3DCompileFromFile(
+			L"Resources/Shaders/Object3DPS.hlsl", // VF[_t@C
+			nullptr,
+			D3D_COMPILE_STANDARD_FILE_INCLUDE, // CN[h\ɂ
+			"main", "ps_5_0", // Gg[|CgAVF[_[fw
+			D3DCOMPILE_DEBUG | D3DCOMPILE_SKIP_OPTIMIZATION, // fobOpݒ
+			0,
+			psBlob.GetAddressOf(), errorBlob.GetAddressOf());
+
+		// --G[Ȃ-- //
+		if (FAILED(result))
+		{
+			// errorBlobG[estring^ɃRs[
+			std::string error;
+			error.resize(errorBlob->GetBufferSize());
+			std::copy_n((char*)errorBlob->GetBufferPointer(),
+				errorBlob->GetBufferSize(),
+				error.begin());
+			error += "\n";
+			// G[eo̓EBhEɕ\
+			OutputDebugStringA(error.c_str());
+			assert(0);
+		}
 	}
 
 #pragma endregion
@@ -343,6 +348,20 @@ PipelineSet CreateObject3DPipeline()
 		},
 	};
 
+	// --ʎq_f[^(MeshQuantizedVertex)p̒_CAEg-- //
+	// W̓VF[_[AABBɖ߂A@͔ʑ̓e߂
+	D3D12_INPUT_ELEMENT_DESC quantizedInputLayout[] = {
+		{ "POSITION", 0, DXGI_FORMAT_R16G16B16A16_UNORM, 0, D3D12_APPEND_ALIGNED_ELEMENT, D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0 },// -> AABB̈ʒu(0`1)
+		{ "NORMAL", 0, DXGI_FORMAT_R16G16_SNORM, 0, D3D12_APPEND_ALIGNED_ELEMENT, D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0 },// ----> ʑ̓e@(-1`1)
+		{ "TEXCOORD", 0, DXGI_FORMAT_R16G16_FLOAT, 0, D3D12_APPEND_ALIGNED_ELEMENT, D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0 },// ---> xUV
+	};
+
+	// --WƂȊOʂ̒_obt@ɕꍇ́AWȊOXbg1ǂ-- //
+	if (input == Object3DVertexInput::Split) {
+		for (size_t i = 1; i < _countof(inputLayout); i++) inputLayout[i].InputSlot = 1;
+		for (size_t i = 1; i < _countof(quantizedInputLayout); i++) quantizedInputLayout[i].InputSlot = 1;
+	}
+
 #pragma endregion
 	/// --END-- ///
 
@@ -355,8 +374,10 @@ PipelineSet CreateObject3DPipeline()
 	// --VF[_[̐ݒ-- //
 	pipelineDesc.VS.pShaderBytecode = vsBlob->GetBufferPointer();
 	pipelineDesc.VS.BytecodeLength = vsBlob->GetBufferSize();
-	pipelineDesc.PS.pShaderBytecode = psBlob->GetBufferPointer();
-	pipelineDesc.PS.BytecodeLength = psBlob->GetBufferSize();
+	if (psBlob) {
+		pipelineDesc.PS.pShaderBytecode = psBlob->GetBufferPointer();
+		pipelineDesc.PS.BytecodeLength = psBlob->GetBufferSize();
+	}
 
 	// --Tv}XN̐ݒ-- //
 	pipelineDesc.SampleMask = D3D12_DEFAULT_SAMPLE_MASK; // Wݒ
@@ -370,7 +391,7 @@ PipelineSet CreateObject3DPipeline()
 	// --fvXXeVXe[g-- //
 	pipelineDesc.DepthStencilState.DepthEnable = true;// -> [xeXgs
 	pipelineDesc.DepthStencilState.DepthWriteMask = D3D12_DEPTH_WRITE_MASK_ALL;// -> ݋
-	pipelineDesc.DepthStencilState.DepthFunc = D3D12_COMPARISON_FUNC_LESS;// -> ΍i
+	pipelineDesc.DepthStencilState.DepthFunc = D3D12_COMPARISON_FUNC_LESS_EQUAL;// -> ΍i([x̃vpX̌ł`ł悤)
 	pipelineDesc.DSVFormat = DXGI_FORMAT_D32_FLOAT;// -> [xltH[}bg
 
 	// --_[^[Qbg̃uhݒ-- //
@@ -408,15 +429,31 @@ PipelineSet CreateObject3DPipeline()
 	//pipelineDesc.DSVFormat = DXGI_FORMAT_D32_FLOAT;
 
 	// --_CAEg̐ݒ-- //
-	pipelineDesc.InputLayout.pInputElementDescs = inputLayout;
-	pipelineDesc.InputLayout.NumElements = _countof(inputLayout);
+	if (vertexFormat == MeshVertexFormat::Quantized) {
+		pipelineDesc.InputLayout.pInputElementDescs = quantizedInputLayout;
+		pipelineDesc.InputLayout.NumElements = _countof(quantizedInputLayout);
+	}
+	else {
+		pipelineDesc.InputLayout.pInputElementDescs = inputLayout;
+		pipelineDesc.InputLayout.NumElements = _countof(inputLayout);
+	}
+
+	// [x`悷ꍇ́A擪̍W̗vfg
+	if (input == Object3DVertexInput::DepthOnly) pipelineDesc.InputLayout.NumElements = 1;
 
 	// --}`̌`ݒ-- //
 	pipelineDesc.PrimitiveTopologyType = D3D12_PRIMITIVE_TOPOLOGY_TYPE_TRIANGLE;
 
 	// --̑̐ݒ-- //
-	pipelineDesc.NumRenderTargets = 1; // `Ώۂ1
-	pipelineDesc.RTVFormats[0] = DXGI_FORMAT_R8G8B8A8_UNORM_SRGB; // 0~255wRGBA
+	if (input == Object3DVertexInput::DepthOnly) {
+		pipelineDesc.NumRenderTargets = 0;// -> [x
+		blenddesc.BlendEnable = false;
+		blenddesc.RenderTargetWriteMask = 0;
+	}
+	else {
+		pipelineDesc.NumRenderTargets = 1; // `Ώۂ1
+		pipelineDesc.RTVFormats[0] = DXGI_FORMAT_R8G8B8A8_UNORM_SRGB; // 0~255wRGBA
+	}
 	pipelineDesc.SampleDesc.Count = 1; // 1sNZɂ1TvO
 
 	// --fXNv^W̐ݒ-- //
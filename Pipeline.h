@@ -14,6 +14,9 @@ using namespace Microsoft::WRL;
 // ---- //
 #include <string>
 
+// --_f[^̌`-- //
+#include "MeshQuantize.h"
+
 // --^ł邱Ƃ𔻒肷@\̒ǉ-- //
 #include <cassert>
 
@@ -29,8 +32,16 @@ struct PipelineSet {
 // --XvCgppCvC-- //
 PipelineSet CreateSpritePipeline();
 
+// --IuWFNg3D̒_obt@̎g-- //
+enum class Object3DVertexInput {
+	Interleaved,// -> 1̒_obt@(WA@AUV𒸓_Ƃɕׂ)
+	Split,// -------> W̒_obt@(Xbg0)ƁA@UV̒_obt@(Xbg1)
+	DepthOnly,// ---> Xbg0̍WǂŐ[x`悷([x̃vpXepAǂ̕тłg)
+};
+
 // --IuWFNg3D̃pCvC-- //
-PipelineSet CreateObject3DPipeline();
+// --vertexFormatQuantizedȂʎq_f[^(MeshQuantizedVertex)p̒_CAEgƃVF[_[ɂ-- //
+PipelineSet CreateObject3DPipeline(MeshVertexFormat vertexFormat = MeshVertexFormat::Float, Object3DVertexInput input = Object3DVertexInput::Interleaved);
 
 // --r{[hp̃pCvC-- //
 PipelineSet CreateBillBoardPipeline();
\ No newline at end of file
@@ -0,0 +1,136 @@
+#include "Quaternion.h"
+#include "Util.h"
+#include <cmath>
+
+// m()߂
+float Quaternion::length() const
+{
+	return std::sqrt(x * x + y * y + z * z + w * w);
+}
+
+// K
+Quaternion& Quaternion::normalize()
+{
+	float len = length();
+	if (len != 0)
+	{
+		x /= len;
+		y /= len;
+		z /= len;
+		w /= len;
+	}
+	return *this;
+}
+
+// NH[^jI߂
+Quaternion Quaternion::conjugate() const
+{
+	return Quaternion(-x, -y, -z, w);
+}
+
+Quaternion Quaternion::operator-() const
+{
+	return Quaternion(-x, -y, -z, -w);
+}
+
+// ug̉]̂Ƃq̉]v(n~g q * this)
+Quaternion& Quaternion::operator*=(const Quaternion& q)
+{
+	Quaternion a = q;
+	Quaternion b = *this;
+	x = a.w * b.x + a.x * b.w + a.y * b.z - a.z * b.y;
+	y = a.w * b.y - a.x * b.z + a.y * b.w + a.z * b.x;
+	z = a.w * b.z + a.x * b.y - a.y * b.x + a.z * b.w;
+	w = a.w * b.w - a.x * b.x - a.y * b.y - a.z * b.z;
+	return *this;
+}
+
+// --Cӎ܂̉]\NH[^jI߂-- //
+Quaternion QuaternionRotateAxis(const Float3& axis, float angle)
+{
+	float s, c;
+	Util::SinCos(angle * 0.5f, &s, &c);
+	return Quaternion(axis.x * s, axis.y * s, axis.z * s, c);
+}
+
+// --IC[pNH[^jI߂(ZXY̏ɉ])-- //
+Quaternion QuaternionFromEuler(const Float3& euler)
+{
+	float sx, cx, sy, cy, sz, cz;
+	Util::SinCos(euler.x * 0.5f, &sx, &cx);
+	Util::SinCos(euler.y * 0.5f, &sy, &cy);
+	Util::SinCos(euler.z * 0.5f, &sz, &cz);
+
+	return Quaternion(
+		cz * sx * cy + sz * cx * sy,
+		cz * cx * sy - sz * sx * cy,
+		sz * cx * cy - cz * sx * sy,
+		cz * cx * cy + sz * sx * sy
+	);
+}
+
+// --ς߂-- //
+float QuaternionDot(const Quaternion& q1, const Quaternion& q2)
+{
+	return q1.x * q2.x + q1.y * q2.y + q1.z * q2.z + q1.w * q2.w;
+}
+
+// --KNH[^jIԂ-- //
+Quaternion QuaternionNormalize(const Quaternion& q)
+{
+	Quaternion tmp(q);
+	return tmp.normalize();
+}
+
+// --ʐ`-- //
+Quaternion QuaternionSlerp(const Quaternion& q1, const Quaternion& q2, float t)
+{
+	Quaternion end = q2;
+	float cos = QuaternionDot(q1, q2);
+
+	// ςȂ甽Α߂̂ŕ𔽓]
+	if (cos < 0.0f) {
+		end = -end;
+		cos = -cos;
+	}
+
+	// قړȂ`ԂĐK(0Z΍)
+	float k0 = 1.0f - t;
+	float k1 = t;
+	if (cos < 0.9995f) {
+		float theta = std::acos(cos);
+		float sin = std::sin(theta);
+		k0 = std::sin(k0 * theta) / sin;
+		k1 = std::sin(k1 * theta) / sin;
+	}
+
+	Quaternion result(
+		q1.x * k0 + end.x * k1,
+		q1.y * k0 + end.y * k1,
+		q1.z * k0 + end.z * k1,
+		q1.w * k0 + end.w * k1
+	);
+	return result.normalize();
+}
+
+// --xNg]-- //
+Float3 QuaternionRotate(const Float3& v, const Quaternion& q)
+{
+	// t = 2 * (q.xyz ~ v)
+	float tx = 2.0f * (q.y * v.z - q.z * v.y);
+	float ty = 2.0f * (q.z * v.x - q.x * v.z);
+	float tz = 2.0f * (q.x * v.y - q.y * v.x);
+
+	// v' = v + w * t + q.xyz ~ t
+	return Float3(
+		v.x + q.w * tx + (q.y * tz - q.z * ty),
+		v.y + q.w * ty + (q.z * tx - q.x * tz),
+		v.z + q.w * tz + (q.x * ty - q.y * tx)
+	);
+}
+
+const Quaternion operator*(const Quaternion& q1, const Quaternion& q2)
+{
+	Quaternion tmp(q1);
+	return tmp *= q2;
+}
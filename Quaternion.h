@@ -0,0 +1,63 @@
+#pragma once
+#include "Float3.h"
+
+struct Quaternion
+{
+	float x;// -> x
+	float y;// -> y
+	float z;// -> z
+	float w;// -> w
+
+	// RXgN^
+	constexpr Quaternion();// -----------------------------------> PʃNH[^jI
+	constexpr Quaternion(float x, float y, float z, float w);// -> w肵Đ
+
+	// o֐
+	float length() const;// ----------> m()߂
+	Quaternion& normalize();// -------> K
+	Quaternion conjugate() const;// --> NH[^jI߂
+
+	// PZqI[o[[h
+	Quaternion operator-() const;
+
+	// ZqI[o[[h
+	// q1 *= q2 ́uq1̉]̂Ƃq2̉]v(Matrix4̐ςƓ)
+	Quaternion& operator*=(const Quaternion& q);
+};
+
+// --PʃNH[^jI߂-- //
+constexpr Quaternion QuaternionIdentity();
+
+// --Cӎ܂̉]\NH[^jI߂(axis͐Kς݁Aangle͌ʓx@)-- //
+Quaternion QuaternionRotateAxis(const Float3& axis, float angle);
+
+// --IC[p(ʓx@)NH[^jI߂-- //
+// --]ZXY(Object3D̃[hsƓ)-- //
+Quaternion QuaternionFromEuler(const Float3& euler);
+
+// --ς߂-- //
+float QuaternionDot(const Quaternion& q1, const Quaternion& q2);
+
+// --KNH[^jIԂ-- //
+Quaternion QuaternionNormalize(const Quaternion& q);
+
+// --ʐ`(t0`1AŒZoHŕԂ)-- //
+Quaternion QuaternionSlerp(const Quaternion& q1, const Quaternion& q2, float t);
+
+// --xNg]-- //
+Float3 QuaternionRotate(const Float3& v, const Quaternion& q);
+
+// 2ZqI[o[[h
+const Quaternion operator*(const Quaternion& q1, const Quaternion& q2);
+
+// Ȃ̃RXgN^(PʃNH[^jI)
+constexpr Quaternion::Quaternion() : x(0.0f), y(0.0f), z(0.0f), w(1.0f) {}
+
+// ̃RXgN^
+constexpr Quaternion::Quaternion(float x, float y, float z, float w) : x(x), y(y), z(z), w(w) {}
+
+// --PʃNH[^jI߂-- //
+constexpr Quaternion QuaternionIdentity()
+{
+	return Quaternion(0.0f, 0.0f, 0.0f, 1.0f);
+}
@@ -4,6 +4,8 @@ cbuffer ConstBufferData3D : register(b0)
     matrix world;// -----> [hs
     float3 cameraPos;// -> JW([hW)
     float4 color;// -----> F(RGBA)
+    float3 positionOffset;// -> ʎqW߂Ƃ̍ŏ_
+    float3 positionScale;// --> ʎqW߂Ƃ̑傫
 }
 
 cbuffer MaterialData : register(b1)
@@ -63,6 +65,15 @@ cbuffer cbuff2 : register(b2)
     CircleShadow circleShadows[CIRCLESHADOW_NUM];
 }
 
+// --ʑ̂ɓe@(-1`1)PʃxNgɖ߂-- //
+float3 OctDecode(float2 e)
+{
+    float3 n = float3(e.x, e.y, 1.0f - abs(e.x) - abs(e.y));
+    float t = saturate(-n.z);
+    n.xy += n.xy >= 0.0f ? -t : t;
+    return normalize(n);
+}
+
 // --_VF[_[̏o͍\-- //
 // --_VF[_[sNZVF[_[ւ̂Ɏgp-- //
 struct VSOutput
@@ -0,0 +1,9 @@
+#include "Object3D.hlsli"
+
+// [x`悷pXp(W̗vfǂ)
+// ʎq_f[^̍WAABB̈ʒu(0`1)AʎqĂȂꍇpositionOffset0ApositionScale1Ȃ̂œŖ߂
+float4 main(float4 qpos : POSITION) : SV_POSITION
+{
+    float4 pos = float4(positionOffset + positionScale * qpos.xyz, 1.0f);
+    return mul(mul(viewproj, world), pos);
+}
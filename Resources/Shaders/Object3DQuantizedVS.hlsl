@@ -0,0 +1,23 @@
+#include "Object3D.hlsli"
+
+// ʎq_f[^(MeshQuantizedVertex)p
+// WAABB̈ʒu(0`1)A@͔ʑ̓e2AUV͔x
+VSOutput main(float4 qpos : POSITION, float2 qnormal : NORMAL, float2 uv : TEXCOORD)
+{
+    // WƖ@߂
+    float4 pos = float4(positionOffset + positionScale * qpos.xyz, 1.0f);
+    float3 normal = OctDecode(qnormal);
+
+	// @Ƀ[hsɂXP[OE]Kp
+    float4 wnormal = normalize(mul(world, float4(normal, 0)));
+    float4 wpos = mul(world, pos);
+    
+    VSOutput output; // sNZVF[_[ɓnl
+    output.svPos = mul(mul(viewproj, world), pos);
+    output.worldPos = wpos;
+    output.normal = wnormal.xyz;
+    output.color = color;
+    output.uv = uv;
+    
+    return output;
+}
@@ -13,9 +13,6 @@ Scene1::~Scene1()
 {
 	delete camera_;
 	delete lightGroup_;
-	delete sphereM_;
-	delete cubeM_;
-	delete floorM_;
 	delete object_[0];
 	delete object_[1];
 	delete object_[2];
@@ -30,19 +27,19 @@ void Scene1::Initialize()
 	camera_ = new Camera();
 	camera_->eye_ = { 0.0f, 10.0f, -30.0f };
 
-	// f
-	//sphereM_ = Model::CreateModel("sphere");
-	cubeM_ = Model::CreateModel("cube");
-	floorM_ = Model::CreateModel("floor");
+	// f(ÕV[ŎgĂ̂ModelManagerɎcĂ̂œǂݍ݂ȂȂ)
+	//sphereM_ = ModelManager::GetInstance()->Load("sphere");
+	cubeM_ = ModelManager::GetInstance()->Load("cube");
+	floorM_ = ModelManager::GetInstance()->Load("floor");
 
 	// IuWFNg
-	object_[0] = Object3D::CreateObject3D(cubeM_);
+	object_[0] = Object3D::CreateObject3D(cubeM_.get());
 	object_[0]->SetPos({ 3.0f, 1.0f, 0.0f });
 
-	object_[1] = Object3D::CreateObject3D(cubeM_);
+	object_[1] = Object3D::CreateObject3D(cubeM_.get());
 	object_[1]->SetPos({ -3.0f, 1.0f, 0.0f });
 
-	object_[2] = Object3D::CreateObject3D(floorM_);
+	object_[2] = Object3D::CreateObject3D(floorM_.get());
 	object_[2]->SetPos({ 0.0f, 0.0f, 0.0f });
 	object_[2]->SetScale({ 10.0f, 10.0f, 10.0f });
 
@@ -80,11 +77,11 @@ void Scene1::Update()
 	}
 
 	if (key_->TriggerKey(DIK_E)) {
-		object_[0]->SetModel(cubeM_);
+		object_[0]->SetModel(cubeM_.get());
 	}
 
 	if (key_->TriggerKey(DIK_Q)) {
-		object_[0]->SetModel(sphereM_);
+		object_[0]->SetModel(sphereM_.get());
 	}
 
 	static Float3 pos = { 0.0f, 0.5f, 0.0f };
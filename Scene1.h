@@ -1,6 +1,6 @@
 #pragma once
 #include "BaseScene.h"
-#include "Model.h"
+#include "ModelManager.h"
 #include "Object3D.h"
 #include "Camera.h"
 #include "LightGroup.h"
@@ -20,9 +20,9 @@ private:
 	LightGroup* lightGroup_;
 
 	// f
-	Model* sphereM_;
-	Model* cubeM_;
-	Model* floorM_;
+	ModelHandle sphereM_;
+	ModelHandle cubeM_;
+	ModelHandle floorM_;
 
 	// IuWFNg
 	Object3D* object_[3];
@@ -1,4 +1,6 @@
 #include "Util.h"
+#include "fSIMD.h"
+#include <cmath>
 
 int Util::Clamp(int value, int max, int min)
 {
@@ -24,12 +26,217 @@ float Util::Clamp(float value, float max, float min)
 	return value;
 }
 
-float Util::Radian2Degree(float radian)
+// --SinCos-- //
+// px/2̔{qƗ]r(|r| <= /4)ɕāAیƂsin(r), cos(r)ւ
+//   q % 4 == 0 -> ( sin r,  cos r)
+//   q % 4 == 1 -> ( cos r, -sin r)
+//   q % 4 == 2 -> (-sin r, -cos r)
+//   q % 4 == 3 -> (-cos r,  sin r)
+
+namespace {
+	// --͈͏kp̒萔-- //
+	constexpr double TWO_OVER_PI = 0.63661977236758134308;
+	constexpr double PIO2_HI = 1.57079632673412561417e+00;// -> /2̏33bit(q * PIO2_HI덷ȂɂȂ)
+	constexpr double PIO2_LO = 6.07710050650619224932e-11;// -> /2̎c
+	constexpr double EXACT_LIMIT = 1048576.0;// -> {xŔ͈͏kł(2^20)
+
+	constexpr float TWO_OVER_PI_F = 0.636619772f;
+	constexpr float PIO2_HI_F = 1.5703125f;// -> /2̏ʃrbg(q * PIO2_HI_F덷ȂɂȂ)
+	constexpr float PIO2_LO_F = 4.83826794897e-4f;// -> /2̎c
+	constexpr float FAST_LIMIT = 8192.0f;// -> PxŔ͈͏kł(ȏExactŌvZ)
+
+	// --ۂߗp̒萔(ZĂƍł߂ɂȂ)-- //
+	constexpr double ROUND_D = 6755399441055744.0;// -> 1.5 * 2^52
+	constexpr float ROUND_F = 12582912.0f;// -> 1.5 * 2^23
+
+	// --|r| <= /4 ł̑ߎ(ExactpA{x)-- //
+	inline double SinPolyD(double r, double r2) {
+		return r + r * r2 * (-1.0 / 6 + r2 * (1.0 / 120 + r2 * (-1.0 / 5040 + r2 * (1.0 / 362880
+			+ r2 * (-1.0 / 39916800 + r2 * (1.0 / 6227020800.0))))));
+	}
+	inline double CosPolyD(double r2) {
+		return 1.0 + r2 * (-1.0 / 2 + r2 * (1.0 / 24 + r2 * (-1.0 / 720 + r2 * (1.0 / 40320
+			+ r2 * (-1.0 / 3628800 + r2 * (1.0 / 479001600.0 + r2 * (-1.0 / 87178291200.0)))))));
+	}
+
+	// --|r| <= /4 ł̑ߎ(FastpAPx)-- //
+	constexpr float FS1 = -1.0f / 6, FS2 = 1.0f / 120, FS3 = -1.0f / 5040;
+	constexpr float FC1 = -1.0f / 2, FC2 = 1.0f / 24, FC3 = -1.0f / 720;
+	inline float SinPolyF(float r, float r2) {
+		return r + r * r2 * (FS1 + r2 * (FS2 + r2 * FS3));
+	}
+	inline float CosPolyF(float r2) {
+		return 1.0f + r2 * (FC1 + r2 * (FC2 + r2 * FC3));
+	}
+
+	// --یɍ킹sin, cosւĕt-- //
+	template <typename T>
+	inline void ApplyQuadrant(int q, T s, T c, float* sin, float* cos) {
+		if (q & 1) {
+			T tmp = s;
+			s = c;
+			c = -tmp;
+		}
+		if (q & 2) {
+			s = -s;
+			c = -c;
+		}
+		*sin = static_cast<float>(s);
+		*cos = static_cast<float>(c);
+	}
+
+	// --1vf(Exact)-- //
+	inline void SinCosExact(float angle, float* sin, float* cos) {
+		double x = angle;
+
+		// ͈͊O(NaN, ܂)͕WCuɔC
+		if (!(std::fabs(x) < EXACT_LIMIT)) {
+			*sin = static_cast<float>(std::sin(x));
+			*cos = static_cast<float>(std::cos(x));
+			return;
+		}
+
+		double q = (x * TWO_OVER_PI + ROUND_D) - ROUND_D;
+		double r = (x - q * PIO2_HI) - q * PIO2_LO;
+		double r2 = r * r;
+		ApplyQuadrant(static_cast<int>(q), SinPolyD(r, r2), CosPolyD(r2), sin, cos);
+	}
+
+	// --1vf(Fast)-- //
+	inline void SinCosFast(float angle, float* sin, float* cos) {
+		// ͈͊O(NaN, ܂)͏ی𐮐ɂłȂ̂ExactɔC
+		if (!(std::fabs(angle) < FAST_LIMIT)) {
+			SinCosExact(angle, sin, cos);
+			return;
+		}
+
+		float q = (angle * TWO_OVER_PI_F + ROUND_F) - ROUND_F;
+		float r = (angle - q * PIO2_HI_F) - q * PIO2_LO_F;
+		float r2 = r * r;
+		ApplyQuadrant(static_cast<int>(q), SinPolyF(r, r2), CosPolyF(r2), sin, cos);
+	}
+}
+
+void Util::SinCos(float angle, float* sin, float* cos, Precision precision)
 {
-	return radian * 180.0f / PI;
+	if (precision == Precision::Fast) SinCosFast(angle, sin, cos);
+	else SinCosExact(angle, sin, cos);
 }
 
-float Util::Degree2Radian(float degree)
+void Util::SinCos(const float* angles, float* sins, float* coss, size_t count, Precision precision)
 {
-	return degree * PI / 180.0f;
-}
\ No newline at end of file
+	size_t i = 0;
+
+#if defined(FMATH_SSE)
+	const __m128i one = _mm_set1_epi32(1);
+	const __m128i two = _mm_set1_epi32(2);
+
+	// --یɍ킹sin, cosւĕt(4vf)-- //
+	auto applyQuadrant = [&](__m128i qi, __m128 s, __m128 c, size_t index) {
+		// یsincosւ
+		__m128 swap = _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(qi, one), one));
+		__m128 sinV = _mm_or_ps(_mm_and_ps(swap, c), _mm_andnot_ps(swap, s));
+		__m128 cosV = _mm_or_ps(_mm_and_ps(swap, s), _mm_andnot_ps(swap, c));
+
+		// rbg𔽓](sin͏ی2,3Acos͏ی1,2)
+		__m128 sinSign = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(qi, two), 30));
+		__m128 cosSign = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(_mm_add_epi32(qi, one), two), 30));
+		_mm_storeu_ps(sins + index, _mm_xor_ps(sinV, sinSign));
+		_mm_storeu_ps(coss + index, _mm_xor_ps(cosV, cosSign));
+	};
+
+	if (precision == Precision::Fast) {
+		// --Px4vf-- //
+		const __m128 twoOverPi = _mm_set1_ps(TWO_OVER_PI_F);
+		const __m128 round = _mm_set1_ps(ROUND_F);
+		const __m128 pio2Hi = _mm_set1_ps(PIO2_HI_F);
+		const __m128 pio2Lo = _mm_set1_ps(PIO2_LO_F);
+		const __m128 limit = _mm_set1_ps(FAST_LIMIT);
+		const __m128 absMask = _mm_castsi128_ps(_mm_set1_epi32(0x7fffffff));
+
+		for (; i + 4 <= count; i += 4) {
+			__m128 x = _mm_loadu_ps(angles + i);
+
+			// ۂ߂l̉ʃrbĝ܂܏یɂȂ
+			__m128 qr = _mm_add_ps(_mm_mul_ps(x, twoOverPi), round);
+			__m128 q = _mm_sub_ps(qr, round);
+			__m128 r = _mm_sub_ps(_mm_sub_ps(x, _mm_mul_ps(q, pio2Hi)), _mm_mul_ps(q, pio2Lo));
+			__m128 r2 = _mm_mul_ps(r, r);
+
+			__m128 s = _mm_add_ps(r, _mm_mul_ps(_mm_mul_ps(r, r2),
+				_mm_add_ps(_mm_set1_ps(FS1), _mm_mul_ps(r2, _mm_add_ps(_mm_set1_ps(FS2), _mm_mul_ps(r2, _mm_set1_ps(FS3)))))));
+			__m128 c = _mm_add_ps(_mm_set1_ps(1.0f), _mm_mul_ps(r2,
+				_mm_add_ps(_mm_set1_ps(FC1), _mm_mul_ps(r2, _mm_add_ps(_mm_set1_ps(FC2), _mm_mul_ps(r2, _mm_set1_ps(FC3)))))));
+
+			applyQuadrant(_mm_castps_si128(qr), s, c, i);
+
+			// ͈͊O(NaN, ܂)̗vfExactŌvZ
+			int outside = _mm_movemask_ps(_mm_cmpnlt_ps(_mm_and_ps(x, absMask), limit));
+			if (outside) {
+				for (int k = 0; k < 4; k++) {
+					if (outside & (1 << k)) SinCosExact(angles[i + k], sins + i + k, coss + i + k);
+				}
+			}
+		}
+	}
+	else {
+		// --{x2vfvZA4vf܂Ƃ߂ĒPxɖ߂-- //
+		const __m128d twoOverPi = _mm_set1_pd(TWO_OVER_PI);
+		const __m128d round = _mm_set1_pd(ROUND_D);
+		const __m128d pio2Hi = _mm_set1_pd(PIO2_HI);
+		const __m128d pio2Lo = _mm_set1_pd(PIO2_LO);
+		const __m128 limit = _mm_set1_ps(static_cast<float>(EXACT_LIMIT));
+		const __m128 absMask = _mm_castsi128_ps(_mm_set1_epi32(0x7fffffff));
+
+		// x({x2vf)sin(r), cos(r)Əی߂
+		auto kernel = [&](__m128d x, __m128& s, __m128& c, __m128i& qi) {
+			__m128d q = _mm_sub_pd(_mm_add_pd(_mm_mul_pd(x, twoOverPi), round), round);
+			__m128d r = _mm_sub_pd(_mm_sub_pd(x, _mm_mul_pd(q, pio2Hi)), _mm_mul_pd(q, pio2Lo));
+			__m128d r2 = _mm_mul_pd(r, r);
+
+			__m128d sd = _mm_add_pd(_mm_set1_pd(-1.0 / 39916800), _mm_mul_pd(r2, _mm_set1_pd(1.0 / 6227020800.0)));
+			sd = _mm_add_pd(_mm_set1_pd(1.0 / 362880), _mm_mul_pd(r2, sd));
+			sd = _mm_add_pd(_mm_set1_pd(-1.0 / 5040), _mm_mul_pd(r2, sd));
+			sd = _mm_add_pd(_mm_set1_pd(1.0 / 120), _mm_mul_pd(r2, sd));
+			sd = _mm_add_pd(_mm_set1_pd(-1.0 / 6), _mm_mul_pd(r2, sd));
+			sd = _mm_add_pd(r, _mm_mul_pd(_mm_mul_pd(r, r2), sd));
+
+			__m128d cd = _mm_add_pd(_mm_set1_pd(1.0 / 479001600.0), _mm_mul_pd(r2, _mm_set1_pd(-1.0 / 87178291200.0)));
+			cd = _mm_add_pd(_mm_set1_pd(-1.0 / 3628800), _mm_mul_pd(r2, cd));
+			cd = _mm_add_pd(_mm_set1_pd(1.0 / 40320), _mm_mul_pd(r2, cd));
+			cd = _mm_add_pd(_mm_set1_pd(-1.0 / 720), _mm_mul_pd(r2, cd));
+			cd = _mm_add_pd(_mm_set1_pd(1.0 / 24), _mm_mul_pd(r2, cd));
+			cd = _mm_add_pd(_mm_set1_pd(-1.0 / 2), _mm_mul_pd(r2, cd));
+			cd = _mm_add_pd(_mm_set1_pd(1.0), _mm_mul_pd(r2, cd));
+
+			s = _mm_cvtpd_ps(sd);
+			c = _mm_cvtpd_ps(cd);
+			qi = _mm_cvtpd_epi32(q);
+		};
+
+		for (; i + 4 <= count; i += 4) {
+			__m128 xf = _mm_loadu_ps(angles + i);
+
+			__m128 sLo, cLo, sHi, cHi;
+			__m128i qLo, qHi;
+			kernel(_mm_cvtps_pd(xf), sLo, cLo, qLo);
+			kernel(_mm_cvtps_pd(_mm_movehl_ps(xf, xf)), sHi, cHi, qHi);
+
+			applyQuadrant(_mm_unpacklo_epi64(qLo, qHi), _mm_movelh_ps(sLo, sHi), _mm_movelh_ps(cLo, cHi), i);
+
+			// ͈͊O(NaN, ܂)̗vf͕WCuŌvZ
+			int outside = _mm_movemask_ps(_mm_cmpnlt_ps(_mm_and_ps(xf, absMask), limit));
+			if (outside) {
+				for (int k = 0; k < 4; k++) {
+					if (outside & (1 << k)) SinCosExact(angles[i + k], sins + i + k, coss + i + k);
+				}
+			}
+		}
+	}
+#endif
+
+	// --c̒[-- //
+	for (; i < count; i++) {
+		SinCos(angles[i], sins + i, coss + i, precision);
+	}
+}
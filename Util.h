@@ -1,8 +1,9 @@
 #pragma once
+#include <cstddef>
 
 namespace Util {
 
-	const float PI = 3.141592654f;
+	constexpr float PI = 3.141592654f;
 
 	// --玩֐-- //
 
@@ -31,13 +32,42 @@ namespace Util {
 	/// </summary>
 	/// <param name="radian"> ʓx@̒l </param>
 	/// <returns></returns>
-	float Radian2Degree(float radian);
+	constexpr float Radian2Degree(float radian) { return radian * 180.0f / PI; }
 
 	/// <summary>
 	/// x@̒lʓx@ɂĕԂ
 	/// </summary>
 	/// <param name="degree"> x@̒l </param>
 	/// <returns></returns>
-	float Degree2Radian(float degree);
+	constexpr float Degree2Radian(float degree) { return degree * PI / 180.0f; }
+
+	/// <summary>
+	/// SinCos̐x
+	/// Exact -> 덷1ulpȓ(|angle| < 2^20 ͈͔̔͂{xŌvZAȏstd::sin/std::cos)
+	/// Fast --> Ό덷 4e-6 ȓ(|angle| < 8192 ͈̔́AȏNaN, ExactŌvZ)Ap[eBNr{[h
+	/// </summary>
+	enum class Precision {
+		Exact,
+		Fast,
+	};
+
+	/// <summary>
+	/// TCƃRTC1͈̔͏kł܂Ƃ߂ċ߂
+	/// </summary>
+	/// <param name="angle"> px[ʓx@] </param>
+	/// <param name="sin"> TC̏o͐ </param>
+	/// <param name="cos"> RTC̏o͐ </param>
+	/// <param name="precision"> x </param>
+	void SinCos(float angle, float* sin, float* cos, Precision precision = Precision::Exact);
+
+	/// <summary>
+	/// px̔zɑ΂ăTCƃRTC܂Ƃ߂ċ߂(SIMD)
+	/// </summary>
+	/// <param name="angles"> px[ʓx@]̔z </param>
+	/// <param name="sins"> TC̏o͐(vfcount) </param>
+	/// <param name="coss"> RTC̏o͐(vfcount) </param>
+	/// <param name="count"> vf </param>
+	/// <param name="precision"> x </param>
+	void SinCos(const float* angles, float* sins, float* coss, size_t count, Precision precision = Precision::Exact);
 
 } // namespace MathUtility
\ No newline at end of file
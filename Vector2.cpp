@@ -1,116 +0,0 @@
-#include "Vector2.h"
-#include <cmath>    // sqrt
-
-// Ȃ̃RXgN^
-Vector2::Vector2() : x(0), y(0) {}
-
-// 2̃RXgN^
-Vector2::Vector2(float x, float y) : x(x), y(y) {}
-
-// xNg̒߂
-float Vector2::length() const
-{
-    return sqrt((x * x) + (y * y));
-}
-
-// xNg̐K
-Vector2& Vector2::normalize()
-{
-    float len = length();
-    if (len != 0)
-    {
-        return *this /= len;
-    }
-    return *this;
-}
-
-// ς߂
-float Vector2::dot(const Vector2& v) const
-{
-    return x * v.x + y * v.y;
-}
-
-// Oς߂
-float Vector2::cross(const Vector2& v) const
-{
-    return x * v.y - y * v.x;
-}
-
-// PZq+g悤ɂ
-Vector2 Vector2::operator+() const
-{
-    return *this;
-}
-
-// PZq-g悤ɂ
-Vector2 Vector2::operator-() const
-{
-    return Vector2(-x, -y);
-}
-
-// +=gpł悤ɂ
-Vector2& Vector2::operator+=(const Vector2& v)
-{
-    x += v.x;
-    y += v.y;
-    return *this;
-}
-
-// -=gpł悤ɂ
-Vector2& Vector2::operator-=(const Vector2& v)
-{
-    x -= v.x;
-    y -= v.y;
-    return *this;
-}
-
-// xNgs{ɂ
-Vector2& Vector2::operator*=(float s)
-{
-    x *= s;
-    y *= s;
-    return *this;
-}
-
-// xNg1/s{ɂ
-Vector2& Vector2::operator/=(float s)
-{
-    x /= s;
-    y /= s;
-    return *this;
-}
-
-// Vector2 NXɑȂ֐R
-// 񍀉Zq
-const Vector2 operator+(const Vector2& v1, const Vector2& v2)
-{
-    Vector2 temp(v1);
-    return temp += v2;
-}
-
-// xNg̈Zł悤ɂ
-const Vector2 operator-(const Vector2& v1, const Vector2& v2)
-{
-    Vector2 temp(v1);
-    return temp -= v2;
-}
-
-// xNgs{vZł悤ɂ
-const Vector2 operator*(const Vector2& v, float s)
-{
-    Vector2 temp(v);
-    return temp *= s;
-}
-
-// xNgs{vZł悤ɂ
-const Vector2 operator*(float s, const Vector2& v)
-{
-    return v * s;
-}
-
-// xNg1/s{vZł悤ɂ
-const Vector2 operator/(const Vector2& v, float s)
-{
-    Vector2 temp(v);
-    return temp /= s;
-}
\ No newline at end of file
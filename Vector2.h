@@ -1,4 +1,5 @@
 #pragma once
+#include <cmath>    // sqrt
 
 struct Vector2
 {
@@ -6,30 +7,144 @@ struct Vector2
 	float y;// -> y
 
 	// RXgN^
-	Vector2();// -----------------> xNgƂĐ
-	Vector2(float x, float y);// -> xAyw肵Ă̐
+	constexpr Vector2();// -----------------> xNgƂĐ
+	constexpr Vector2(float x, float y);// -> xAyw肵Ă̐
 
 	// o֐
-	float length() const;// -----------------> m()߂
-	Vector2& normalize();// ----------------> K
-	float dot(const Vector2& v) const;// ---> ς߂
-	float cross(const Vector2& v) const;// -> Oς߂
+	float length() const;// ---------------------------> m()߂
+	Vector2& normalize();// --------------------------> K
+	constexpr float dot(const Vector2& v) const;// ---> ς߂
+	constexpr float cross(const Vector2& v) const;// -> Oς߂
 
 	// PZqI[o[[h
-	Vector2 operator+() const;
-	Vector2 operator-() const;
+	constexpr Vector2 operator+() const;
+	constexpr Vector2 operator-() const;
 
 	// ZqI[o[[h
-	Vector2& operator+=(const Vector2& v);
-	Vector2& operator-=(const Vector2& v);
-	Vector2& operator*=(float s);
-	Vector2& operator/=(float s);
+	constexpr Vector2& operator+=(const Vector2& v);
+	constexpr Vector2& operator-=(const Vector2& v);
+	constexpr Vector2& operator*=(float s);
+	constexpr Vector2& operator/=(float s);
 };
 
 // 2ZqI[o[[h
 // Ȉ̃p^[ɑΉ邽߁Aȉ̂悤ɏĂ
-const Vector2 operator+(const Vector2& v1, const Vector2& v2);
-const Vector2 operator-(const Vector2& v1, const Vector2& v2);
-const Vector2 operator*(const Vector2& v, float s);
-const Vector2 operator*(float s, const Vector2& v);
-const Vector2 operator/(const Vector2& v, float s);
\ No newline at end of file
+constexpr const Vector2 operator+(const Vector2& v1, const Vector2& v2);
+constexpr const Vector2 operator-(const Vector2& v1, const Vector2& v2);
+constexpr const Vector2 operator*(const Vector2& v, float s);
+constexpr const Vector2 operator*(float s, const Vector2& v);
+constexpr const Vector2 operator/(const Vector2& v, float s);
+
+// Ȃ̃RXgN^
+constexpr Vector2::Vector2() : x(0), y(0) {}
+
+// 2̃RXgN^
+constexpr Vector2::Vector2(float x, float y) : x(x), y(y) {}
+
+// xNg̒߂
+inline float Vector2::length() const
+{
+    return std::sqrt((x * x) + (y * y));
+}
+
+// xNg̐K
+inline Vector2& Vector2::normalize()
+{
+    float len = length();
+    if (len != 0)
+    {
+        return *this /= len;
+    }
+    return *this;
+}
+
+// ς߂
+constexpr float Vector2::dot(const Vector2& v) const
+{
+    return x * v.x + y * v.y;
+}
+
+// Oς߂
+constexpr float Vector2::cross(const Vector2& v) const
+{
+    return x * v.y - y * v.x;
+}
+
+// PZq+g悤ɂ
+constexpr Vector2 Vector2::operator+() const
+{
+    return *this;
+}
+
+// PZq-g悤ɂ
+constexpr Vector2 Vector2::operator-() const
+{
+    return Vector2(-x, -y);
+}
+
+// +=gpł悤ɂ
+constexpr Vector2& Vector2::operator+=(const Vector2& v)
+{
+    x += v.x;
+    y += v.y;
+    return *this;
+}
+
+// -=gpł悤ɂ
+constexpr Vector2& Vector2::operator-=(const Vector2& v)
+{
+    x -= v.x;
+    y -= v.y;
+    return *this;
+}
+
+// xNgs{ɂ
+constexpr Vector2& Vector2::operator*=(float s)
+{
+    x *= s;
+    y *= s;
+    return *this;
+}
+
+// xNg1/s{ɂ
+constexpr Vector2& Vector2::operator/=(float s)
+{
+    x /= s;
+    y /= s;
+    return *this;
+}
+
+// Vector2 NXɑȂ֐Q
+// 񍀉Zq
+constexpr const Vector2 operator+(const Vector2& v1, const Vector2& v2)
+{
+    Vector2 temp(v1);
+    return temp += v2;
+}
+
+// xNg̈Zł悤ɂ
+constexpr const Vector2 operator-(const Vector2& v1, const Vector2& v2)
+{
+    Vector2 temp(v1);
+    return temp -= v2;
+}
+
+// xNgs{vZł悤ɂ
+constexpr const Vector2 operator*(const Vector2& v, float s)
+{
+    Vector2 temp(v);
+    return temp *= s;
+}
+
+// xNgs{vZł悤ɂ
+constexpr const Vector2 operator*(float s, const Vector2& v)
+{
+    return v * s;
+}
+
+// xNg1/s{vZł悤ɂ
+constexpr const Vector2 operator/(const Vector2& v, float s)
+{
+    Vector2 temp(v);
+    return temp /= s;
+}
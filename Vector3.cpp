@@ -1,117 +0,0 @@
-#include "Vector3.h"
-#include <cmath>    // sqrt
-
-// RXgN^
-Vector3::Vector3() : x(0), y(0), z(0) {}
-
-Vector3::Vector3(float x, float y, float z)
-{
-	this->x = x;
-	this->y = y;
-	this->z = z;
-}
-
-// o֐
-
-// m()߂
-float Vector3::length() const
-{
-	return sqrt((x * x) + (y * y) + (z * z));
-}
-
-Vector3& Vector3::normalize()
-{
-	float len = length();
-	if (len != 0)
-	{
-		return *this /= len;
-	}
-	return *this;
-}
-
-// ς߂
-float Vector3::dot(const Vector3& v) const
-{
-	return x * v.x + y * v.y + z * v.z;
-}
-
-// Oς߂
-Vector3 Vector3::cross(const Vector3& v) const
-{
-	return Vector3(y * v.z - z * v.y, z * v.x - x * v.z, x * v.y - y * v.x);
-}
-
-// PZqI[o[[h
-Vector3 Vector3::operator+() const
-{
-	return *this;
-}
-
-Vector3 Vector3::operator-() const
-{
-	return Vector3(-x, -y, -z);
-}
-
-// ZqI[o[[h
-Vector3& Vector3::operator+=(const Vector3& v)
-{
-	x += v.x;
-	y += v.y;
-	z += v.z;
-	return *this;
-}
-
-Vector3& Vector3::operator-=(const Vector3& v)
-{
-	x -= v.x;
-	y -= v.y;
-	z -= v.z;
-	return *this;
-}
-
-Vector3& Vector3::operator*=(float s)
-{
-	x *= s;
-	y *= s;
-	z *= s;
-	return *this;
-}
-
-Vector3& Vector3::operator/=(float s)
-{
-	x /= s;
-	y /= s;
-	z /= s;
-	return *this;
-}
-
-// 2ZqI[o[[h
-// Ȉ̃p^[ɑΉ(̏)邽߁Aȉ̂悤ɏĂ
-const Vector3 operator+(const Vector3& v1, const Vector3& v2)
-{
-	Vector3 temp(v1);
-	return temp += v2;
-}
-
-const Vector3 operator-(const Vector3& v1, const Vector3& v2)
-{
-	Vector3 temp(v1);
-	return temp -= v2;
-}
-
-const Vector3 operator*(const Vector3& v, float s)
-{
-	Vector3 temp(v);
-	return temp *= s;
-}
-
-const Vector3 operator*(float s, const Vector3& v)
-{
-	return v * s;
-}
-
-const Vector3 operator/(const Vector3& v, float s)
-{
-	Vector3 temp(v);
-	return temp /= s;
-}
\ No newline at end of file
@@ -1,4 +1,5 @@
 #pragma once
+#include <cmath>    // sqrt
 
 class Vector3
 {
@@ -10,30 +11,139 @@ public:
 public:
 
 	// RXgN^
-	Vector3();// --------------------------> xNgƂ
-	Vector3(float x, float y, float z);// -> x, y, z w肵Ă̐
+	constexpr Vector3();// --------------------------> xNgƂ
+	constexpr Vector3(float x, float y, float z);// -> x, y, z w肵Ă̐
 
 	// o֐
-	float length() const;// -------------------> m()߂
-	Vector3& normalize();// ------------------> K
-	float dot(const Vector3& v) const;// -----> ς߂
-	Vector3 cross(const Vector3& v) const;// -> Oς߂
+	float length() const;// -----------------------------> m()߂
+	Vector3& normalize();// ----------------------------> K
+	constexpr float dot(const Vector3& v) const;// -----> ς߂
+	constexpr Vector3 cross(const Vector3& v) const;// -> Oς߂
 
 	// PZqI[o[[h
-	Vector3 operator+() const;
-	Vector3 operator-() const;
+	constexpr Vector3 operator+() const;
+	constexpr Vector3 operator-() const;
 
 	// ZqI[o[[h
-	Vector3& operator+=(const Vector3& v);
-	Vector3& operator-=(const Vector3& v);
-	Vector3& operator*=(float s);
-	Vector3& operator/=(float s);
+	constexpr Vector3& operator+=(const Vector3& v);
+	constexpr Vector3& operator-=(const Vector3& v);
+	constexpr Vector3& operator*=(float s);
+	constexpr Vector3& operator/=(float s);
 };
 
 // 2ZqI[o[[h
 // Ȉ̃p^[ɑΉ(̏)邽߁Aȉ̂悤ɏĂ
-const Vector3 operator+(const Vector3& v1, const Vector3& v2);
-const Vector3 operator-(const Vector3& v1, const Vector3& v2);
-const Vector3 operator*(const Vector3& v, float s);
-const Vector3 operator*(float s, const Vector3& v);
-const Vector3 operator/(const Vector3& v, float s);
\ No newline at end of file
+constexpr const Vector3 operator+(const Vector3& v1, const Vector3& v2);
+constexpr const Vector3 operator-(const Vector3& v1, const Vector3& v2);
+constexpr const Vector3 operator*(const Vector3& v, float s);
+constexpr const Vector3 operator*(float s, const Vector3& v);
+constexpr const Vector3 operator/(const Vector3& v, float s);
+
+// RXgN^
+constexpr Vector3::Vector3() : x(0), y(0), z(0) {}
+
+constexpr Vector3::Vector3(float x, float y, float z) : x(x), y(y), z(z) {}
+
+// o֐
+
+// m()߂
+inline float Vector3::length() const
+{
+	return std::sqrt((x * x) + (y * y) + (z * z));
+}
+
+inline Vector3& Vector3::normalize()
+{
+	float len = length();
+	if (len != 0)
+	{
+		return *this /= len;
+	}
+	return *this;
+}
+
+// ς߂
+constexpr float Vector3::dot(const Vector3& v) const
+{
+	return x * v.x + y * v.y + z * v.z;
+}
+
+// Oς߂
+constexpr Vector3 Vector3::cross(const Vector3& v) const
+{
+	return Vector3(y * v.z - z * v.y, z * v.x - x * v.z, x * v.y - y * v.x);
+}
+
+// PZqI[o[[h
+constexpr Vector3 Vector3::operator+() const
+{
+	return *this;
+}
+
+constexpr Vector3 Vector3::operator-() const
+{
+	return Vector3(-x, -y, -z);
+}
+
+// ZqI[o[[h
+constexpr Vector3& Vector3::operator+=(const Vector3& v)
+{
+	x += v.x;
+	y += v.y;
+	z += v.z;
+	return *this;
+}
+
+constexpr Vector3& Vector3::operator-=(const Vector3& v)
+{
+	x -= v.x;
+	y -= v.y;
+	z -= v.z;
+	return *this;
+}
+
+constexpr Vector3& Vector3::operator*=(float s)
+{
+	x *= s;
+	y *= s;
+	z *= s;
+	return *this;
+}
+
+constexpr Vector3& Vector3::operator/=(float s)
+{
+	x /= s;
+	y /= s;
+	z /= s;
+	return *this;
+}
+
+// 2ZqI[o[[h
+constexpr const Vector3 operator+(const Vector3& v1, const Vector3& v2)
+{
+	Vector3 temp(v1);
+	return temp += v2;
+}
+
+constexpr const Vector3 operator-(const Vector3& v1, const Vector3& v2)
+{
+	Vector3 temp(v1);
+	return temp -= v2;
+}
+
+constexpr const Vector3 operator*(const Vector3& v, float s)
+{
+	Vector3 temp(v);
+	return temp *= s;
+}
+
+constexpr const Vector3 operator*(float s, const Vector3& v)
+{
+	return v * s;
+}
+
+constexpr const Vector3 operator/(const Vector3& v, float s)
+{
+	Vector3 temp(v);
+	return temp /= s;
+}
@@ -4,4 +4,5 @@
 #include "Float4.h"
 #include "Vector2.h"
 #include "Vector3.h"
+#include "Quaternion.h"
 #include "Matrix4.h"
\ No newline at end of file
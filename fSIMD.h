@@ -0,0 +1,44 @@
+#pragma once
+// --wCupSIMD߃ZbgI-- //
+// FMATH_NO_SIMD `ƃXJ[ɌŒ肳
+// I̓RpCɍsAs͓̕Ȃ
+
+#if !defined(FMATH_NO_SIMD) && (defined(__AVX__))
+#define FMATH_AVX 1
+#define FMATH_SSE 1
+#elif !defined(FMATH_NO_SIMD) && (defined(_M_X64) || defined(__SSE2__) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define FMATH_SSE 1
+#elif !defined(FMATH_NO_SIMD) && (defined(_M_ARM64) || defined(__aarch64__))
+#define FMATH_NEON 1
+#endif
+
+#if defined(FMATH_AVX)
+#include <immintrin.h>
+#elif defined(FMATH_SSE)
+#include <emmintrin.h>
+#elif defined(FMATH_NEON)
+#include <arm_neon.h>
+#endif
+
+#if defined(FMATH_SSE)
+// --xyzxyz...ƕ4_x, y, z̃WX^ɕבւiAVX̏ꍇ128bit[Ɓj-- //
+#define FMATH_DEINTERLEAVE3(PS, a, b, c, x, y, z) {\
+	auto xy_ = PS##shuffle_ps(b, c, _MM_SHUFFLE(2, 1, 3, 2));\
+	auto yz_ = PS##shuffle_ps(a, b, _MM_SHUFFLE(1, 0, 2, 1));\
+	x = PS##shuffle_ps(a, xy_, _MM_SHUFFLE(2, 0, 3, 0));\
+	y = PS##shuffle_ps(yz_, xy_, _MM_SHUFFLE(3, 1, 2, 0));\
+	z = PS##shuffle_ps(yz_, c, _MM_SHUFFLE(3, 0, 3, 1));\
+}
+
+// --x, y, z̃WX^xyzxyz...̕тɖ߂-- //
+#define FMATH_INTERLEAVE3(PS, x, y, z, a, b, c) {\
+	auto lo_ = PS##unpacklo_ps(x, y);\
+	auto hi_ = PS##unpackhi_ps(x, y);\
+	auto zx_ = PS##shuffle_ps(z, lo_, _MM_SHUFFLE(2, 2, 0, 0));\
+	auto yz_ = PS##shuffle_ps(lo_, z, _MM_SHUFFLE(1, 1, 3, 3));\
+	auto zw_ = PS##shuffle_ps(z, hi_, _MM_SHUFFLE(3, 2, 3, 2));\
+	a = PS##shuffle_ps(lo_, zx_, _MM_SHUFFLE(2, 0, 1, 0));\
+	b = PS##shuffle_ps(yz_, hi_, _MM_SHUFFLE(1, 0, 2, 0));\
+	c = PS##shuffle_ps(zw_, zw_, _MM_SHUFFLE(1, 3, 2, 0));\
+}
+#endif